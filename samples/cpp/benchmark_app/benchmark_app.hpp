@@ -43,6 +43,21 @@ static const char model_message[] =
     "Required. Path to an .xml/.onnx file with a trained model or to a .blob files with "
     "a trained compiled model.";
 
+/// @brief message for multi-model argument
+static const char multi_model_message[] =
+    "Optional. Benchmark several models concurrently on one OpenVINO Core instead of a single -m model.\n"
+    "                              Models are separated by commas, per-model options are given in brackets: "
+    "\"det.xml[nireq=2,hint=latency,rate=30],cls.xml[nireq=4,hint=tput]\".\n"
+    "                              'nireq' - number of infer requests, 'hint' - performance hint "
+    "(latency/tput/ctput/none), 'rate' - requests per second (0 means as fast as possible).\n"
+    "                              Each model is first measured alone and then together with the others to report "
+    "cross-model interference.";
+
+/// @brief message for skipping isolated runs in multi-model mode
+static const char multi_model_isolated_message[] =
+    "Optional. Measure each -mm model alone before the concurrent run to report interference metrics. "
+    "Default value is true.";
+
 /// @brief message for performance hint
 static const char hint_message[] =
     "Optional. Performance hint allows the OpenVINO device to select the right model-specific settings.\n"
@@ -161,6 +176,11 @@ static const char pc_sort_message[] =
 // @brief message for performance counters for sequence option
 static const char pcseq_message[] = "Optional. Report latencies for each shape in -data_shape sequence.";
 
+// @brief message for hardware performance counters option
+static const char pc_hw_message[] =
+    "Optional. Collect hardware performance counters (cycles, instructions, LLC references and misses) "
+    "for each node along with performance counters. Supported by CPU on Linux only.";
+
 #ifdef HAVE_DEVICE_MEM_SUPPORT
 // @brief message for switching memory allocation type option
 static const char use_device_mem_message[] =
@@ -270,6 +290,13 @@ DEFINE_string(i, "", input_message);
 /// It is a required parameter
 DEFINE_string(m, "", model_message);
 
+/// @brief Define parameter for set models to benchmark concurrently <br>
+/// It is an optional parameter
+DEFINE_string(mm, "", multi_model_message);
+
+/// @brief Define flag for measuring -mm models in isolation first <br>
+DEFINE_bool(mm_isolated, true, multi_model_isolated_message);
+
 /// @brief Define execution mode
 DEFINE_string(hint, "", hint_message);
 
@@ -336,6 +363,9 @@ DEFINE_string(pcsort, "", pc_sort_message);
 /// @brief Define flag for showing performance sequence counters <br>
 DEFINE_bool(pcseq, false, pcseq_message);
 
+/// @brief Define flag for collecting hardware performance counters <br>
+DEFINE_bool(pc_hw, false, pc_hw_message);
+
 #ifdef HAVE_DEVICE_MEM_SUPPORT
 /// @brief Define flag for switching beetwen host and device memory allocation for input and output buffers
 DEFINE_bool(use_device_mem, false, use_device_mem_message);
@@ -396,6 +426,8 @@ static void show_usage() {
     std::cout << std::endl;
     std::cout << "    -h, --help                " << help_message << std::endl;
     std::cout << "    -m \"<path>\"               " << model_message << std::endl;
+    std::cout << "    -mm \"<path>[<options>],...\" " << multi_model_message << std::endl;
+    std::cout << "    -mm_isolated              " << multi_model_isolated_message << std::endl;
     std::cout << "    -i \"<path>\"               " << input_message << std::endl;
     std::cout << "    -d \"<device>\"             " << target_device_message << std::endl;
     std::cout << "    -extensions \"<absolute_path>\" " << custom_extensions_library_message << std::endl;
@@ -429,6 +461,7 @@ static void show_usage() {
     std::cout << "    -pc                       " << pc_message << std::endl;
     std::cout << "    -pcsort                   " << pc_sort_message << std::endl;
     std::cout << "    -pcseq                    " << pcseq_message << std::endl;
+    std::cout << "    -pc_hw                    " << pc_hw_message << std::endl;
     std::cout << "    -dump_config              " << dump_config_message << std::endl;
     std::cout << "    -load_config              " << load_config_message << std::endl;
     std::cout << "    -infer_precision \"<element type>\"" << inference_precision_message << std::endl;
@@ -16,6 +16,7 @@
 
 #include "gna/gna_config.hpp"
 #include "gpu/gpu_config.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 
 #include "samples/args_helper.hpp"
 #include "samples/common.hpp"
@@ -24,6 +25,7 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "multi_model.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
@@ -41,10 +43,16 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
+    if (FLAGS_m.empty() && FLAGS_mm.empty()) {
         show_usage();
         throw std::logic_error("Model is required but not set. Please set -m option.");
     }
+    if (!FLAGS_m.empty() && !FLAGS_mm.empty()) {
+        throw std::logic_error("-m and -mm options are mutually exclusive. Please set only one of them.");
+    }
+    if (!FLAGS_mm.empty() && FLAGS_api != "async") {
+        throw std::logic_error("Multi-model benchmarking (-mm option) is available for async API only.");
+    }
 
     if (FLAGS_latency_percentile > 100 || FLAGS_latency_percentile < 1) {
         show_usage();
@@ -95,17 +103,28 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
 
 void next_step(const std::string additional_info = "") {
     static size_t step_id = 0;
-    static const std::map<size_t, std::string> step_names = {{1, "Parsing and validating input arguments"},
-                                                             {2, "Loading OpenVINO Runtime"},
-                                                             {3, "Setting device configuration"},
-                                                             {4, "Reading model files"},
-                                                             {5, "Resizing model to match image sizes and given batch"},
-                                                             {6, "Configuring input of the model"},
-                                                             {7, "Loading the model to the device"},
-                                                             {8, "Querying optimal runtime parameters"},
-                                                             {9, "Creating infer requests and preparing input tensors"},
-                                                             {10, "Measuring performance"},
-                                                             {11, "Dumping statistics report"}};
+    static const std::map<size_t, std::string> single_model_step_names = {
+        {1, "Parsing and validating input arguments"},
+        {2, "Loading OpenVINO Runtime"},
+        {3, "Setting device configuration"},
+        {4, "Reading model files"},
+        {5, "Resizing model to match image sizes and given batch"},
+        {6, "Configuring input of the model"},
+        {7, "Loading the model to the device"},
+        {8, "Querying optimal runtime parameters"},
+        {9, "Creating infer requests and preparing input tensors"},
+        {10, "Measuring performance"},
+        {11, "Dumping statistics report"}};
+    // the models of -mm option are read, compiled and measured by run_multi_model_benchmark
+    static const std::map<size_t, std::string> multi_model_step_names = {
+        {1, "Parsing and validating input arguments"},
+        {2, "Loading OpenVINO Runtime"},
+        {3, "Setting device configuration"},
+        {4, "Parsing the list of models"},
+        {5, "Loading the models to the device and creating infer requests"},
+        {6, "Measuring performance"},
+        {7, "Dumping statistics report"}};
+    const auto& step_names = FLAGS_mm.empty() ? single_model_step_names : multi_model_step_names;
 
     step_id++;
 
@@ -385,6 +404,14 @@ int main(int argc, char* argv[]) {
                 return std::find(std::begin(supported_properties), std::end(supported_properties), key) !=
                        std::end(supported_properties);
             };
+            if (FLAGS_pc_hw) {
+                if (supported(ov::intel_cpu::hardware_counters.name())) {
+                    device_config.emplace(ov::intel_cpu::hardware_counters(true));
+                } else {
+                    slog::warn << "Device " << device << " does not support hardware performance counters."
+                               << slog::endl;
+                }
+            }
             // the rest are individual per-device settings (overriding the values set with perf modes)
             auto setThroughputStreams = [&]() {
                 std::string key = getDeviceTypeFromName(device) + "_THROUGHPUT_STREAMS";
@@ -603,6 +630,30 @@ int main(int argc, char* argv[]) {
             core.set_property(ov::hint::allow_auto_batching(false));
         }
 
+        if (!FLAGS_mm.empty()) {
+            // ----------------- 4-7. Multi-model run: every model gets its own requests, all models share
+            // the core and so the device executors
+            next_step();
+            auto models = benchmark_app::parse_multi_model_string(FLAGS_mm);
+            benchmark_app::MultiModelConfig mm_config;
+            mm_config.device_name = device_name;
+            mm_config.niter = FLAGS_niter;
+            mm_config.duration_seconds =
+                FLAGS_t != 0 ? FLAGS_t : (FLAGS_niter == 0 ? device_default_device_duration_in_seconds(device_name) : 0);
+            mm_config.latency_percentile = FLAGS_latency_percentile;
+            mm_config.measure_isolated = FLAGS_mm_isolated && models.size() > 1;
+            benchmark_app::run_multi_model_benchmark(core, models, mm_config, statistics, next_step);
+            next_step();
+            if (!FLAGS_dump_config.empty()) {
+                dump_config(FLAGS_dump_config, config);
+                slog::info << "OpenVINO Runtime configuration settings were dumped to " << FLAGS_dump_config
+                           << slog::endl;
+            }
+            if (statistics)
+                statistics->dump();
+            return 0;
+        }
+
         bool isDynamicNetwork = false;
 
         if (FLAGS_load_from_file && !isNetworkCompiled) {
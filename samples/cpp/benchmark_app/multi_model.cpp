@@ -0,0 +1,318 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// clang-format off
+#include "samples/common.hpp"
+#include "samples/slog.hpp"
+
+#include "infer_request_wrap.hpp"
+#include "inputs_filling.hpp"
+#include "multi_model.hpp"
+#include "utils.hpp"
+// clang-format on
+
+namespace benchmark_app {
+namespace {
+struct ModelRun {
+    ModelSpec spec;
+    std::string name;
+    ov::CompiledModel compiled_model;
+    std::vector<InputsInfo> inputs_info;
+    size_t batch_size = 1;
+    std::unique_ptr<InferRequestsQueue> queue;
+};
+
+struct RunResult {
+    size_t iterations = 0;
+    double duration_ms = 0;
+    double fps = 0;
+    LatencyMetrics latency;
+};
+
+ov::hint::PerformanceMode parse_hint(const std::string& hint) {
+    if (hint == "throughput" || hint == "tput") {
+        return ov::hint::PerformanceMode::THROUGHPUT;
+    } else if (hint == "latency") {
+        return ov::hint::PerformanceMode::LATENCY;
+    } else if (hint == "cumulative_throughput" || hint == "ctput") {
+        return ov::hint::PerformanceMode::CUMULATIVE_THROUGHPUT;
+    } else if (hint == "none" || hint.empty()) {
+        return ov::hint::PerformanceMode::UNDEFINED;
+    }
+    throw std::logic_error("Incorrect performance hint '" + hint +
+                           "' in -mm option. Applicable values are latency, tput, ctput and none.");
+}
+
+void prepare_model(ov::Core& core, ModelRun& run, const MultiModelConfig& config) {
+    ov::AnyMap properties;
+    if (!run.spec.hint.empty()) {
+        properties.emplace(ov::hint::performance_mode(parse_hint(run.spec.hint)));
+    }
+    // nireq only sets the number of requests created below, ov::hint::num_requests is not passed as it would
+    // change the number of streams selected by the device
+
+    auto start_time = Time::now();
+    if (fileExt(run.spec.path) == "blob") {
+        std::ifstream model_stream(run.spec.path, std::ios_base::binary | std::ios_base::in);
+        if (!model_stream.is_open()) {
+            throw std::runtime_error("Cannot open model file " + run.spec.path);
+        }
+        run.compiled_model = core.import_model(model_stream, config.device_name, properties);
+    } else {
+        run.compiled_model = core.compile_model(run.spec.path, config.device_name, properties);
+    }
+    slog::info << "[" << run.name << "] Compile model took " << double_to_string(get_duration_ms_till_now(start_time))
+               << " ms" << slog::endl;
+
+    run.inputs_info = get_inputs_info("", "", 0, "", {}, "", "", run.compiled_model.inputs());
+    for (const auto& input : run.inputs_info.at(0)) {
+        if (input.second.partialShape.is_dynamic()) {
+            throw std::logic_error("Model " + run.spec.path +
+                                   " has dynamic inputs. Only models with static shapes can be used with -mm option.");
+        }
+    }
+    run.batch_size = get_batch_size(run.inputs_info.at(0));
+
+    uint32_t nireq = run.spec.nireq;
+    if (nireq == 0) {
+        nireq = run.compiled_model.get_property(ov::optimal_number_of_infer_requests);
+    }
+    run.queue.reset(new InferRequestsQueue(run.compiled_model, nireq, 1, false));
+
+    // inputs are filled once with random data, the measurement loop is inference only
+    auto inputs_data = get_tensors_static_case({}, run.batch_size, run.inputs_info.at(0), nireq);
+    size_t i = 0;
+    for (auto& request : run.queue->requests) {
+        for (auto& item : run.inputs_info.at(0)) {
+            const auto& data = inputs_data.at(item.first);
+            auto tensor = request->get_tensor(item.first);
+            copy_tensor_data(tensor, data[i % data.size()]);
+        }
+        ++i;
+    }
+    slog::info << "[" << run.name << "] " << nireq << " infer requests"
+               << (run.spec.rate > 0 ? ", rate " + double_to_string(run.spec.rate) + " req/s" : "")
+               << (run.spec.hint.empty() ? "" : ", hint " + run.spec.hint) << slog::endl;
+}
+
+/// Drives one model until the iteration or time limit is reached. When rate is set, requests are submitted
+/// at fixed intervals instead of as soon as an idle request is available.
+RunResult run_model(ModelRun& run, const MultiModelConfig& config) {
+    auto& queue = *run.queue;
+    const uint64_t duration_nanoseconds = get_duration_in_nanoseconds(config.duration_seconds);
+    const auto interval =
+        run.spec.rate > 0 ? ns(static_cast<int64_t>(1000000000.0 / run.spec.rate)) : ns(0);
+
+    // warming up - out of scope
+    queue.get_idle_request()->start_async();
+    queue.wait_all();
+    queue.reset_times();
+
+    RunResult result;
+    auto start_time = Time::now();
+    auto next_submit = start_time;
+    uint64_t exec_time = 0;
+    while ((config.niter != 0 && result.iterations < config.niter) ||
+           (duration_nanoseconds != 0 && exec_time < duration_nanoseconds)) {
+        if (interval.count() != 0) {
+            std::this_thread::sleep_until(next_submit);
+            next_submit += interval;
+        }
+        auto request = queue.get_idle_request();
+        request->start_async();
+        ++result.iterations;
+        exec_time = std::chrono::duration_cast<ns>(Time::now() - start_time).count();
+    }
+    queue.wait_all();
+
+    result.duration_ms = queue.get_duration_in_milliseconds();
+    result.fps = result.duration_ms > 0 ? 1000.0 * result.iterations * run.batch_size / result.duration_ms : 0;
+    result.latency = LatencyMetrics(queue.get_latencies(), "", config.latency_percentile);
+    return result;
+}
+
+std::vector<RunResult> run_concurrently(std::vector<ModelRun>& runs, const MultiModelConfig& config) {
+    std::vector<RunResult> results(runs.size());
+    std::vector<std::exception_ptr> errors(runs.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < runs.size(); ++i) {
+        threads.emplace_back([&, i] {
+            try {
+                results[i] = run_model(runs[i], config);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    return results;
+}
+
+void report_result(const ModelRun& run,
+                   const RunResult& result,
+                   const std::string& phase,
+                   const std::shared_ptr<StatisticsReport>& statistics) {
+    slog::info << "[" << run.name << "] " << phase << ": " << result.iterations << " iterations, "
+               << double_to_string(result.duration_ms) << " ms, " << double_to_string(result.fps) << " FPS"
+               << slog::endl;
+    result.latency.write_to_slog();
+    if (statistics) {
+        const std::string prefix = run.name + " " + phase;
+        std::string json_prefix = run.name + "_" + phase;
+        std::replace(json_prefix.begin(), json_prefix.end(), ' ', '_');
+        statistics->add_parameters(
+            StatisticsReport::Category::EXECUTION_RESULTS,
+            {StatisticsVariant(prefix + " iterations", json_prefix + "_iterations_num", result.iterations),
+             StatisticsVariant(prefix + " throughput", json_prefix + "_throughput", result.fps),
+             StatisticsVariant(prefix + " latency", json_prefix + "_latency", result.latency)});
+    }
+}
+}  // namespace
+
+std::vector<ModelSpec> parse_multi_model_string(const std::string& models_string) {
+    std::vector<ModelSpec> models;
+    size_t pos = 0;
+    while (pos < models_string.size()) {
+        auto options_begin = models_string.find_first_of("[,", pos);
+        ModelSpec spec;
+        spec.path = models_string.substr(pos, options_begin - pos);
+        if (options_begin != std::string::npos && models_string[options_begin] == '[') {
+            auto options_end = models_string.find(']', options_begin);
+            if (options_end == std::string::npos) {
+                throw std::logic_error("Can't parse -mm option: missing ']' for model " + spec.path);
+            }
+            auto options = models_string.substr(options_begin + 1, options_end - options_begin - 1);
+            for (const auto& option : split(options, ',')) {
+                auto delim = option.find('=');
+                if (delim == std::string::npos) {
+                    throw std::logic_error("Can't parse -mm option '" + option + "': expected <name>=<value>");
+                }
+                auto name = option.substr(0, delim);
+                auto value = option.substr(delim + 1);
+                if (name == "nireq") {
+                    spec.nireq = static_cast<uint32_t>(std::stoul(value));
+                } else if (name == "rate") {
+                    spec.rate = std::stod(value);
+                } else if (name == "hint") {
+                    parse_hint(value);
+                    spec.hint = value;
+                } else {
+                    throw std::logic_error("Unknown -mm model option '" + name +
+                                           "'. Supported options are nireq, rate and hint.");
+                }
+            }
+            options_begin = options_end + 1;
+        }
+        if (spec.path.empty()) {
+            throw std::logic_error("Can't parse -mm option: empty model path in '" + models_string + "'");
+        }
+        models.push_back(spec);
+        if (options_begin == std::string::npos) {
+            break;
+        }
+        if (options_begin < models_string.size() && models_string[options_begin] != ',') {
+            throw std::logic_error("Can't parse -mm option: models should be separated by commas");
+        }
+        pos = options_begin + 1;
+    }
+    return models;
+}
+
+void run_multi_model_benchmark(ov::Core& core,
+                               const std::vector<ModelSpec>& models,
+                               const MultiModelConfig& config,
+                               const std::shared_ptr<StatisticsReport>& statistics,
+                               const std::function<void(const std::string&)>& next_step) {
+    if (models.empty()) {
+        throw std::logic_error("No models are provided for multi-model benchmarking");
+    }
+
+    next_step(std::to_string(models.size()) + " models");
+    // all models are compiled on the same core, so they share the device executors
+    std::vector<ModelRun> runs(models.size());
+    for (size_t i = 0; i < models.size(); ++i) {
+        runs[i].spec = models[i];
+        runs[i].name = "model " + std::to_string(i);
+        slog::info << "[" << runs[i].name << "] " << models[i].path << slog::endl;
+        prepare_model(core, runs[i], config);
+    }
+
+    next_step(config.measure_isolated ? "isolated and concurrent runs" : "concurrent run");
+    std::vector<RunResult> isolated;
+    if (config.measure_isolated) {
+        slog::info << "Measuring models in isolation" << slog::endl;
+        for (auto& run : runs) {
+            isolated.push_back(run_model(run, config));
+            report_result(run, isolated.back(), "isolated", statistics);
+        }
+    }
+
+    slog::info << "Measuring models concurrently" << slog::endl;
+    auto concurrent = run_concurrently(runs, config);
+
+    double total_fps = 0;
+    double total_retention = 0;
+    for (size_t i = 0; i < runs.size(); ++i) {
+        report_result(runs[i], concurrent[i], "concurrent", statistics);
+        total_fps += concurrent[i].fps;
+        if (isolated.empty()) {
+            continue;
+        }
+
+        // interference: how much worse the model behaves when it shares the device with the others
+        const double slowdown = isolated[i].latency.median_or_percentile > 0
+                                    ? concurrent[i].latency.median_or_percentile / isolated[i].latency.median_or_percentile
+                                    : 0;
+        const double retention = isolated[i].fps > 0 ? concurrent[i].fps / isolated[i].fps : 0;
+        total_retention += retention;
+        slog::info << "[" << runs[i].name << "] Latency slowdown:     " << double_to_string(slowdown) << "x"
+                   << slog::endl;
+        slog::info << "[" << runs[i].name << "] Throughput retention: " << double_to_string(retention * 100) << " %"
+                   << slog::endl;
+        if (statistics) {
+            statistics->add_parameters(
+                StatisticsReport::Category::EXECUTION_RESULTS,
+                {StatisticsVariant(runs[i].name + " latency slowdown",
+                                   "model_" + std::to_string(i) + "_latency_slowdown",
+                                   slowdown),
+                 StatisticsVariant(runs[i].name + " throughput retention",
+                                   "model_" + std::to_string(i) + "_throughput_retention",
+                                   retention)});
+        }
+    }
+
+    slog::info << "Aggregated throughput: " << double_to_string(total_fps) << " FPS" << slog::endl;
+    if (statistics) {
+        statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                   {StatisticsVariant("aggregated throughput", "aggregated_throughput", total_fps)});
+    }
+    if (!isolated.empty()) {
+        // sum of per-model throughput retentions: 1.0 means co-location is as good as time-slicing the device
+        // between the models, values above 1.0 mean that running them side by side pays off
+        slog::info << "Co-location gain:      " << double_to_string(total_retention) << "x" << slog::endl;
+        if (statistics) {
+            statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                       {StatisticsVariant("co-location gain", "colocation_gain", total_retention)});
+        }
+    }
+}
+}  // namespace benchmark_app
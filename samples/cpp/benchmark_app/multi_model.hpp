@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <openvino/openvino.hpp>
+#include <string>
+#include <vector>
+
+// clang-format off
+#include "statistics_report.hpp"
+// clang-format on
+
+namespace benchmark_app {
+/// @brief Description of one model passed via -mm option
+struct ModelSpec {
+    std::string path;
+    uint32_t nireq = 0;
+    /// requests per second, 0 means that requests are submitted as fast as possible
+    double rate = 0;
+    std::string hint;
+};
+
+/// @brief Settings shared by all models in the multi-model run
+struct MultiModelConfig {
+    std::string device_name;
+    uint32_t niter = 0;
+    uint64_t duration_seconds = 0;
+    size_t latency_percentile = 50;
+    bool measure_isolated = true;
+};
+
+/// <summary>
+/// Parses -mm option value: "det.xml[nireq=2,hint=latency,rate=30],cls.xml[nireq=4]"
+/// </summary>
+std::vector<ModelSpec> parse_multi_model_string(const std::string& models_string);
+
+/// <summary>
+/// Compiles all models on the same ov::Core (so they share device executors), runs each of them alone
+/// (optionally) and then all of them concurrently, and reports per-model throughput and latency together
+/// with interference metrics: latency slowdown and throughput retention of the concurrent run
+/// compared to the isolated one. next_step is called when the compilation and the measurement begin.
+/// </summary>
+void run_multi_model_benchmark(ov::Core& core,
+                               const std::vector<ModelSpec>& models,
+                               const MultiModelConfig& config,
+                               const std::shared_ptr<StatisticsReport>& statistics,
+                               const std::function<void(const std::string&)>& next_step);
+}  // namespace benchmark_app
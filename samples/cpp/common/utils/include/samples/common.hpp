@@ -998,6 +998,29 @@ inline std::string getFullDeviceName(ov::Core& core, std::string device) {
     }
 }
 
+/**
+ * @brief Prints hardware performance counters of the node, e.g. reported by CPU with ov::intel_cpu::hardware_counters
+ * @param stream Output stream
+ * @param counters Hardware counters of the node
+ */
+static UNUSED void printHardwareCounters(std::ostream& stream, const std::map<std::string, uint64_t>& counters) {
+    if (counters.empty()) {
+        return;
+    }
+    stream << std::setw(31) << " ";
+    for (const auto& counter : counters) {
+        stream << counter.first << ": " << counter.second << " ";
+    }
+    const auto cycles = counters.find("cycles");
+    const auto instructions = counters.find("instructions");
+    if (cycles != counters.end() && instructions != counters.end() && cycles->second != 0) {
+        std::stringstream ipc;
+        ipc << std::fixed << std::setprecision(2) << static_cast<double>(instructions->second) / cycles->second;
+        stream << "IPC: " << ipc.str();
+    }
+    stream << std::endl;
+}
+
 static UNUSED void printPerformanceCounts(std::vector<ov::ProfilingInfo> performanceData,
                                           std::ostream& stream,
                                           std::string deviceName,
@@ -1034,6 +1057,7 @@ static UNUSED void printPerformanceCounts(std::vector<ov::ProfilingInfo> perform
         stream << std::setw(25) << std::left << "realTime (ms): " + std::to_string(it.real_time.count() / 1000.0) + " ";
         stream << std::setw(25) << std::left << "cpuTime (ms): " + std::to_string(it.cpu_time.count() / 1000.0) + " ";
         stream << std::endl;
+        printHardwareCounters(stream, it.counters);
         if (it.real_time.count() > 0) {
             totalTime += it.real_time;
         }
@@ -1179,6 +1203,7 @@ static UNUSED void printPerformanceCountsNoSort(std::vector<ov::ProfilingInfo> p
             stream << std::setw(20) << std::left << "proportion: " + opt_proportion_str + "%";
 
             stream << std::endl;
+            printHardwareCounters(stream, it.counters);
         }
     }
     stream << std::setw(25) << std::left << "Total time: " + std::to_string(totalTime.count() / 1000.0)
@@ -1252,6 +1277,7 @@ static UNUSED void printPerformanceCountsDescendSort(std::vector<ov::ProfilingIn
             stream << std::setw(20) << std::left << "proportion: " + opt_proportion_str + "%";
 
             stream << std::endl;
+            printHardwareCounters(stream, it.counters);
         }
     }
     stream << std::setw(25) << std::left << "Total time: " + std::to_string(totalTime.count() / 1000.0)
@@ -1312,6 +1338,7 @@ static UNUSED void printPerformanceCountsSimpleSort(std::vector<ov::ProfilingInf
                 stream << std::setw(20) << std::left << "proportion: " + opt_proportion_str + "%";
 
                 stream << std::endl;
+                printHardwareCounters(stream, it.counters);
             }
         }
     }
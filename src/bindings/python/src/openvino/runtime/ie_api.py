@@ -110,10 +110,33 @@ def normalize_inputs(request: InferRequestBase, inputs: dict) -> dict:
     return new_inputs
 
 
+def normalize_batch_inputs(inputs: Any) -> dict:
+    """Helper function to prepare inputs for the batched AsyncInferQueue.
+
+    Every input has to be passed with the first (batch) dimension. The data is copied by the queue,
+    so Tensors are created without a copy here.
+    """
+    if isinstance(inputs, (list, tuple)):
+        inputs = dict(enumerate(inputs))
+    elif not isinstance(inputs, dict):
+        inputs = {0: inputs}
+    new_inputs: Dict[Union[str, int, ConstOutput], Tensor] = {}
+    for key, value in inputs.items():
+        if not isinstance(key, (str, int, ConstOutput)):
+            raise TypeError(f"Incompatible key type for input: {key}")
+        if isinstance(value, Tensor):
+            new_inputs[key] = value
+        elif isinstance(value, np.ndarray) or hasattr(value, "__array__"):
+            new_inputs[key] = Tensor(np.ascontiguousarray(value), shared_memory=True)
+        else:
+            raise TypeError(f"Incompatible input data of type {type(value)} under {key} key!")
+    return new_inputs
+
+
 class InferRequest(InferRequestBase):
     """InferRequest class represents infer request which can be run in asynchronous or synchronous manners."""
 
-    def infer(self, inputs: Any = None) -> dict:
+    def infer(self, inputs: Any = None, share_outputs: bool = False) -> dict:
         """Infers specified input(s) in synchronous mode.
 
         Blocks all methods of InferRequest while request is running.
@@ -137,31 +160,38 @@ class InferRequest(InferRequestBase):
 
         :param inputs: Data to be set on input tensors.
         :type inputs: Any, optional
+        :param share_outputs: If `True`, returned numpy arrays share memory with the output tensors
+                              of the request instead of being copies. The memory is overwritten
+                              by the next inference on this request.
+        :type share_outputs: bool, optional
         :return: Dictionary of results from output tensors with ports as keys.
         :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         """
         # If inputs are empty, pass empty dictionary.
         if inputs is None:
-            return super().infer({})
+            return super().infer({}, share_outputs)
         # If inputs are dict, normalize dictionary and call infer method.
         elif isinstance(inputs, dict):
-            return super().infer(normalize_inputs(self, inputs))
+            return super().infer(normalize_inputs(self, inputs), share_outputs)
         # If inputs are list or tuple, enumarate inputs and save them as dictionary.
         # It is an extension of above branch with dict inputs.
         elif isinstance(inputs, (list, tuple)):
-            return super().infer(normalize_inputs(self, {index: input for index, input in enumerate(inputs)}))
+            return super().infer(
+                normalize_inputs(self, {index: input for index, input in enumerate(inputs)}),
+                share_outputs,
+            )
         # If inputs are Tensor, call infer method directly.
         elif isinstance(inputs, Tensor):
-            return super().infer(inputs)
+            return super().infer(inputs, share_outputs)
         # If inputs are single numpy array or scalars, use helper function to copy them
         # directly to Tensor or create temporary Tensor to pass into the InferRequest.
         # Pass empty dictionary to infer method, inputs are already set by helper function.
         elif isinstance(inputs, (np.ndarray, np.number, int, float)):
             update_tensor(inputs, self)
-            return super().infer({})
+            return super().infer({}, share_outputs)
         elif hasattr(inputs, "__array__"):
             update_tensor(np.array(inputs, copy=True), self)
-            return super().infer({})
+            return super().infer({}, share_outputs)
         else:
             raise TypeError(f"Incompatible inputs of type: {type(inputs)}")
 
@@ -232,7 +262,11 @@ class CompiledModel(CompiledModelBase):
         """
         return InferRequest(super().create_infer_request())
 
-    def infer_new_request(self, inputs: Union[dict, list, tuple, Tensor, np.ndarray] = None) -> dict:
+    def infer_new_request(
+        self,
+        inputs: Union[dict, list, tuple, Tensor, np.ndarray] = None,
+        share_outputs: bool = False,
+    ) -> dict:
         """Infers specified input(s) in synchronous mode.
 
         Blocks all methods of CompiledModel while request is running.
@@ -258,19 +292,22 @@ class CompiledModel(CompiledModelBase):
 
         :param inputs: Data to be set on input tensors.
         :type inputs: Union[Dict[keys, values], List[values], Tuple[values], Tensor, numpy.array], optional
+        :param share_outputs: If `True`, returned numpy arrays share memory with the output tensors
+                              of the temporary InferRequest instead of being copies.
+        :type share_outputs: bool, optional
         :return: Dictionary of results from output tensors with ports as keys.
         :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         """
         # It returns wrapped python InferReqeust and then call upon
         # overloaded functions of InferRequest class
-        return self.create_infer_request().infer(inputs)
+        return self.create_infer_request().infer(inputs, share_outputs)
 
-    def __call__(self, inputs: Optional[Union[dict, list]] = None) -> dict:
+    def __call__(self, inputs: Optional[Union[dict, list]] = None, share_outputs: bool = False) -> dict:
         """Callable infer wrapper for CompiledModel.
 
         Take a look at `infer_new_request` for reference.
         """
-        return self.infer_new_request(inputs)
+        return self.infer_new_request(inputs, share_outputs)
 
 
 class AsyncInferQueue(AsyncInferQueueBase):
@@ -322,12 +359,18 @@ class AsyncInferQueue(AsyncInferQueueBase):
         it will work only with one-input models. When model has more inputs,
         function throws error.
 
+        When the queue is created with `max_batch_size` greater than 1, inputs are
+        coalesced with the inputs of other calls into one batched inference, so all
+        the inputs of the model have to be passed with the first (batch) dimension.
+
         :param inputs: Data to be set on input tensors of the next available InferRequest.
         :type inputs: Any, optional
         :param userdata: Any data that will be passed to a callback.
         :type userdata: Any, optional
         """
-        if inputs is None:
+        if self.max_batch_size > 1:
+            super().start_async(normalize_batch_inputs(inputs), userdata)
+        elif inputs is None:
             super().start_async({}, userdata)
         elif isinstance(inputs, dict):
             super().start_async(
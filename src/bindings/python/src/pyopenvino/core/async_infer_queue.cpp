@@ -7,11 +7,14 @@
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
+#include <algorithm>
 #include <chrono>
 #include <condition_variable>
+#include <cstring>
 #include <mutex>
 #include <queue>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "pyopenvino/core/common.hpp"
@@ -21,10 +24,35 @@ namespace py = pybind11;
 
 class AsyncInferQueue {
 public:
-    AsyncInferQueue(ov::CompiledModel& model, size_t jobs) {
+    // Submission of the batched queue: inputs are copied, so Python objects can be reused right after start_async.
+    struct Submission {
+        std::vector<ov::Tensor> inputs;
+        size_t rows;
+        py::object userdata;
+    };
+
+    AsyncInferQueue(ov::CompiledModel& model, size_t jobs, size_t max_batch_size, size_t batch_timeout)
+        : m_inputs{model.inputs()},
+          m_max_batch_size{max_batch_size > 0 ? max_batch_size : 1},
+          m_batch_timeout{batch_timeout} {
         if (jobs == 0) {
             jobs = static_cast<size_t>(Common::get_optimal_number_of_requests(model));
         }
+        if (is_batched()) {
+            for (auto&& input : m_inputs) {
+                const auto& shape = input.get_partial_shape();
+                if (shape.rank().is_dynamic() || shape.rank().get_length() == 0 || shape[0].is_static()) {
+                    throw ov::Exception("AsyncInferQueue can batch the requests only for the model with the dynamic "
+                                        "first (batch) dimension of all the inputs! Input " +
+                                        input.get_any_name() + " has the shape " + shape.to_string());
+                }
+            }
+            m_pending.reserve(m_max_batch_size);
+            m_batches.resize(jobs);
+            for (auto&& batch : m_batches) {
+                batch.reserve(m_max_batch_size);
+            }
+        }
 
         m_requests.reserve(jobs);
         m_user_ids.reserve(jobs);
@@ -38,12 +66,40 @@ public:
         }
 
         this->set_default_callbacks();
+
+        if (is_batched()) {
+            m_flush_thread = std::thread([this] {
+                flush_pending();
+            });
+        }
     }
 
     ~AsyncInferQueue() {
+        if (m_flush_thread.joinable()) {
+            // release GIL as the running batches need it to finish the callbacks
+            py::gil_scoped_release release;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_flush_cv.notify_all();
+            m_cv.notify_all();
+            m_flush_thread.join();
+            for (auto&& request : m_requests) {
+                try {
+                    request.m_request.wait();
+                } catch (...) {
+                }
+            }
+        }
+        m_pending.clear();
         m_requests.clear();
     }
 
+    bool is_batched() const {
+        return m_max_batch_size > 1;
+    }
+
     bool _is_ready() {
         // Check if any request has finished already
         py::gil_scoped_release release;
@@ -75,6 +131,17 @@ public:
         // Wait for all request to complete
         // release GIL to avoid deadlock on python callback
         py::gil_scoped_release release;
+        if (is_batched()) {
+            // start the incomplete batch and wait until the batches taken by other threads are started
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while (!m_pending.empty()) {
+                dispatch_pending(lock);
+            }
+            m_cv.wait(lock, [this] {
+                return m_dispatching == 0;
+            });
+            rethrow_batch_error();
+        }
         for (auto&& request : m_requests) {
             request.m_request.wait();
         }
@@ -85,6 +152,10 @@ public:
     }
 
     void set_default_callbacks() {
+        if (is_batched()) {
+            set_batched_callbacks(py::function{});
+            return;
+        }
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
             // auto end_time = m_requests[handle].m_end_time; // TODO: pass it bellow? like in InferRequestWrapper
 
@@ -111,6 +182,10 @@ public:
     }
 
     void set_custom_callbacks(py::function f_callback) {
+        if (is_batched()) {
+            set_batched_callbacks(f_callback);
+            return;
+        }
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
             m_requests[handle].m_request.set_callback([this, f_callback, handle](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
@@ -151,6 +226,225 @@ public:
         }
     }
 
+    // Callback of the batched queue is called once per submission with the slices of the batched outputs
+    // which belong to the submission, all the callbacks of the batch are run under a single GIL acquisition.
+    void set_batched_callbacks(py::function f_callback) {
+        for (size_t handle = 0; handle < m_requests.size(); handle++) {
+            m_requests[handle].m_request.set_callback([this, f_callback, handle](std::exception_ptr exception_ptr) {
+                *m_requests[handle].m_end_time = Time::now();
+                {
+                    py::gil_scoped_acquire acquire;
+                    auto& batch = m_batches[handle];
+                    if (exception_ptr == nullptr && f_callback) {
+                        try {
+                            auto results =
+                                Common::outputs_to_dict(m_requests[handle].m_outputs, m_requests[handle].m_request);
+                            size_t offset = 0;
+                            for (auto&& submission : batch) {
+                                py::dict outputs;
+                                for (auto&& result : results) {
+                                    outputs[result.first] =
+                                        result.second[py::slice(static_cast<Py_ssize_t>(offset),
+                                                                static_cast<Py_ssize_t>(offset + submission.rows),
+                                                                1)];
+                                }
+                                offset += submission.rows;
+                                f_callback(outputs, submission.userdata);
+                            }
+                        } catch (const py::error_already_set& py_error) {
+                            assert(py_error.type());
+                            // acquire the mutex to access m_errors
+                            std::lock_guard<std::mutex> lock(m_mutex);
+                            m_errors.push(py_error);
+                        }
+                    }
+                    // userdata has to be released under GIL
+                    batch.clear();
+                }
+
+                {
+                    // acquire the mutex to access m_idle_handles
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    // Add idle handle to queue
+                    m_idle_handles.push(handle);
+                }
+                // Notify both the flushing thread and the submitters waiting for the idle request
+                m_cv.notify_all();
+
+                try {
+                    if (exception_ptr) {
+                        std::rethrow_exception(exception_ptr);
+                    }
+                } catch (const std::exception& e) {
+                    throw ov::Exception(e.what());
+                }
+            });
+        }
+    }
+
+    size_t get_input_index(const py::handle& key) const {
+        if (py::isinstance<ov::Output<const ov::Node>>(key)) {
+            const auto port = key.cast<ov::Output<const ov::Node>>();
+            for (size_t i = 0; i < m_inputs.size(); i++) {
+                if (m_inputs[i] == port)
+                    return i;
+            }
+        } else if (py::isinstance<py::str>(key)) {
+            const auto name = key.cast<std::string>();
+            for (size_t i = 0; i < m_inputs.size(); i++) {
+                if (m_inputs[i].get_names().count(name))
+                    return i;
+            }
+        } else if (py::isinstance<py::int_>(key)) {
+            const auto index = key.cast<size_t>();
+            if (index < m_inputs.size())
+                return index;
+        } else {
+            throw py::type_error("Incompatible key type for tensor named: " + py::str(key).cast<std::string>());
+        }
+        throw ov::Exception("Input " + py::str(key).cast<std::string>() + " is not found in the model!");
+    }
+
+    // Copies the inputs of the submission, every input must have the same number of rows in the first dimension.
+    Submission make_submission(const py::dict& inputs, py::object userdata) const {
+        if (inputs.size() != m_inputs.size()) {
+            throw ov::Exception("Batched AsyncInferQueue requires all " + std::to_string(m_inputs.size()) +
+                                " inputs of the model to be passed, got " + std::to_string(inputs.size()));
+        }
+        Submission submission{std::vector<ov::Tensor>(m_inputs.size()), 0, std::move(userdata)};
+        for (auto&& input : inputs) {
+            const auto index = get_input_index(input.first);
+            const auto& tensor = Common::cast_to_tensor(input.second);
+            const auto& shape = tensor.get_shape();
+            if (shape.empty() || shape[0] == 0) {
+                throw ov::Exception("Input passed to the batched AsyncInferQueue must have non-empty first (batch) "
+                                    "dimension, got the shape " + shape.to_string());
+            }
+            if (tensor.get_element_type() != m_inputs[index].get_element_type()) {
+                throw ov::Exception("Input of " + tensor.get_element_type().get_type_name() +
+                                    " type is passed to the batched AsyncInferQueue instead of " +
+                                    m_inputs[index].get_element_type().get_type_name());
+            }
+            if (submission.rows != 0 && submission.rows != shape[0]) {
+                throw ov::Exception("All the inputs passed to the batched AsyncInferQueue must have the same first "
+                                    "(batch) dimension!");
+            }
+            submission.rows = shape[0];
+            submission.inputs[index] = ov::Tensor(tensor.get_element_type(), shape);
+            std::memcpy(submission.inputs[index].data(), tensor.data(), tensor.get_byte_size());
+        }
+        return submission;
+    }
+
+    static bool can_be_batched(const Submission& lhs, const Submission& rhs) {
+        for (size_t i = 0; i < lhs.inputs.size(); i++) {
+            const auto& lhs_shape = lhs.inputs[i].get_shape();
+            const auto& rhs_shape = rhs.inputs[i].get_shape();
+            if (lhs_shape.size() != rhs_shape.size() || !std::equal(lhs_shape.begin() + 1, lhs_shape.end(), rhs_shape.begin() + 1))
+                return false;
+        }
+        return true;
+    }
+
+    void submit(const py::dict& inputs, py::object userdata) {
+        auto submission = make_submission(inputs, std::move(userdata));
+        // Now GIL can be released - Python objects are only moved in this block
+        py::gil_scoped_release release;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_errors.size() > 0)
+            throw m_errors.front();
+        rethrow_batch_error();
+        // start the pending batch first if the submission doesn't fit into it
+        while (!m_pending.empty() && (m_pending_rows + submission.rows > m_max_batch_size ||
+                                      !can_be_batched(m_pending.front(), submission))) {
+            dispatch_pending(lock);
+        }
+        if (m_pending.empty()) {
+            m_pending_deadline = std::chrono::steady_clock::now() + m_batch_timeout;
+            m_flush_cv.notify_one();
+        }
+        m_pending_rows += submission.rows;
+        m_pending.push_back(std::move(submission));
+        if (m_pending_rows >= m_max_batch_size) {
+            dispatch_pending(lock);
+        }
+    }
+
+    // Starts the pending submissions as one inference on the next idle request, the lock is held on return.
+    void dispatch_pending(std::unique_lock<std::mutex>& lock) {
+        m_cv.wait(lock, [this] {
+            return m_stop || !m_idle_handles.empty();
+        });
+        // another thread could take the pending batch while waiting for the idle request
+        if (m_stop || m_pending.empty())
+            return;
+        const auto handle = m_idle_handles.front();
+        m_idle_handles.pop();
+        auto& batch = m_batches[handle];
+        batch.swap(m_pending);
+        const auto rows = m_pending_rows;
+        m_pending_rows = 0;
+        m_dispatching++;
+        lock.unlock();
+
+        std::exception_ptr exception_ptr;
+        try {
+            auto& request = m_requests[handle].m_request;
+            for (size_t i = 0; i < m_inputs.size(); i++) {
+                auto shape = batch.front().inputs[i].get_shape();
+                shape[0] = rows;
+                auto tensor = request.get_input_tensor(i);
+                tensor.set_shape(shape);
+                auto data = static_cast<uint8_t*>(tensor.data());
+                for (auto&& submission : batch) {
+                    const auto& input = submission.inputs[i];
+                    std::memcpy(data, input.data(), input.get_byte_size());
+                    data += input.get_byte_size();
+                }
+            }
+            *m_requests[handle].m_start_time = Time::now();
+            request.start_async();
+        } catch (...) {
+            exception_ptr = std::current_exception();
+            py::gil_scoped_acquire acquire;
+            batch.clear();
+        }
+
+        lock.lock();
+        if (exception_ptr) {
+            m_batch_error = exception_ptr;
+            m_idle_handles.push(handle);
+        }
+        m_dispatching--;
+        m_cv.notify_all();
+    }
+
+    // Starts the incomplete batch when the batch timeout has expired.
+    void flush_pending() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (!m_stop) {
+            if (m_pending.empty()) {
+                m_flush_cv.wait(lock);
+            } else if (std::chrono::steady_clock::now() < m_pending_deadline) {
+                m_flush_cv.wait_until(lock, m_pending_deadline);
+            } else {
+                dispatch_pending(lock);
+            }
+        }
+    }
+
+    void rethrow_batch_error() {
+        if (m_batch_error) {
+            auto exception_ptr = m_batch_error;
+            m_batch_error = nullptr;
+            try {
+                std::rethrow_exception(exception_ptr);
+            } catch (const std::exception& e) {
+                throw ov::Exception(e.what());
+            }
+        }
+    }
+
     // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
     // all of requests are destroyed as well.
     std::vector<InferRequestWrapper> m_requests;
@@ -159,6 +453,21 @@ public:
     std::mutex m_mutex;
     std::condition_variable m_cv;
     std::queue<py::error_already_set> m_errors;
+
+    std::vector<ov::Output<const ov::Node>> m_inputs;
+    // Micro-batching: submissions are coalesced into one inference of up to m_max_batch_size rows,
+    // the incomplete batch is started by the flushing thread when m_batch_timeout expires.
+    size_t m_max_batch_size;
+    std::chrono::milliseconds m_batch_timeout;
+    std::vector<Submission> m_pending;
+    size_t m_pending_rows = 0;
+    std::chrono::steady_clock::time_point m_pending_deadline;
+    std::vector<std::vector<Submission>> m_batches;  // submissions of the batch started on each request
+    size_t m_dispatching = 0;
+    std::exception_ptr m_batch_error;
+    bool m_stop = false;
+    std::condition_variable m_flush_cv;
+    std::thread m_flush_thread;
 };
 
 void regclass_AsyncInferQueue(py::module m) {
@@ -166,9 +475,11 @@ void regclass_AsyncInferQueue(py::module m) {
     cls.doc() = "openvino.runtime.AsyncInferQueue represents a helper that creates a pool of asynchronous"
                 "InferRequests and provides synchronization functions to control flow of a simple pipeline.";
 
-    cls.def(py::init<ov::CompiledModel&, size_t>(),
+    cls.def(py::init<ov::CompiledModel&, size_t, size_t, size_t>(),
             py::arg("model"),
             py::arg("jobs") = 0,
+            py::arg("max_batch_size") = 1,
+            py::arg("batch_timeout") = 0,
             R"(
                 Creates AsyncInferQueue.
 
@@ -177,6 +488,15 @@ void regclass_AsyncInferQueue(py::module m) {
                 :param jobs: Number of InferRequests objects in a pool. If 0, jobs number
                 will be set automatically to the optimal number. Default: 0
                 :type jobs: int
+                :param max_batch_size: If greater than 1, inputs passed to start_async are not
+                run separately but coalesced along the first (batch) dimension into one inference
+                of up to max_batch_size rows. The model must have dynamic first dimension of all
+                inputs. Callback is called for every start_async call with the dict of outputs
+                sliced to its rows instead of InferRequest. Default: 1
+                :type max_batch_size: int
+                :param batch_timeout: Time in milliseconds to wait for more inputs before running
+                the incomplete batch. Default: 0
+                :type batch_timeout: int
                 :rtype: openvino.runtime.AsyncInferQueue
             )");
 
@@ -184,6 +504,12 @@ void regclass_AsyncInferQueue(py::module m) {
     cls.def(
         "start_async",
         [](AsyncInferQueue& self, const ov::Tensor& inputs, py::object userdata) {
+            if (self.is_batched()) {
+                py::dict batch_inputs;
+                batch_inputs[py::int_(0)] = py::cast(inputs);
+                self.submit(batch_inputs, userdata);
+                return;
+            }
             // getIdleRequestId function has an intention to block InferQueue
             // until there is at least one idle (free to use) InferRequest
             auto handle = self.get_idle_request_id();
@@ -230,6 +556,10 @@ void regclass_AsyncInferQueue(py::module m) {
     cls.def(
         "start_async",
         [](AsyncInferQueue& self, const py::dict& inputs, py::object userdata) {
+            if (self.is_batched()) {
+                self.submit(inputs, userdata);
+                return;
+            }
             // getIdleRequestId function has an intention to block InferQueue
             // until there is at least one idle (free to use) InferRequest
             auto handle = self.get_idle_request_id();
@@ -348,6 +678,16 @@ void regclass_AsyncInferQueue(py::module m) {
         :rtype: openvino.runtime.InferRequest
     )");
 
+    cls.def_property_readonly(
+        "max_batch_size",
+        [](AsyncInferQueue& self) {
+            return self.m_max_batch_size;
+        },
+        R"(
+        :return: Maximal number of rows coalesced into one inference, 1 if batching is disabled.
+        :rtype: int
+    )");
+
     cls.def_property_readonly(
         "userdata",
         [](AsyncInferQueue& self) {
@@ -243,10 +243,19 @@ uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual) {
     }
 }
 
-py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::InferRequest& request) {
+py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs,
+                         ov::InferRequest& request,
+                         bool share_outputs) {
     py::dict res;
     for (const auto& out : outputs) {
         ov::Tensor t{request.get_tensor(out)};
+        // Shared arrays are views on the output memory, the Tensor is their base object and keeps the memory alive.
+        if (share_outputs && Common::ov_type_to_dtype().count(t.get_element_type()) &&
+            t.get_element_type().bitwidth() >= 8) {
+            auto dtype = Common::ov_type_to_dtype().at(t.get_element_type());
+            res[py::cast(out)] = py::array(dtype, t.get_shape(), t.get_strides(), t.data(), py::cast(t));
+            continue;
+        }
         switch (t.get_element_type()) {
         case ov::element::Type_t::i8: {
             res[py::cast(out)] = py::array_t<int8_t>(t.get_shape(), t.data<int8_t>());
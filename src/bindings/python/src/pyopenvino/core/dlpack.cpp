@@ -0,0 +1,230 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pyopenvino/core/dlpack.hpp"
+
+#include <pybind11/stl.h>
+
+#include <vector>
+
+#include "openvino/runtime/allocator.hpp"
+
+namespace {
+
+using namespace DLPack;
+
+const char* const DLTENSOR_NAME = "dltensor";
+const char* const USED_DLTENSOR_NAME = "used_dltensor";
+
+DLDataType to_dl_type(const ov::element::Type& type) {
+    const auto bits = static_cast<uint8_t>(type.bitwidth());
+    switch (type) {
+    case ov::element::Type_t::f16:
+    case ov::element::Type_t::f32:
+    case ov::element::Type_t::f64:
+        return {kDLFloat, bits, 1};
+    case ov::element::Type_t::bf16:
+        return {kDLBfloat, bits, 1};
+    case ov::element::Type_t::i8:
+    case ov::element::Type_t::i16:
+    case ov::element::Type_t::i32:
+    case ov::element::Type_t::i64:
+        return {kDLInt, bits, 1};
+    case ov::element::Type_t::u8:
+    case ov::element::Type_t::u16:
+    case ov::element::Type_t::u32:
+    case ov::element::Type_t::u64:
+        return {kDLUInt, bits, 1};
+    case ov::element::Type_t::boolean:
+        return {kDLBool, bits, 1};
+    default:
+        throw ov::Exception("Tensor of " + type.get_type_name() + " type cannot be exported to DLPack!");
+    }
+}
+
+ov::element::Type from_dl_type(const DLDataType& type) {
+    if (type.lanes == 1) {
+        switch (type.code) {
+        case kDLFloat:
+            if (type.bits == 16)
+                return ov::element::f16;
+            if (type.bits == 32)
+                return ov::element::f32;
+            if (type.bits == 64)
+                return ov::element::f64;
+            break;
+        case kDLBfloat:
+            if (type.bits == 16)
+                return ov::element::bf16;
+            break;
+        case kDLInt:
+            if (type.bits == 8)
+                return ov::element::i8;
+            if (type.bits == 16)
+                return ov::element::i16;
+            if (type.bits == 32)
+                return ov::element::i32;
+            if (type.bits == 64)
+                return ov::element::i64;
+            break;
+        case kDLUInt:
+            if (type.bits == 8)
+                return ov::element::u8;
+            if (type.bits == 16)
+                return ov::element::u16;
+            if (type.bits == 32)
+                return ov::element::u32;
+            if (type.bits == 64)
+                return ov::element::u64;
+            break;
+        case kDLBool:
+            if (type.bits == 8)
+                return ov::element::boolean;
+            break;
+        default:
+            break;
+        }
+    }
+    throw ov::Exception("DLPack data type (code " + std::to_string(type.code) + ", bits " +
+                        std::to_string(type.bits) + ", lanes " + std::to_string(type.lanes) + ") is not supported!");
+}
+
+// Keeps the exported tensor alive until the consumer calls the deleter.
+struct ExportContext {
+    ov::Tensor tensor;
+    std::vector<int64_t> shape;
+    std::vector<int64_t> strides;
+    DLManagedTensor managed;
+};
+
+void delete_export_context(DLManagedTensor* managed) {
+    delete static_cast<ExportContext*>(managed->manager_ctx);
+}
+
+void dltensor_capsule_destructor(PyObject* capsule) {
+    // Capsule consumed by a framework is renamed, the consumer is responsible for calling the deleter then.
+    if (PyCapsule_IsValid(capsule, USED_DLTENSOR_NAME)) {
+        return;
+    }
+    auto managed = static_cast<DLManagedTensor*>(PyCapsule_GetPointer(capsule, DLTENSOR_NAME));
+    if (managed == nullptr) {
+        PyErr_WriteUnraisable(capsule);
+        return;
+    }
+    if (managed->deleter) {
+        managed->deleter(managed);
+    }
+}
+
+// Owns the memory of the imported DLPack tensor: it is "allocated" once by ov::Tensor and the producer's deleter is
+// called when the last copy of the tensor is destroyed.
+class DLPackAllocator : public ov::AllocatorImpl {
+public:
+    DLPackAllocator(DLManagedTensor* managed, void* data, size_t size) : m_managed{managed}, m_data{data}, m_size{size} {}
+
+    ~DLPackAllocator() {
+        if (m_managed->deleter) {
+            m_managed->deleter(m_managed);
+        }
+    }
+
+    void* allocate(const size_t bytes, const size_t) override {
+        OPENVINO_ASSERT(bytes <= m_size, "Tensor created from DLPack cannot be reallocated to the bigger size!");
+        return m_data;
+    }
+
+    void deallocate(void*, const size_t, size_t) override {}
+
+    bool is_equal(const ov::AllocatorImpl& other) const override {
+        return this == &other;
+    }
+
+private:
+    DLManagedTensor* m_managed;
+    void* m_data;
+    size_t m_size;
+};
+
+}  // namespace
+
+namespace Common {
+
+py::capsule tensor_to_dlpack(const ov::Tensor& tensor) {
+    auto context = new ExportContext{tensor, {}, {}, {}};
+    try {
+        const auto& type = tensor.get_element_type();
+        const auto dl_type = to_dl_type(type);
+        for (auto dim : tensor.get_shape()) {
+            context->shape.push_back(static_cast<int64_t>(dim));
+        }
+        for (auto stride : tensor.get_strides()) {
+            context->strides.push_back(static_cast<int64_t>(stride / type.size()));
+        }
+
+        auto& dl_tensor = context->managed.dl_tensor;
+        dl_tensor.data = tensor.data();
+        dl_tensor.device = {kDLCPU, 0};
+        dl_tensor.ndim = static_cast<int32_t>(context->shape.size());
+        dl_tensor.dtype = dl_type;
+        dl_tensor.shape = context->shape.data();
+        dl_tensor.strides = context->strides.data();
+        dl_tensor.byte_offset = 0;
+        context->managed.manager_ctx = context;
+        context->managed.deleter = delete_export_context;
+    } catch (...) {
+        delete context;
+        throw;
+    }
+
+    auto capsule = PyCapsule_New(&context->managed, DLTENSOR_NAME, dltensor_capsule_destructor);
+    if (capsule == nullptr) {
+        delete context;
+        throw py::error_already_set();
+    }
+    return py::reinterpret_steal<py::capsule>(capsule);
+}
+
+ov::Tensor tensor_from_dlpack(const py::object& object) {
+    py::object capsule = object;
+    if (!PyCapsule_CheckExact(object.ptr())) {
+        if (py::hasattr(object, "__dlpack_device__")) {
+            const auto device = object.attr("__dlpack_device__")().cast<std::pair<int32_t, int32_t>>();
+            if (device.first != kDLCPU) {
+                throw ov::Exception("Only CPU tensors can be shared through DLPack!");
+            }
+        }
+        capsule = object.attr("__dlpack__")();
+    }
+
+    auto managed = static_cast<DLManagedTensor*>(PyCapsule_GetPointer(capsule.ptr(), DLTENSOR_NAME));
+    if (managed == nullptr) {
+        PyErr_Clear();
+        throw ov::Exception("DLPack capsule is invalid or has been already consumed!");
+    }
+    const auto& dl_tensor = managed->dl_tensor;
+    if (dl_tensor.device.device_type != kDLCPU) {
+        throw ov::Exception("Only CPU tensors can be shared through DLPack!");
+    }
+
+    const auto type = from_dl_type(dl_tensor.dtype);
+    ov::Shape shape(dl_tensor.shape, dl_tensor.shape + dl_tensor.ndim);
+    // Memory can be shared only if the tensor is dense, strides of dimensions of size 1 don't matter.
+    if (dl_tensor.strides != nullptr) {
+        int64_t expected_stride = 1;
+        for (int32_t i = dl_tensor.ndim - 1; i >= 0; i--) {
+            if (dl_tensor.shape[i] != 1 && dl_tensor.strides[i] != expected_stride) {
+                throw ov::Exception("Tensor with shared memory must be C contiguous!");
+            }
+            expected_stride *= dl_tensor.shape[i];
+        }
+    }
+
+    auto data = static_cast<uint8_t*>(dl_tensor.data) + dl_tensor.byte_offset;
+    auto allocator = std::make_shared<DLPackAllocator>(managed, data, ov::shape_size(shape) * type.size());
+    // The capsule is marked as consumed before the tensor takes the ownership, so the deleter is called once.
+    PyCapsule_SetName(capsule.ptr(), USED_DLTENSOR_NAME);
+    return ov::Tensor(type, shape, ov::Allocator(allocator));
+}
+
+};  // namespace Common
@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <pybind11/pybind11.h>
+
+#include <cstdint>
+
+#include "openvino/runtime/tensor.hpp"
+
+namespace py = pybind11;
+
+// Data structures of the DLPack exchange protocol (ABI version 0.8):
+// https://dmlc.github.io/dlpack/latest/c_api.html
+namespace DLPack {
+
+enum DeviceType : int32_t {
+    kDLCPU = 1,
+};
+
+enum DataTypeCode : uint8_t {
+    kDLInt = 0,
+    kDLUInt = 1,
+    kDLFloat = 2,
+    kDLBfloat = 4,
+    kDLBool = 6,
+};
+
+struct DLDevice {
+    int32_t device_type;
+    int32_t device_id;
+};
+
+struct DLDataType {
+    uint8_t code;
+    uint8_t bits;
+    uint16_t lanes;
+};
+
+struct DLTensor {
+    void* data;
+    DLDevice device;
+    int32_t ndim;
+    DLDataType dtype;
+    int64_t* shape;
+    int64_t* strides;
+    uint64_t byte_offset;
+};
+
+struct DLManagedTensor {
+    DLTensor dl_tensor;
+    void* manager_ctx;
+    void (*deleter)(DLManagedTensor* self);
+};
+
+}  // namespace DLPack
+
+namespace Common {
+
+// Returns "dltensor" capsule sharing memory with the tensor, the tensor is kept alive by the capsule.
+py::capsule tensor_to_dlpack(const ov::Tensor& tensor);
+
+// Creates tensor sharing memory with DLPack capsule or object implementing __dlpack__ method.
+// The memory of the producer is released when the last copy of the tensor is destroyed.
+ov::Tensor tensor_from_dlpack(const py::object& object);
+
+};  // namespace Common
@@ -18,14 +18,25 @@ PYBIND11_MAKE_OPAQUE(Containers::TensorNameMap);
 
 namespace py = pybind11;
 
-inline py::dict run_sync_infer(InferRequestWrapper& self) {
+inline py::dict run_sync_infer(InferRequestWrapper& self, bool share_outputs) {
     {
         py::gil_scoped_release release;
         *self.m_start_time = Time::now();
         self.m_request.infer();
         *self.m_end_time = Time::now();
     }
-    return Common::outputs_to_dict(self.m_outputs, self.m_request);
+    return Common::outputs_to_dict(self.m_outputs, self.m_request, share_outputs);
+}
+
+// The inference writes directly to the array memory, so the memory is shared and must be writeable.
+inline ov::Tensor tensor_from_output_array(py::array& array) {
+    if (!(array.flags() & py::array::c_style)) {
+        throw ov::Exception("Output array must be C contiguous!");
+    }
+    if (!array.writeable()) {
+        throw ov::Exception("Output array must be writeable!");
+    }
+    return Common::tensor_from_numpy(array, true);
 }
 
 void regclass_InferRequest(py::module m) {
@@ -105,6 +116,7 @@ void regclass_InferRequest(py::module m) {
             auto outputs_map = Common::cast_to_tensor_index_map(outputs);
             for (auto&& output : outputs_map) {
                 self.m_request.set_output_tensor(output.first, output.second);
+                self.m_output_arrays.erase(output.first);
             }
         },
         py::arg("outputs"),
@@ -171,11 +183,12 @@ void regclass_InferRequest(py::module m) {
     // Overload for single input, it will throw error if a model has more than one input.
     cls.def(
         "infer",
-        [](InferRequestWrapper& self, const ov::Tensor& inputs) {
+        [](InferRequestWrapper& self, const ov::Tensor& inputs, bool share_outputs) {
             self.m_request.set_input_tensor(inputs);
-            return run_sync_infer(self);
+            return run_sync_infer(self, share_outputs);
         },
         py::arg("inputs"),
+        py::arg("share_outputs") = false,
         R"(
             Infers specified input(s) in synchronous mode.
             Blocks all methods of InferRequest while request is running.
@@ -185,6 +198,9 @@ void regclass_InferRequest(py::module m) {
 
             :param inputs: Data to set on single input tensor.
             :type inputs: openvino.runtime.Tensor
+            :param share_outputs: If `True`, results are numpy arrays sharing memory with output tensors
+                                  instead of copies. The memory is overwritten by the next inference.
+            :type share_outputs: bool
             :return: Dictionary of results from output tensors with ports as keys.
             :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         )");
@@ -197,13 +213,14 @@ void regclass_InferRequest(py::module m) {
     // and values are always of type: ov::Tensor.
     cls.def(
         "infer",
-        [](InferRequestWrapper& self, const py::dict& inputs) {
+        [](InferRequestWrapper& self, const py::dict& inputs, bool share_outputs) {
             // Update inputs if there are any
             Common::set_request_tensors(self.m_request, inputs);
             // Call Infer function
-            return run_sync_infer(self);
+            return run_sync_infer(self, share_outputs);
         },
         py::arg("inputs"),
+        py::arg("share_outputs") = false,
         R"(
             Infers specified input(s) in synchronous mode.
             Blocks all methods of InferRequest while request is running.
@@ -213,6 +230,9 @@ void regclass_InferRequest(py::module m) {
 
             :param inputs: Data to set on input tensors.
             :type inputs: Dict[Union[int, str, openvino.runtime.ConstOutput], openvino.runtime.Tensor]
+            :param share_outputs: If `True`, results are numpy arrays sharing memory with output tensors
+                                  instead of copies. The memory is overwritten by the next inference.
+            :type share_outputs: bool
             :return: Dictionary of results from output tensors with ports as keys.
             :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         )");
@@ -554,6 +574,7 @@ void regclass_InferRequest(py::module m) {
         "set_output_tensor",
         [](InferRequestWrapper& self, size_t idx, const ov::Tensor& tensor) {
             self.m_request.set_output_tensor(idx, tensor);
+            self.m_output_arrays.erase(idx);
         },
         py::arg("index"),
         py::arg("tensor"),
@@ -571,6 +592,7 @@ void regclass_InferRequest(py::module m) {
         "set_output_tensor",
         [](InferRequestWrapper& self, const ov::Tensor& tensor) {
             self.m_request.set_output_tensor(tensor);
+            self.m_output_arrays.erase(0);
         },
         py::arg("tensor"),
         R"(
@@ -582,6 +604,46 @@ void regclass_InferRequest(py::module m) {
             :type tensor: openvino.runtime.Tensor
         )");
 
+    // Python API exclusive function
+    cls.def(
+        "set_output_tensor",
+        [](InferRequestWrapper& self, size_t idx, py::array& array) {
+            self.m_request.set_output_tensor(idx, tensor_from_output_array(array));
+            self.m_output_arrays[idx] = array;
+        },
+        py::arg("index"),
+        py::arg("array"),
+        R"(
+            Sets user allocated numpy array as output tensor of InferRequest.
+            Results of the inference are written directly to the array memory.
+            The array is kept alive until the output tensor is replaced.
+
+            :param idx: Index of output tensor.
+            :type idx: int
+            :param array: C_CONTIGUOUS writeable numpy array. The dtype and shape of the array
+                          must match the model's output element_type and shape.
+            :type array: numpy.array
+        )");
+
+    // Python API exclusive function
+    cls.def(
+        "set_output_tensor",
+        [](InferRequestWrapper& self, py::array& array) {
+            self.m_request.set_output_tensor(tensor_from_output_array(array));
+            self.m_output_arrays[0] = array;
+        },
+        py::arg("array"),
+        R"(
+            Sets user allocated numpy array as output tensor of InferRequest with single output.
+            Results of the inference are written directly to the array memory.
+            The array is kept alive until the output tensor is replaced.
+            If model has several outputs, an exception is thrown.
+
+            :param array: C_CONTIGUOUS writeable numpy array. The dtype and shape of the array
+                          must match the model's output element_type and shape.
+            :type array: numpy.array
+        )");
+
     cls.def(
         "get_profiling_info",
         [](InferRequestWrapper& self) {
@@ -719,6 +781,23 @@ void regclass_InferRequest(py::module m) {
             :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         )");
 
+    cls.def(
+        "get_results",
+        [](InferRequestWrapper& self, bool share_outputs) {
+            return Common::outputs_to_dict(self.m_outputs, self.m_request, share_outputs);
+        },
+        py::arg("share_outputs") = false,
+        R"(
+            Gets all outputs tensors of this InferRequest.
+
+            :param share_outputs: If `True`, results are numpy arrays sharing memory with output tensors
+                                  instead of copies. The memory is overwritten by the next inference,
+                                  e.g. when the request is reused by AsyncInferQueue.
+            :type share_outputs: bool
+            :return: Dictionary of results from output tensors with ports as keys.
+            :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
+        )");
+
     cls.def("__repr__", [](const InferRequestWrapper& self) {
         auto inputs_str = Common::docs::container_to_string(self.m_inputs, ",\n");
         auto outputs_str = Common::docs::container_to_string(self.m_outputs, ",\n");
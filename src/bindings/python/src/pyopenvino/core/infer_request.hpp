@@ -5,7 +5,9 @@
 #pragma once
 
 #include <chrono>
+#include <map>
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
 #include <openvino/runtime/infer_request.hpp>
@@ -83,6 +85,8 @@ public:
     bool m_user_callback_defined = false;
     // Data that is passed by user from Python->C++
     py::object m_userdata;
+    // Numpy arrays set as output tensors by their indexes, each is kept alive until replaced
+    std::map<size_t, py::array> m_output_arrays;
     // Times of inference's start and finish
     std::shared_ptr<Time::time_point> m_start_time; // proposal: change to unique_ptr
     std::shared_ptr<Time::time_point> m_end_time;
@@ -5,6 +5,7 @@
 #include "pyopenvino/core/profiling_info.hpp"
 
 #include <pybind11/chrono.h>
+#include <pybind11/stl.h>
 
 #include "openvino/runtime/profiling_info.hpp"
 
@@ -20,7 +21,8 @@ void regclass_ProfilingInfo(py::module m) {
         .def_readwrite("cpu_time", &ov::ProfilingInfo::cpu_time)
         .def_readwrite("node_name", &ov::ProfilingInfo::node_name)
         .def_readwrite("exec_type", &ov::ProfilingInfo::exec_type)
-        .def_readwrite("node_type", &ov::ProfilingInfo::node_type);
+        .def_readwrite("node_type", &ov::ProfilingInfo::node_type)
+        .def_readwrite("counters", &ov::ProfilingInfo::counters);
 
     py::enum_<ov::ProfilingInfo::Status>(cls, "Status")
         .value("NOT_RUN", ov::ProfilingInfo::Status::NOT_RUN)
@@ -9,11 +9,22 @@
 
 #include "openvino/runtime/tensor.hpp"
 #include "pyopenvino/core/common.hpp"
+#include "pyopenvino/core/dlpack.hpp"
 
 namespace py = pybind11;
 
+namespace {
+// numpy has no bfloat16, so bf16 memory is shared as raw uint16 values instead of being reinterpreted as float16
+py::dtype get_shared_dtype(const ov::element::Type& ov_type) {
+    if (ov_type == ov::element::bf16) {
+        return py::dtype("uint16");
+    }
+    return Common::ov_type_to_dtype().at(ov_type);
+}
+}  // namespace
+
 void regclass_Tensor(py::module m) {
-    py::class_<ov::Tensor, std::shared_ptr<ov::Tensor>> cls(m, "Tensor");
+    py::class_<ov::Tensor, std::shared_ptr<ov::Tensor>> cls(m, "Tensor", py::buffer_protocol());
     cls.doc() = "openvino.runtime.Tensor holding either copy of memory or shared host memory.";
 
     cls.def(py::init([](py::array& array, bool shared_memory) {
@@ -224,6 +235,87 @@ void regclass_Tensor(py::module m) {
             :rtype: numpy.array
         )");
 
+    cls.def_buffer([](ov::Tensor& self) {
+        auto ov_type = self.get_element_type();
+        auto dtype = get_shared_dtype(ov_type);
+        auto format = py::str(dtype.attr("char")).cast<std::string>();
+        if (ov_type.bitwidth() < 8) {
+            return py::buffer_info(self.data(), 1, format, 1, {self.get_byte_size()}, {1});
+        }
+        return py::buffer_info(self.data(),
+                               ov_type.size(),
+                               format,
+                               self.get_shape().size(),
+                               self.get_shape(),
+                               self.get_strides());
+    });
+
+    cls.def_property_readonly(
+        "__array_interface__",
+        [](ov::Tensor& self) {
+            auto ov_type = self.get_element_type();
+            auto dtype = get_shared_dtype(ov_type);
+            py::dict interface;
+            if (ov_type.bitwidth() < 8) {
+                interface["shape"] = py::make_tuple(self.get_byte_size());
+                interface["strides"] = py::none();
+            } else {
+                interface["shape"] = py::tuple(py::cast(self.get_shape()));
+                interface["strides"] = py::tuple(py::cast(self.get_strides()));
+            }
+            interface["typestr"] = dtype.attr("str");
+            interface["data"] = py::make_tuple(reinterpret_cast<uintptr_t>(self.data()), false);
+            interface["version"] = 3;
+            return interface;
+        },
+        R"(
+            Numpy array interface sharing Tensor's memory, e.g. `numpy.asarray(tensor)` doesn't copy the data.
+            Element types are mapped as in `data` property, except bf16 which is shared as uint16 values.
+
+            :rtype: dict
+        )");
+
+    cls.def(
+        "__dlpack__",
+        [](ov::Tensor& self, py::object& stream) {
+            if (!stream.is_none()) {
+                throw ov::Exception("Tensor doesn't support DLPack stream, it must be None!");
+            }
+            return Common::tensor_to_dlpack(self);
+        },
+        py::arg("stream") = py::none(),
+        R"(
+            Exports Tensor as DLPack capsule sharing Tensor's memory.
+            The Tensor is kept alive until the consumer releases the capsule.
+
+            :param stream: Must be None for CPU tensors.
+            :type stream: None
+            :rtype: PyCapsule
+        )");
+
+    cls.def(
+        "__dlpack_device__",
+        [](ov::Tensor& self) {
+            return py::make_tuple(static_cast<int>(DLPack::kDLCPU), 0);
+        },
+        R"(
+            Gets DLPack device of Tensor's memory.
+
+            :rtype: Tuple[int, int]
+        )");
+
+    cls.def_static("from_dlpack",
+                   &Common::tensor_from_dlpack,
+                   py::arg("tensor"),
+                   R"(
+            Creates Tensor sharing memory with a DLPack producer, e.g. torch.Tensor.
+            The producer's memory is kept alive as long as the Tensor.
+
+            :param tensor: C contiguous CPU tensor implementing `__dlpack__` method or DLPack capsule.
+            :type tensor: Any
+            :rtype: openvino.runtime.Tensor
+        )");
+
     cls.def("get_shape",
             &ov::Tensor::get_shape,
             R"(
@@ -4,8 +4,10 @@
 
 from collections.abc import Iterable
 from copy import deepcopy
+from fractions import Fraction
 import numpy as np
 import os
+import sys
 import pytest
 import datetime
 import time
@@ -103,6 +105,7 @@ def test_get_profiling_info(device):
     assert isinstance(soft_max_node.real_time, datetime.timedelta)
     assert isinstance(soft_max_node.cpu_time, datetime.timedelta)
     assert isinstance(soft_max_node.exec_type, str)
+    assert isinstance(soft_max_node.counters, dict)
 
 
 def test_tensor_setter(device):
@@ -623,6 +626,52 @@ def test_infer_queue_get_idle_handle(device):
     queue.wait_all()
 
 
+@pytest.mark.parametrize("batch_timeout", [0, 5])
+def test_infer_queue_batching(device, batch_timeout):
+    jobs = 20
+    param = ops.parameter(PartialShape([-1, 3]), np.float32, name="data")
+    # every row of the second output holds the number of rows of the whole inference
+    batch_rows = ops.gather(ops.shape_of(param), [0], 0)
+    batch_rows = ops.broadcast(ops.convert(batch_rows, np.float32), ops.shape_of(param))
+    model = Model([ops.relu(param), batch_rows], [param])
+    core = Core()
+    compiled_model = core.compile_model(model, device)
+    queue = AsyncInferQueue(compiled_model, 2, max_batch_size=4, batch_timeout=batch_timeout)
+    assert queue.max_batch_size == 4
+    results = {}
+    inferences = []
+
+    def callback(outputs, job_id):
+        results[job_id] = outputs[compiled_model.outputs[0]].copy()
+        rows = outputs[compiled_model.outputs[1]]
+        # the submission takes its share of the inference it was batched into
+        inferences.append(Fraction(len(rows), int(rows[0][0])))
+
+    queue.set_callback(callback)
+    for i in range(jobs):
+        rows = i % 2 + 1
+        queue.start_async({"data": np.full((rows, 3), i - 10, dtype=np.float32)}, i)
+    queue.wait_all()
+
+    assert len(results) == jobs
+    for i in range(jobs):
+        assert np.array_equal(results[i], np.full((i % 2 + 1, 3), max(i - 10, 0), dtype=np.float32))
+    assert sum(inferences) <= jobs
+    if batch_timeout > 0:
+        # the submissions arriving within the timeout are coalesced
+        assert sum(inferences) < jobs
+
+
+def test_infer_queue_batching_static_model(device):
+    param = ops.parameter([1, 3], np.float32)
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled_model = core.compile_model(model, device)
+    with pytest.raises(RuntimeError) as e:
+        AsyncInferQueue(compiled_model, 1, max_batch_size=4)
+    assert "dynamic first (batch) dimension" in str(e.value)
+
+
 @pytest.mark.parametrize("data_type",
                          [np.float32,
                           np.int32,
@@ -689,6 +738,60 @@ def test_get_results(device):
         assert np.array_equal(results[output], request.results[output])
 
 
+def test_infer_share_outputs(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+    results = request.infer({0: arr_1, 1: arr_2}, share_outputs=True)
+    output_tensor = request.get_output_tensor()
+    result = results[request.model_outputs[0]]
+    assert np.array_equal(result, arr_1 + arr_2)
+    assert np.shares_memory(result, output_tensor.data)
+    assert not np.shares_memory(request.get_results()[request.model_outputs[0]], output_tensor.data)
+
+    # Shared results are overwritten by the next inference.
+    request.infer({0: arr_2, 1: arr_2}, share_outputs=True)
+    assert np.array_equal(result, arr_2 + arr_2)
+
+    # Shared results keep the output memory alive.
+    results = request.get_results(share_outputs=True)
+    del request
+    assert np.array_equal(results[list(results)[0]], arr_2 + arr_2)
+
+
+def test_set_output_array(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+    output = np.zeros([2, 2], dtype=np.float32)
+    request.set_output_tensor(0, output)
+    request.infer({0: arr_1, 1: arr_2})
+    assert np.array_equal(output, arr_1 + arr_2)
+    assert np.shares_memory(request.get_output_tensor().data, output)
+
+    output = np.zeros([2, 2], dtype=np.float32)
+    request.set_output_tensor(output)
+    request.infer({0: arr_1, 1: arr_1})
+    assert np.array_equal(output, arr_1 + arr_1)
+
+    # Only the array set last is kept alive by the request.
+    refcount = sys.getrefcount(output)
+    for _ in range(3):
+        request.set_output_tensor(0, output)
+    assert sys.getrefcount(output) == refcount
+    request.set_output_tensor(Tensor(np.zeros([2, 2], dtype=np.float32)))
+    assert sys.getrefcount(output) == refcount - 1
+
+
+def test_set_output_array_incorrect(device):
+    request, _, _ = create_simple_request_and_inputs(device)
+    with pytest.raises(RuntimeError) as e:
+        request.set_output_tensor(0, np.zeros([2, 4], dtype=np.float32)[:, ::2])
+    assert "Output array must be C contiguous!" in str(e.value)
+
+    output = np.zeros([2, 2], dtype=np.float32)
+    output.flags.writeable = False
+    with pytest.raises(RuntimeError) as e:
+        request.set_output_tensor(output)
+    assert "Output array must be writeable!" in str(e.value)
+
+
 def test_results_async_infer(device):
     jobs = 8
     num_request = 4
@@ -372,3 +372,70 @@ def test_viewed_tensor_default_type():
     new_shape = (4, 8)
     tensor = Tensor(buffer, new_shape)
     assert np.array_equal(tensor.data, buffer.reshape(new_shape))
+
+
+def test_array_interface_and_buffer_share_memory():
+    tensor = Tensor(np.arange(12, dtype=np.float32).reshape(3, 4))
+    array = np.asarray(tensor)
+    assert array.shape == (3, 4)
+    assert array.dtype == np.float32
+    assert np.shares_memory(array, tensor.data)
+
+    view = memoryview(tensor)
+    assert view.shape == (3, 4)
+    assert view.strides == tuple(tensor.strides)
+    array[1, 1] = 42
+    assert view[1, 1] == 42
+
+
+def test_array_interface_and_buffer_share_bf16_as_uint16():
+    values = np.array([[1.0, -2.5], [0.15625, 65536.0]], dtype=np.float32)
+    bf16_values = (values.view(np.uint32) >> 16).astype(np.uint16)
+    tensor = Tensor(ov.Type.bf16, ov.Shape([2, 2]))
+    array = np.asarray(tensor)
+    assert array.dtype == np.uint16
+    array[:] = bf16_values
+
+    view = memoryview(tensor)
+    assert view.format == "H"
+    assert view.itemsize == 2
+    round_trip = (np.asarray(view).astype(np.uint32) << 16).view(np.float32)
+    assert np.array_equal(round_trip, values)
+    assert np.array_equal(np.asarray(Tensor.from_dlpack(tensor)), bf16_values)
+
+
+@pytest.mark.parametrize("dtype", [np.float32, np.float16, np.int64, np.uint8, bool])
+def test_dlpack_round_trip(dtype):
+    tensor = Tensor(np.ones((2, 3), dtype=dtype))
+    assert tensor.__dlpack_device__() == (1, 0)
+
+    shared = Tensor.from_dlpack(tensor)
+    assert shared.element_type == tensor.element_type
+    assert shared.shape == tensor.shape
+    assert np.shares_memory(shared.data, tensor.data)
+
+    # The memory of the producer is kept alive by the new tensor.
+    del tensor
+    assert np.array_equal(shared.data, np.ones((2, 3), dtype=dtype))
+
+
+def test_dlpack_capsule_can_be_consumed_once():
+    capsule = Tensor(np.ones((2, 3), dtype=np.float32)).__dlpack__()
+    Tensor.from_dlpack(capsule)
+    with pytest.raises(RuntimeError) as e:
+        Tensor.from_dlpack(capsule)
+    assert "already consumed" in str(e.value)
+
+
+@pytest.mark.skipif(not hasattr(np, "from_dlpack"), reason="numpy doesn't support DLPack")
+def test_dlpack_numpy_exchange():
+    array = np.arange(6, dtype=np.float32).reshape(2, 3)
+    tensor = Tensor.from_dlpack(array)
+    assert np.shares_memory(tensor.data, array)
+
+    array_from_tensor = np.from_dlpack(tensor)
+    assert np.shares_memory(array_from_tensor, array)
+
+    with pytest.raises(RuntimeError) as e:
+        Tensor.from_dlpack(array.T)
+    assert "C contiguous" in str(e.value)
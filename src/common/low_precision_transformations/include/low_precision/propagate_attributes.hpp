@@ -0,0 +1,40 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <ngraph/pass/pass.hpp>
+#include <low_precision/lpt_visibility.hpp>
+#include "low_precision/rt_info/attribute_parameters.hpp"
+
+namespace ngraph {
+namespace pass {
+namespace low_precision {
+
+class LP_TRANSFORMATIONS_API PropagateAttributes;
+
+}  // namespace low_precision
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief PropagateAttributes transformation is an equivalent of PropagatePrecisions, AlignQuantizationIntervals and
+ * AlignQuantizationParameters transformations sequence which shares one topological sort between them and visits only
+ * operations which are reachable from FakeQuantize operations through attributed or dequantization operations.
+ *
+ * The stage of the transformation is skipped if the corresponding original transformation is disabled in pass config.
+ */
+class ngraph::pass::low_precision::PropagateAttributes : public ngraph::pass::FunctionPass {
+public:
+    OPENVINO_RTTI("PropagateAttributes", "0");
+    PropagateAttributes(const AttributeParameters& params = AttributeParameters(), const bool alignQuantization = true);
+    bool run_on_model(const std::shared_ptr<ngraph::Function>& m) override;
+
+private:
+    const AttributeParameters params;
+    const bool alignQuantization;
+};
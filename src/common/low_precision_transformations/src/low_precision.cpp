@@ -25,6 +25,7 @@
 #include "low_precision/markup_avg_pool_precision_preserved.hpp"
 #include <low_precision/markup_quantization_granularity.hpp>
 #include "low_precision/propagate_precisions.hpp"
+#include "low_precision/propagate_attributes.hpp"
 #include "low_precision/align_quantization_parameters.hpp"
 
 #include "transformations/common_optimizations/lin_op_sequence_fusion.hpp"
@@ -181,11 +182,7 @@ bool ngraph::pass::low_precision::MarkupOptimizations::run_on_model(const std::s
     if (ngraph::op::util::has_op_with_type<ngraph::opset1::AvgPool>(f)) {
         markup.register_pass<low_precision::MarkupAvgPoolPrecisionPreserved>(params.defaultPrecisions);
     }
-    markup.register_pass<low_precision::PropagatePrecisions>(params);
-    if (ngraph::op::util::has_op_with_type<ngraph::opset1::Concat>(f)) {
-        markup.register_pass<low_precision::AlignQuantizationIntervals>(params.defaultPrecisions);
-        markup.register_pass<low_precision::AlignQuantizationParameters>(params.defaultPrecisions);
-    }
+    markup.register_pass<low_precision::PropagateAttributes>(params, ngraph::op::util::has_op_with_type<ngraph::opset1::Concat>(f));
     markup.run_passes(f);
     return false;
 }
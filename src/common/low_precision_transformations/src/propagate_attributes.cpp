@@ -0,0 +1,122 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "low_precision/propagate_attributes.hpp"
+
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/op/util/multi_subgraph_base.hpp>
+#include "low_precision/align_quantization_intervals.hpp"
+#include "low_precision/align_quantization_parameters.hpp"
+#include "low_precision/create_attribute.hpp"
+#include "low_precision/propagate_precisions.hpp"
+#include "low_precision/propagate_through_precision_preserved.hpp"
+#include "low_precision/propagate_to_input.hpp"
+#include "low_precision/update_shared_precision_preserved.hpp"
+#include "low_precision/rt_info/intervals_alignment_attribute.hpp"
+#include "low_precision/rt_info/precisions_attribute.hpp"
+#include "low_precision/rt_info/quantization_alignment_attribute.hpp"
+#include "low_precision/rt_info/quantization_granularity_attribute.hpp"
+#include "itt.hpp"
+
+using namespace ngraph;
+using namespace ngraph::pass::low_precision;
+
+namespace {
+
+// Matchers of one original propagation transformation in the registration order and the attribute they propagate.
+struct Stage {
+    ov::DiscreteTypeInfo attribute;
+    std::vector<std::shared_ptr<ngraph::pass::MatcherPass>> matchers;
+};
+
+bool hasAttribute(const Node* node, const ov::DiscreteTypeInfo& attribute) {
+    if (node->get_rt_info().count(attribute)) {
+        return true;
+    }
+    for (const auto& output : node->outputs()) {
+        if (output.get_rt_info().count(attribute)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Attribute is taken from the parent FakeQuantize through dequantization operations, consumers of them have to be visited.
+bool isDequantizationOperation(const Node* node) {
+    return ov::is_type<opset1::Convert>(node) || ov::is_type<opset1::Subtract>(node) || ov::is_type<opset1::Multiply>(node);
+}
+
+// Applies the stage matchers like GraphRewrite does: in topological order, the first matcher which returns true
+// finishes the node processing. Matchers read the attribute from the parent operations only, so the operation can't
+// be changed until one of its parents is FakeQuantize, has the attribute or is reached dequantization operation.
+void runStage(const std::shared_ptr<ngraph::Function>& f, const Stage& stage) {
+    std::unordered_set<const Node*> reached;
+    for (const auto& node : f->get_ordered_ops()) {
+        if (const auto subGraph = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
+            if (subGraph->get_transformations_allowed()) {
+                for (size_t index = 0; index < subGraph->get_internal_subgraphs_size(); ++index) {
+                    runStage(subGraph->get_function(static_cast<int>(index)), stage);
+                }
+            }
+        }
+
+        const bool isFakeQuantize = ov::is_type<opset1::FakeQuantize>(node);
+        if (!isFakeQuantize && (reached.count(node.get()) == 0) && !hasAttribute(node.get(), stage.attribute)) {
+            continue;
+        }
+
+        for (const auto& matcher : stage.matchers) {
+            if (matcher->apply(node)) {
+                break;
+            }
+        }
+
+        if (isFakeQuantize || isDequantizationOperation(node.get()) || hasAttribute(node.get(), stage.attribute)) {
+            for (const auto& output : node->outputs()) {
+                for (const auto& input : output.get_target_inputs()) {
+                    reached.insert(input.get_node());
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
+ngraph::pass::low_precision::PropagateAttributes::PropagateAttributes(const AttributeParameters& params, const bool alignQuantization) :
+    params(params),
+    alignQuantization(alignQuantization) {}
+
+bool ngraph::pass::low_precision::PropagateAttributes::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
+    RUN_ON_FUNCTION_SCOPE(PropagateAttributes);
+    // matchers keep references to the constructor arguments: params member has to be used
+    std::vector<Stage> stages;
+    if (!get_pass_config()->is_disabled<PropagatePrecisions>()) {
+        stages.push_back({ PrecisionsAttribute::get_type_info_static(), {
+            std::make_shared<CreateAttribute<PrecisionsAttribute, opset1::FakeQuantize>>(params, AttributeSource::OutputPort),
+            std::make_shared<PropagateThroughPrecisionPreserved<PrecisionsAttribute>>(params.defaultPrecisions),
+            std::make_shared<PropagateToInput<PrecisionsAttribute>>(params.defaultPrecisions) } });
+    }
+    if (alignQuantization && !get_pass_config()->is_disabled<AlignQuantizationIntervals>()) {
+        stages.push_back({ IntervalsAlignmentAttribute::get_type_info_static(), {
+            std::make_shared<CreateAttribute<IntervalsAlignmentAttribute, opset1::FakeQuantize>>(
+                AttributeParameters(ngraph::element::f32, params.defaultPrecisions)),
+            std::make_shared<PropagateThroughPrecisionPreserved<IntervalsAlignmentAttribute>>(params.defaultPrecisions) } });
+    }
+    if (alignQuantization && !get_pass_config()->is_disabled<AlignQuantizationParameters>()) {
+        stages.push_back({ QuantizationAlignmentAttribute::get_type_info_static(), {
+            std::make_shared<CreateAttribute<QuantizationAlignmentAttribute>>(),
+            std::make_shared<PropagateThroughPrecisionPreserved<QuantizationAlignmentAttribute>>(),
+            std::make_shared<UpdateSharedPrecisionPreserved<QuantizationAlignmentAttribute, QuantizationGranularityAttribute>>() } });
+    }
+
+    for (const auto& stage : stages) {
+        runStage(f, stage);
+    }
+    return false;
+}
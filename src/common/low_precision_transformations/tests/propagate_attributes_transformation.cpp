@@ -0,0 +1,187 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include <low_precision/align_quantization_intervals.hpp>
+#include <low_precision/align_quantization_parameters.hpp>
+#include <low_precision/markup_can_be_quantized.hpp>
+#include <low_precision/markup_precisions.hpp>
+#include <low_precision/markup_quantization_granularity.hpp>
+#include <low_precision/propagate_attributes.hpp>
+#include <low_precision/propagate_precisions.hpp>
+#include <low_precision/rt_info/intervals_alignment_attribute.hpp>
+#include <low_precision/rt_info/precisions_attribute.hpp>
+#include <low_precision/rt_info/quantization_alignment_attribute.hpp>
+
+#include "lpt_ngraph_functions/common/builders.hpp"
+#include "lpt_ngraph_functions/common/fake_quantize_on_data.hpp"
+
+using namespace testing;
+using namespace ngraph;
+using namespace ngraph::pass::low_precision;
+
+namespace {
+
+// Each block: two FakeQuantize operations with different intervals -> Concat (the second one through MaxPool) ->
+// Convolution with quantized weights.
+std::shared_ptr<ngraph::Function> createFunction(const size_t blocks) {
+    const size_t channels = 4ul;
+    const auto input = std::make_shared<opset1::Parameter>(element::f32, Shape{ 1, channels, 8, 8 });
+    std::shared_ptr<Node> parent = input;
+    for (size_t i = 0; i < blocks; ++i) {
+        const float high = 2.55f * static_cast<float>(i % 4 + 1);
+        const auto fq1 = ngraph::builder::subgraph::makeFakeQuantize(
+            parent, element::f32, ngraph::builder::subgraph::FakeQuantizeOnData(256ul, {}, { 0.f }, { high }, { 0.f }, { high }));
+        const auto fq2 = ngraph::builder::subgraph::makeFakeQuantize(
+            parent, element::f32, ngraph::builder::subgraph::FakeQuantizeOnData(256ul, {}, { -1.28f }, { 1.27f }, { -1.28f }, { 1.27f }));
+        const auto maxPool = std::make_shared<opset1::MaxPool>(fq2, Strides{ 1, 1 }, Shape{ 0, 0 }, Shape{ 0, 0 }, Shape{ 1, 1 });
+        const auto concat = std::make_shared<opset1::Concat>(OutputVector{ fq1, maxPool }, 1);
+
+        const auto weights = opset1::Constant::create(element::f32, Shape{ channels, 2 * channels, 1, 1 }, std::vector<float>{ 1.f });
+        const auto weightsFq = ngraph::builder::subgraph::makeFakeQuantize(
+            weights, element::f32, ngraph::builder::subgraph::FakeQuantizeOnData(255ul, {}, { -1.27f }, { 1.27f }, { -1.27f }, { 1.27f }));
+        parent = std::make_shared<opset1::Convolution>(
+            concat, weightsFq, Strides{ 1, 1 }, CoordinateDiff{ 0, 0 }, CoordinateDiff{ 0, 0 }, Strides{ 1, 1 });
+    }
+
+    const auto result = std::make_shared<opset1::Result>(parent);
+    return std::make_shared<ngraph::Function>(ResultVector{ result }, ParameterVector{ input }, "PropagateAttributesFunction");
+}
+
+void markup(const std::shared_ptr<ngraph::Function>& function) {
+    const auto precisionRestrictions = std::vector<PrecisionsRestriction>({
+        PrecisionsRestriction::create<opset1::Convolution>({
+            {{0}, {element::u8}},
+            {{1}, {element::i8}}
+        })
+    });
+    const auto quantizationRestrictions = std::vector<QuantizationGranularityRestriction>({
+        QuantizationGranularityRestriction::create<opset1::Convolution>({0})
+    });
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<MarkupCanBeQuantized>();
+    manager.register_pass<MarkupPrecisions>(precisionRestrictions);
+    manager.register_pass<MarkupQuantizationGranularity>(quantizationRestrictions);
+    manager.run_passes(function);
+}
+
+// Attribute values in a form which doesn't depend on the shared value addresses.
+std::string toString(const ov::RTMap& rt) {
+    std::ostringstream result;
+    auto it = rt.find(PrecisionsAttribute::get_type_info_static());
+    if (it != rt.end()) {
+        result << "precisions:";
+        for (const auto& precision : it->second.as<PrecisionsAttribute>().value()) {
+            result << precision << ",";
+        }
+        result << ";";
+    }
+    it = rt.find(IntervalsAlignmentAttribute::get_type_info_static());
+    if (it != rt.end()) {
+        const auto& value = it->second.as<IntervalsAlignmentAttribute>().value();
+        result << "intervals:" <<
+            value.combinedInterval.low << "," << value.combinedInterval.high << "," <<
+            value.minInterval.low << "," << value.minInterval.high << "," << value.minLevels << ";";
+    }
+    it = rt.find(QuantizationAlignmentAttribute::get_type_info_static());
+    if (it != rt.end()) {
+        result << "alignment:" << it->second.as<QuantizationAlignmentAttribute>().value() << ";";
+    }
+    return result.str();
+}
+
+std::vector<std::string> getAttributes(const std::shared_ptr<ngraph::Function>& function) {
+    std::vector<std::string> attributes;
+    for (const auto& node : function->get_ordered_ops()) {
+        std::ostringstream description;
+        description << node->get_type_name() << " node{" << toString(node->get_rt_info()) << "}";
+        for (const auto& input : node->inputs()) {
+            description << " in{" << toString(input.get_rt_info()) << "}";
+        }
+        for (const auto& output : node->outputs()) {
+            description << " out{" << toString(output.get_rt_info()) << "}";
+        }
+        attributes.push_back(description.str());
+    }
+    return attributes;
+}
+
+void propagateBySequence(const std::shared_ptr<ngraph::Function>& function) {
+    ngraph::pass::Manager manager;
+    manager.register_pass<PropagatePrecisions>();
+    manager.register_pass<AlignQuantizationIntervals>();
+    manager.register_pass<AlignQuantizationParameters>();
+    manager.run_passes(function);
+}
+
+void propagateByPass(const std::shared_ptr<ngraph::Function>& function) {
+    ngraph::pass::Manager manager;
+    manager.register_pass<PropagateAttributes>();
+    manager.run_passes(function);
+}
+
+template <typename Callback>
+int measureMs(Callback callback) {
+    const auto start = std::chrono::steady_clock::now();
+    callback();
+    return static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+}  // namespace
+
+TEST(LPT, PropagateAttributesIsEquivalentToPropagationSequence) {
+    const size_t blocks = 20ul;
+    const auto reference = createFunction(blocks);
+    markup(reference);
+    propagateBySequence(reference);
+    const auto actual = createFunction(blocks);
+    markup(actual);
+    propagateByPass(actual);
+
+    const auto expectedAttributes = getAttributes(reference);
+    const auto actualAttributes = getAttributes(actual);
+    ASSERT_EQ(expectedAttributes.size(), actualAttributes.size());
+    for (size_t i = 0; i < expectedAttributes.size(); ++i) {
+        ASSERT_EQ(expectedAttributes[i], actualAttributes[i]) << "operation #" << i;
+    }
+}
+
+// The times are reported as the properties of the test (e.g. --gtest_output=xml),
+// it is run manually with --gtest_also_run_disabled_tests
+TEST(LPT, DISABLED_PropagateAttributesTime) {
+    const size_t blocks = 200ul;
+    const auto reference = createFunction(blocks);
+    markup(reference);
+    const auto actual = createFunction(blocks);
+    markup(actual);
+
+    ::testing::Test::RecordProperty("sequence_ms", measureMs([&]() { propagateBySequence(reference); }));
+    ::testing::Test::RecordProperty("propagate_attributes_ms", measureMs([&]() { propagateByPass(actual); }));
+    ASSERT_EQ(getAttributes(reference), getAttributes(actual));
+}
+
+TEST(LPT, PropagateAttributesSkipsDisabledStage) {
+    const auto function = createFunction(2ul);
+    markup(function);
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<PropagateAttributes>();
+    manager.get_pass_config()->disable<AlignQuantizationParameters>();
+    manager.run_passes(function);
+
+    for (const auto& node : function->get_ordered_ops()) {
+        ASSERT_EQ(0ul, node->get_rt_info().count(QuantizationAlignmentAttribute::get_type_info_static())) << node->get_friendly_name();
+    }
+}
@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/pass/pass.hpp>
+#include <transformations_visibility.hpp>
+
+namespace ov {
+namespace pass {
+
+class TRANSFORMATIONS_API WeightsDeduplication;
+
+}  // namespace pass
+}  // namespace ov
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief WeightsDeduplication makes byte-identical Constants (including the ones from sub-graph bodies) share the
+ * memory of the first of them. Constant payloads are hashed in parallel, the candidates are compared byte by byte.
+ * The amount of memory released by the pass is available via get_saved_bytes().
+ */
+class ov::pass::WeightsDeduplication : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("WeightsDeduplication", "0");
+    bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
+
+    size_t get_saved_bytes() const {
+        return m_saved_bytes;
+    }
+
+private:
+    size_t m_saved_bytes = 0;
+};
@@ -0,0 +1,136 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/weights_deduplication.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <map>
+#include <ngraph/log.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
+#include <openvino/cc/ngraph/itt.hpp>
+#include <openvino/core/rt_info.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/util/multi_subgraph_base.hpp>
+#include <thread>
+
+namespace {
+
+// Constants smaller than that are not worth a separate node sharing the memory
+constexpr size_t min_byte_size = 64;
+// Do not spawn the tasks for the small total amount of weights
+constexpr size_t min_bytes_per_task = 1 << 20;
+
+uint64_t hash_bytes(const char* data, size_t size) {
+    constexpr uint64_t prime = 0x100000001b3ull;
+    uint64_t hash = 0xcbf29ce484222325ull ^ size;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * prime;
+        hash ^= hash >> 29;
+    }
+    for (; i < size; i++) {
+        hash = (hash ^ static_cast<uint8_t>(data[i])) * prime;
+    }
+    return hash;
+}
+
+void collect_constants(const std::shared_ptr<ov::Model>& model,
+                       std::vector<std::shared_ptr<ov::op::v0::Constant>>& constants) {
+    for (const auto& node : model->get_ops()) {
+        if (auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node)) {
+            if (constant->get_byte_size() >= min_byte_size)
+                constants.push_back(constant);
+        } else if (auto sub_graph_node = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(node)) {
+            for (size_t i = 0; i < sub_graph_node->get_internal_subgraphs_size(); i++) {
+                collect_constants(sub_graph_node->get_function(static_cast<int>(i)), constants);
+            }
+        }
+    }
+}
+
+std::vector<uint64_t> hash_constants(const std::vector<std::shared_ptr<ov::op::v0::Constant>>& constants) {
+    std::vector<uint64_t> hashes(constants.size());
+    auto hash_range = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            hashes[i] = hash_bytes(constants[i]->get_data_ptr<char>(), constants[i]->get_byte_size());
+        }
+    };
+
+    size_t total_size = 0;
+    for (const auto& constant : constants)
+        total_size += constant->get_byte_size();
+    const size_t tasks_count = std::min<size_t>({std::max(1u, std::thread::hardware_concurrency()),
+                                                 std::max<size_t>(1, total_size / min_bytes_per_task),
+                                                 constants.size()});
+    if (tasks_count <= 1) {
+        hash_range(0, constants.size());
+        return hashes;
+    }
+
+    // Split by the amount of bytes, so a single huge embedding does not serialize the whole pass
+    std::vector<std::future<void>> tasks;
+    const size_t bytes_per_task = (total_size + tasks_count - 1) / tasks_count;
+    size_t begin = 0, task_size = 0;
+    for (size_t i = 0; i < constants.size(); i++) {
+        task_size += constants[i]->get_byte_size();
+        if (task_size >= bytes_per_task || i + 1 == constants.size()) {
+            tasks.push_back(std::async(std::launch::async, hash_range, begin, i + 1));
+            begin = i + 1;
+            task_size = 0;
+        }
+    }
+    for (auto& task : tasks)
+        task.get();
+    return hashes;
+}
+
+}  // namespace
+
+bool ov::pass::WeightsDeduplication::run_on_model(const std::shared_ptr<ov::Model>& m) {
+    RUN_ON_MODEL_SCOPE(WeightsDeduplication);
+
+    std::vector<std::shared_ptr<ov::op::v0::Constant>> constants;
+    collect_constants(m, constants);
+    const auto hashes = hash_constants(constants);
+
+    // (size, hash) -> unique constants with such payload
+    std::map<std::pair<size_t, uint64_t>, std::vector<std::shared_ptr<ov::op::v0::Constant>>> unique;
+    size_t saved_bytes = 0;
+    for (size_t i = 0; i < constants.size(); i++) {
+        const auto& constant = constants[i];
+        const auto size = constant->get_byte_size();
+        const auto data = constant->get_data_ptr<char>();
+        auto& candidates = unique[{size, hashes[i]}];
+
+        auto same = std::find_if(candidates.begin(), candidates.end(), [&](const std::shared_ptr<op::v0::Constant>& c) {
+            return c->get_data_ptr() == data || std::memcmp(c->get_data_ptr(), data, size) == 0;
+        });
+        if (same == candidates.end()) {
+            candidates.push_back(constant);
+            continue;
+        }
+        const auto& original = *same;
+        if (original->get_data_ptr() == data)
+            continue;
+
+        auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<op::v0::Constant>>>(
+            const_cast<char*>(original->get_data_ptr<char>()),
+            size,
+            original);
+        auto shared = std::make_shared<op::v0::Constant>(constant->get_element_type(), constant->get_shape(), buffer);
+        shared->set_friendly_name(constant->get_friendly_name());
+        copy_runtime_info(constant, shared);
+        replace_node(constant, shared);
+        saved_bytes += size;
+    }
+
+    m_saved_bytes += saved_bytes;
+    NGRAPH_DEBUG << "WeightsDeduplication: " << saved_bytes << " bytes of " << constants.size()
+                 << " constants are shared";
+    return saved_bytes != 0;
+}
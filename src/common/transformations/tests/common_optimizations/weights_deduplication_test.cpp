@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/core/model.hpp>
+#include <openvino/opsets/opset9.hpp>
+#include <openvino/pass/manager.hpp>
+#include <transformations/common_optimizations/weights_deduplication.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ov;
+
+namespace {
+
+std::shared_ptr<opset9::Constant> make_constant(const element::Type& type, const Shape& shape, float value) {
+    return opset9::Constant::create(type, shape, std::vector<float>(shape_size(shape), value));
+}
+
+}  // namespace
+
+TEST(TransformationTests, WeightsDeduplication) {
+    auto data = std::make_shared<opset9::Parameter>(element::f32, Shape{4, 32});
+    auto const_1 = make_constant(element::f32, Shape{4, 32}, 1.f);
+    auto const_2 = make_constant(element::f32, Shape{4, 32}, 1.f);
+    // the same bytes with the other shape are shared as well
+    auto const_3 = make_constant(element::f32, Shape{1, 128}, 1.f);
+    auto const_4 = make_constant(element::f32, Shape{4, 32}, 2.f);
+    // too small to be shared
+    auto const_5 = make_constant(element::f32, Shape{1}, 1.f);
+    auto const_6 = make_constant(element::f32, Shape{1}, 1.f);
+    const_2->set_friendly_name("const_2");
+    const_2->get_output_tensor(0).set_names({"const_2"});
+
+    auto add_1 = std::make_shared<opset9::Add>(data, const_1);
+    auto add_2 = std::make_shared<opset9::Add>(add_1, const_2);
+    auto reshape =
+        std::make_shared<opset9::Reshape>(const_3, opset9::Constant::create(element::i64, {2}, {4, 32}), false);
+    auto add_3 = std::make_shared<opset9::Add>(add_2, reshape);
+    auto add_4 = std::make_shared<opset9::Add>(add_3, const_4);
+    auto add_5 = std::make_shared<opset9::Add>(add_4, const_5);
+    auto add_6 = std::make_shared<opset9::Add>(add_5, const_6);
+    auto model = std::make_shared<Model>(NodeVector{add_6}, ParameterVector{data});
+    const auto model_ref = model->clone();
+
+    pass::Manager manager;
+    auto deduplication = manager.register_pass<pass::WeightsDeduplication>();
+    manager.run_passes(model);
+
+    EXPECT_EQ(deduplication->get_saved_bytes(), 2 * 128 * sizeof(float));
+
+    auto get_constant = [](const std::shared_ptr<Node>& node, size_t port) {
+        return as_type_ptr<opset9::Constant>(node->get_input_node_shared_ptr(port));
+    };
+    const auto data_1 = get_constant(add_1, 1)->get_data_ptr();
+    EXPECT_EQ(get_constant(add_2, 1)->get_data_ptr(), data_1);
+    EXPECT_EQ(get_constant(reshape, 0)->get_data_ptr(), data_1);
+    EXPECT_EQ(get_constant(reshape, 0)->get_shape(), (Shape{1, 128}));
+    EXPECT_NE(get_constant(add_4, 1)->get_data_ptr(), data_1);
+    EXPECT_NE(get_constant(add_5, 1)->get_data_ptr(), get_constant(add_6, 1)->get_data_ptr());
+
+    EXPECT_EQ(get_constant(add_2, 1)->get_friendly_name(), "const_2");
+    EXPECT_EQ(get_constant(add_2, 1)->output(0).get_names(), std::unordered_set<std::string>{"const_2"});
+
+    const auto res = FunctionsComparator::with_default().enable(FunctionsComparator::CONST_VALUES)(model, model_ref);
+    ASSERT_TRUE(res.valid) << res.message;
+
+    // The second run finds nothing to share
+    pass::Manager manager_2;
+    auto deduplication_2 = manager_2.register_pass<pass::WeightsDeduplication>();
+    manager_2.run_passes(model);
+    EXPECT_EQ(deduplication_2->get_saved_bytes(), 0u);
+}
+
+TEST(TransformationTests, WeightsDeduplicationSubGraph) {
+    auto body_data = std::make_shared<opset9::Parameter>(element::f32, Shape{4, 32});
+    auto body_add = std::make_shared<opset9::Add>(body_data, make_constant(element::f32, Shape{4, 32}, 3.f));
+    auto body = std::make_shared<Model>(OutputVector{body_add}, ParameterVector{body_data});
+
+    auto data = std::make_shared<opset9::Parameter>(element::f32, Shape{4, 32});
+    auto add = std::make_shared<opset9::Add>(data, make_constant(element::f32, Shape{4, 32}, 3.f));
+    auto tensor_iterator = std::make_shared<opset9::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_invariant_input(body_data, add);
+    auto output = tensor_iterator->get_iter_value(body_add, -1);
+    auto model = std::make_shared<Model>(OutputVector{output}, ParameterVector{data});
+
+    pass::Manager manager;
+    auto deduplication = manager.register_pass<pass::WeightsDeduplication>();
+    manager.run_passes(model);
+
+    EXPECT_EQ(deduplication->get_saved_bytes(), 128 * sizeof(float));
+    EXPECT_EQ(body_add->get_input_node_ptr(1)->get_type_info(), opset9::Constant::get_type_info_static());
+    EXPECT_EQ(as_type<opset9::Constant>(body_add->get_input_node_ptr(1))->get_data_ptr(),
+              as_type<opset9::Constant>(add->get_input_node_ptr(1))->get_data_ptr());
+}
@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific shared memory map objects
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Read-only memory mapping of a whole file. The file is unmapped when the object is destroyed.
+ */
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+
+    virtual char* data() noexcept = 0;
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps the file into the process memory. Pages are read from the file on the first access.
+ * @param path Path to the file
+ * @return Mapped memory of the file
+ * @throws std::runtime_error if the file can not be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+/**
+ * @brief Maps the file with the wide char path into the process memory.
+ * @param path Path to the file
+ * @return Mapped memory of the file
+ * @throws std::runtime_error if the file can not be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path);
+
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
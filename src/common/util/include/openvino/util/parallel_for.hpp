@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the lightweight parallel loop used by the components which don't depend on the threading
+ * runtime (e.g. the frontends)
+ * @file parallel_for.hpp
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Set in the worker threads of parallel_for, so the nested calls run serially
+ */
+inline bool& in_parallel_region() {
+    static thread_local bool value = false;
+    return value;
+}
+
+/**
+ * @brief Runs func(i) for every i in [0, size) on the hardware threads and rethrows the first exception.
+ * The calls from a parallel_for worker are executed serially to avoid oversubscription.
+ */
+template <typename F>
+void parallel_for(size_t size, const F& func) {
+    const size_t nthreads =
+        in_parallel_region() ? 1 : std::min<size_t>(size, std::max(1u, std::thread::hardware_concurrency()));
+    if (nthreads <= 1) {
+        for (size_t i = 0; i < size; ++i)
+            func(i);
+        return;
+    }
+    auto run_chunk = [&](size_t chunk) {
+        auto& in_parallel = in_parallel_region();
+        const bool was_in_parallel = in_parallel;
+        in_parallel = true;
+        try {
+            for (size_t i = chunk; i < size; i += nthreads)
+                func(i);
+        } catch (...) {
+            in_parallel = was_in_parallel;
+            throw;
+        }
+        in_parallel = was_in_parallel;
+    };
+    std::vector<std::future<void>> futures;
+    for (size_t chunk = 1; chunk < nthreads; ++chunk)
+        futures.emplace_back(std::async(std::launch::async, run_chunk, chunk));
+    run_chunk(0);
+    for (auto& future : futures)
+        future.get();
+}
+
+}  // namespace util
+}  // namespace ov
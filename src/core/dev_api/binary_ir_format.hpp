@@ -0,0 +1,149 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace ov {
+namespace binary_ir {
+
+/**
+ * @brief Layout of the binary model format written by ov::pass::BinarySerialize and read by the IR frontend.
+ *
+ * The file is a Header followed by the sections it refers to. Every section starts at the offset aligned to
+ * `alignment` from the beginning of the file, so the tables can be used in place from a memory mapping of the file:
+ *  - strings:        StringRecord[] - all the names are interned and referenced by their index in this table
+ *  - string_data:    characters of the strings
+ *  - nodes:          NodeRecord[] in the topological order
+ *  - inputs:         InputRecord[] - the input ports, NodeRecord::inputs refers to a range of this table
+ *  - outputs:        OutputRecord[] - the output ports, NodeRecord::outputs refers to a range of this table
+ *  - attributes:     AttributeRecord[] - the attributes of the nodes and of the runtime info
+ *  - rt_info:        RTInfoRecord[] - runtime attributes of the nodes and of their ports
+ *  - attribute_data: values of the vector attributes
+ *  - indices:        uint32_t[] - tensor names, parameters, results and sinks
+ *  - weights:        data of the Constants, every constant is aligned to `alignment`
+ *
+ * All the values are stored in the little endian byte order, Header::byte_order lets the reader reject the file
+ * written in the other one.
+ */
+
+constexpr char magic[8] = {'O', 'V', 'B', 'I', 'N', 'I', 'R', '\0'};
+constexpr uint32_t format_version = 1;
+constexpr uint32_t byte_order_mark = 0x01020304;
+constexpr uint64_t alignment = 64;
+
+struct Section {
+    uint64_t offset;  // from the beginning of the file
+    uint64_t size;    // in bytes
+};
+
+struct Range {
+    uint32_t first;
+    uint32_t count;
+};
+
+enum class AttributeType : uint32_t {
+    String,            // value is the string id
+    Bool,              // value is 0 or 1
+    Int64,             // value is the number
+    Double,            // value is the bit representation of the number
+    Int32Vector,       // int32_t[size] at offset in attribute_data
+    Int64Vector,       // int64_t[size] at offset in attribute_data
+    UInt64Vector,      // uint64_t[size] at offset in attribute_data
+    FloatVector,       // float[size] at offset in attribute_data
+    StringVector,      // string ids uint32_t[size] at offset in attribute_data
+    ElementTypeVector, // names of the types, as StringVector
+    PartialShape,      // int64_t[size] at offset in attribute_data: rank (-1 for dynamic) and {min, max} per dimension
+    Dimension,         // int64_t[2] {min, max} at offset in attribute_data, max is -1 for the unbounded dimension
+    Variable,          // value is the string id of the variable id
+    Buffer,            // data of the size bytes at offset in the weights section
+};
+
+struct StringRecord {
+    uint64_t offset;  // in string_data
+    uint64_t size;
+};
+
+struct NodeRecord {
+    uint32_t type;     // string id of the type name
+    uint32_t version;  // string id of the opset name
+    uint32_t name;     // string id of the friendly name
+    Range inputs;
+    Range outputs;
+    Range attributes;
+    Range rt_info;
+};
+
+struct InputRecord {
+    uint32_t node;  // index of the producer node
+    uint32_t port;  // output port of the producer node
+    Range rt_info;
+};
+
+struct OutputRecord {
+    Range names;  // string ids of the tensor names in indices
+    Range rt_info;
+};
+
+struct AttributeRecord {
+    uint32_t name;
+    AttributeType type;
+    uint64_t value;  // the scalar value or the offset of the data, depending on the type
+    uint64_t size;   // number of the elements (the bytes for Buffer) for the types with data
+};
+
+struct RTInfoRecord {
+    uint32_t name;
+    uint32_t version;
+    Range attributes;
+};
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;  // byte_order_mark in the byte order of the file
+    uint32_t name;        // string id of the model name
+    uint32_t reserved;
+    Section strings;
+    Section string_data;
+    Section nodes;
+    Section inputs;
+    Section outputs;
+    Section attributes;
+    Section rt_info;
+    Section attribute_data;
+    Section indices;
+    Section weights;
+    Range parameters;  // node indices in indices
+    Range results;
+    Range sinks;
+};
+
+static_assert(std::is_trivially_copyable<Header>::value && std::is_trivially_copyable<NodeRecord>::value &&
+                  std::is_trivially_copyable<AttributeRecord>::value,
+              "Records of the binary format must be trivially copyable");
+
+inline uint64_t align(uint64_t offset) {
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * @brief Checks whether the values in memory are stored in the little endian byte order, as the format requires
+ */
+inline bool is_little_endian() {
+    const uint32_t value = 1;
+    char first_byte;
+    std::memcpy(&first_byte, &value, 1);
+    return first_byte == 1;
+}
+
+inline bool has_magic(const char* data, size_t size) {
+    return size >= sizeof(Header) && std::memcmp(data, magic, sizeof(magic)) == 0;
+}
+
+}  // namespace binary_ir
+}  // namespace ov
@@ -94,5 +94,27 @@ private:
     const Serialize::Version m_version;
 };
 
+/**
+ * @brief BinarySerialize transformation writes ov::Model into a single file of the binary format which is read by
+ * the IR frontend from the memory mapping without parsing
+ * @attention
+ * - operations with bodies (TensorIterator, Loop, If) and framework nodes are not supported
+ * - model runtime info (meta data) is not supported, the transformation throws if it is not empty
+ * \ingroup ov_pass_cpp_api
+ */
+class OPENVINO_API BinarySerialize : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("BinarySerialize");
+
+    bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
+
+    explicit BinarySerialize(std::ostream& stream);
+    explicit BinarySerialize(const std::string& path);
+
+private:
+    std::ostream* m_stream;
+    const std::string m_path;
+};
+
 }  // namespace pass
 }  // namespace ov
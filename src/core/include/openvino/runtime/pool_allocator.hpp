@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides PoolAllocator, the pooling implementation of AllocatorImpl
+ *
+ * @file openvino/runtime/pool_allocator.hpp
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "openvino/core/core_visibility.hpp"
+#include "openvino/runtime/allocator.hpp"
+
+namespace ov {
+
+/**
+ * @brief Statistics of PoolAllocator
+ * @ingroup ov_runtime_cpp_api
+ */
+struct PoolAllocatorStatistics {
+    /// @brief Bytes allocated and not deallocated yet, rounded up to the size classes
+    size_t live_bytes = 0;
+    /// @brief Maximum value of live_bytes
+    size_t high_water_mark = 0;
+    /// @brief Bytes kept by the pool for reuse
+    size_t cached_bytes = 0;
+    /// @brief Number of allocations
+    uint64_t allocations = 0;
+    /// @brief Number of allocations served by the memory kept in the pool
+    uint64_t pool_hits = 0;
+};
+
+/**
+ * @brief Allocator which keeps the deallocated memory for reuse instead of returning it to the system
+ * @ingroup ov_runtime_cpp_api
+ *
+ * The sizes are rounded up to size classes (four per power of two), the memory is aligned at least to 64 bytes.
+ * The deallocated blocks of up to 256 KB are cached by the deallocating thread, the rest of the blocks are kept by the
+ * pool until the pool holds `max_cached_bytes`. Allocations with an alignment larger than 64 bytes and of more than
+ * 1 GB are not pooled. The allocator is thread safe, the memory may be deallocated by any thread.
+ *
+ * @code
+ * auto pool = std::make_shared<ov::PoolAllocator>();
+ * ov::Tensor tensor(ov::element::f32, {1, 3, 224, 224}, ov::Allocator(pool));
+ * @endcode
+ */
+class OPENVINO_API PoolAllocator : public AllocatorImpl {
+public:
+    /**
+     * @brief Constructs the pool
+     * @param max_cached_bytes The maximum size of the memory kept by the pool for reuse
+     */
+    explicit PoolAllocator(size_t max_cached_bytes = 256 * 1024 * 1024);
+
+    /**
+     * @brief Destroys the pool and releases the memory kept by it. Memory allocated by the pool has to be deallocated
+     * before.
+     */
+    ~PoolAllocator();
+
+    PoolAllocator(const PoolAllocator&) = delete;
+    PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+    void* allocate(const size_t bytes, const size_t alignment = alignof(max_align_t)) override;
+
+    /**
+     * @brief Returns the memory to the pool. The size and the alignment are taken from the allocated block, `bytes`
+     * may be zero.
+     */
+    void deallocate(void* handle, const size_t bytes, size_t alignment = alignof(max_align_t)) override;
+
+    bool is_equal(const AllocatorImpl& other) const override;
+
+    /**
+     * @brief Returns the current statistics of the pool
+     */
+    PoolAllocatorStatistics get_statistics() const;
+
+    /**
+     * @brief Returns the memory kept by the pool to the system. The memory cached by other threads is not released.
+     */
+    void release_cached_memory();
+
+private:
+    struct Impl;
+    std::shared_ptr<Impl> _impl;
+};
+
+}  // namespace ov
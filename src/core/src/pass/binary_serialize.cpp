@@ -0,0 +1,378 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <fstream>
+#include <openvino/cc/pass/itt.hpp>
+#include <set>
+#include <unordered_map>
+
+#include "binary_ir_format.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/op/util/framework_node.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "openvino/pass/serialize.hpp"
+#include "openvino/util/file_util.hpp"
+
+using namespace ov::binary_ir;
+
+namespace {
+
+/**
+ * @brief Collects the tables of the binary format in memory, the weights are written directly from the constants
+ */
+class BinaryModelWriter {
+public:
+    uint32_t add_string(const std::string& str) {
+        const auto found = m_string_ids.find(str);
+        if (found != m_string_ids.end())
+            return found->second;
+        const auto id = static_cast<uint32_t>(m_strings.size());
+        m_strings.push_back({m_string_data.size(), str.size()});
+        m_string_data.insert(m_string_data.end(), str.begin(), str.end());
+        m_string_ids.emplace(str, id);
+        return id;
+    }
+
+    template <typename T>
+    uint64_t add_data(const T* data, size_t count) {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable data can be stored");
+        // every array is aligned to 8 bytes, so all the element types can be read in place
+        const uint64_t offset = m_attribute_data.size();
+        m_attribute_data.resize(offset + (count * sizeof(T) + 7) / 8 * 8);
+        if (count)
+            std::memcpy(m_attribute_data.data() + offset, data, count * sizeof(T));
+        return offset;
+    }
+
+    uint64_t add_weights(const char* data, size_t size) {
+        // the same buffer may be shared by several constants
+        const auto found = m_weights_ids.find(data);
+        if (found != m_weights_ids.end() && m_weights[found->second].size >= size)
+            return m_weights[found->second].offset;
+        const uint64_t offset = m_weights_size;
+        m_weights_ids[data] = m_weights.size();
+        m_weights.push_back({data, size, offset});
+        m_weights_size = align(offset + size);
+        return offset;
+    }
+
+    Range add_indices(const std::vector<uint32_t>& indices) {
+        Range range{static_cast<uint32_t>(m_indices.size()), static_cast<uint32_t>(indices.size())};
+        m_indices.insert(m_indices.end(), indices.begin(), indices.end());
+        return range;
+    }
+
+    Range add_rt_info(ov::RTMap& rt_info);
+
+    void write_model(const ov::Model& model);
+
+    void save(std::ostream& stream) const;
+
+    std::vector<AttributeRecord>& attributes() {
+        return m_attributes;
+    }
+
+private:
+    std::vector<StringRecord> m_strings;
+    std::vector<char> m_string_data;
+    std::unordered_map<std::string, uint32_t> m_string_ids;
+    std::vector<NodeRecord> m_nodes;
+    std::vector<InputRecord> m_inputs;
+    std::vector<OutputRecord> m_outputs;
+    std::vector<AttributeRecord> m_attributes;
+    std::vector<RTInfoRecord> m_rt_info;
+    std::vector<char> m_attribute_data;
+    std::vector<uint32_t> m_indices;
+    struct Weights {
+        const char* data;
+        size_t size;
+        uint64_t offset;  // in the weights section
+    };
+    std::vector<Weights> m_weights;
+    std::unordered_map<const char*, size_t> m_weights_ids;
+    uint64_t m_weights_size = 0;
+    Header m_header = {};
+};
+
+class BinaryAttributeWriter : public ov::AttributeVisitor {
+public:
+    BinaryAttributeWriter(BinaryModelWriter& writer, std::string node_type)
+        : m_writer(writer),
+          m_node_type(std::move(node_type)) {}
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        if (const auto& a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::op::util::Variable>>>(&adapter)) {
+            add(name, AttributeType::Variable, m_writer.add_string(a->get()->get_info().variable_id));
+        } else if (const auto& a =
+                       ov::as_type<ov::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            const auto& buffer = a->get();
+            if (!buffer)
+                return;
+            const auto offset = m_writer.add_weights(buffer->get_ptr<char>(), buffer->size());
+            add(name, AttributeType::Buffer, offset, buffer->size());
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::element::TypeVector>>(&adapter)) {
+            std::vector<uint32_t> ids;
+            for (const auto& type : a->get())
+                ids.push_back(m_writer.add_string(type.get_type_name()));
+            add(name, AttributeType::ElementTypeVector, m_writer.add_data(ids.data(), ids.size()), ids.size());
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::PartialShape>>(&adapter)) {
+            const auto& shape = a->get();
+            std::vector<int64_t> values{shape.rank().is_static() ? shape.rank().get_length() : -1};
+            if (shape.rank().is_static()) {
+                for (const auto& dim : shape) {
+                    values.push_back(dim.get_min_length());
+                    values.push_back(dim.get_max_length());
+                }
+            }
+            add(name, AttributeType::PartialShape, m_writer.add_data(values.data(), values.size()), values.size());
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::Dimension>>(&adapter)) {
+            const int64_t values[] = {a->get().get_min_length(), a->get().get_max_length()};
+            add(name, AttributeType::Dimension, m_writer.add_data(values, 2), 2);
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<std::set<std::string>>>(&adapter)) {
+            std::vector<uint32_t> ids;
+            for (const auto& str : a->get())
+                ids.push_back(m_writer.add_string(str));
+            add(name, AttributeType::StringVector, m_writer.add_data(ids.data(), ids.size()), ids.size());
+        } else {
+            OPENVINO_ASSERT(!ov::as_type<ov::AttributeAdapter<ov::op::util::FrameworkNodeAttrs>>(&adapter),
+                            "Framework nodes are not supported by the binary serialization");
+            OPENVINO_UNREACHABLE("Unsupported attribute type for the binary serialization: ",
+                                 name,
+                                 " of ",
+                                 m_node_type);
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        add(name, AttributeType::Bool, adapter.get() ? 1 : 0);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        add(name, AttributeType::String, m_writer.add_string(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        add(name, AttributeType::Int64, static_cast<uint64_t>(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        const double value = adapter.get();
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        add(name, AttributeType::Double, bits);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int>>& adapter) override {
+        add_vector(name, AttributeType::Int32Vector, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        add_vector(name, AttributeType::Int64Vector, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        add_vector(name, AttributeType::UInt64Vector, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        add_vector(name, AttributeType::FloatVector, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        std::vector<uint32_t> ids;
+        for (const auto& str : adapter.get())
+            ids.push_back(m_writer.add_string(str));
+        add(name, AttributeType::StringVector, m_writer.add_data(ids.data(), ids.size()), ids.size());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        OPENVINO_UNREACHABLE("Operations with bodies are not supported by the binary serialization: ", m_node_type);
+    }
+
+private:
+    void add(const std::string& name, AttributeType type, uint64_t value, uint64_t size = 0) {
+        m_writer.attributes().push_back({m_writer.add_string(name), type, value, size});
+    }
+
+    template <typename T>
+    void add_vector(const std::string& name, AttributeType type, const std::vector<T>& values) {
+        add(name, type, m_writer.add_data(values.data(), values.size()), values.size());
+    }
+
+    BinaryModelWriter& m_writer;
+    const std::string m_node_type;
+};
+
+Range BinaryModelWriter::add_rt_info(ov::RTMap& rt_info) {
+    std::vector<RTInfoRecord> records;
+    for (auto& item : rt_info) {
+        if (!item.second.is<ov::RuntimeAttribute>())
+            continue;
+        auto& attribute = item.second.as<ov::RuntimeAttribute>();
+        const auto& type_info = attribute.get_type_info();
+        const auto first = static_cast<uint32_t>(m_attributes.size());
+        BinaryAttributeWriter visitor(*this, item.first);
+        if (!attribute.visit_attributes(visitor)) {
+            m_attributes.resize(first);
+            continue;
+        }
+        records.push_back({add_string(type_info.name),
+                           add_string(type_info.get_version()),
+                           {first, static_cast<uint32_t>(m_attributes.size() - first)}});
+    }
+    Range range{static_cast<uint32_t>(m_rt_info.size()), static_cast<uint32_t>(records.size())};
+    m_rt_info.insert(m_rt_info.end(), records.begin(), records.end());
+    return range;
+}
+
+void BinaryModelWriter::write_model(const ov::Model& model) {
+    OPENVINO_ASSERT(is_little_endian(), "The binary serialization is supported for the little endian platforms only");
+    OPENVINO_ASSERT(model.get_rt_info().empty(),
+                    "Runtime info of the model is not supported by the binary serialization: ",
+                    model.get_friendly_name());
+    const auto ops = model.get_ordered_ops();
+    std::unordered_map<const ov::Node*, uint32_t> node_ids;
+    node_ids.reserve(ops.size());
+    m_nodes.reserve(ops.size());
+
+    for (const auto& node : ops) {
+        const auto& type_info = node->get_type_info();
+        OPENVINO_ASSERT(!ov::is_type<ov::op::util::FrameworkNode>(node),
+                        "Framework nodes are not supported by the binary serialization: ",
+                        node->get_friendly_name());
+        NodeRecord record = {};
+        record.type = add_string(type_info.name);
+        record.version = add_string(type_info.version_id ? type_info.version_id : "experimental");
+        record.name = add_string(node->get_friendly_name());
+
+        record.inputs.first = static_cast<uint32_t>(m_inputs.size());
+        for (auto input : node->inputs()) {
+            const auto source = input.get_source_output();
+            const auto producer = node_ids.find(source.get_node());
+            OPENVINO_ASSERT(producer != node_ids.end(), "Input of ", node->get_friendly_name(), " is not in the model");
+            m_inputs.push_back(
+                {producer->second, static_cast<uint32_t>(source.get_index()), add_rt_info(input.get_rt_info())});
+        }
+        record.inputs.count = static_cast<uint32_t>(node->get_input_size());
+
+        record.outputs.first = static_cast<uint32_t>(m_outputs.size());
+        for (auto output : node->outputs()) {
+            const auto& tensor_names = output.get_names();
+            // sorted to get the same file for the same model
+            std::vector<std::string> sorted_names(tensor_names.begin(), tensor_names.end());
+            std::sort(sorted_names.begin(), sorted_names.end());
+            std::vector<uint32_t> names;
+            for (const auto& name : sorted_names)
+                names.push_back(add_string(name));
+            m_outputs.push_back({add_indices(names), add_rt_info(output.get_rt_info())});
+        }
+        record.outputs.count = static_cast<uint32_t>(node->get_output_size());
+
+        record.attributes.first = static_cast<uint32_t>(m_attributes.size());
+        BinaryAttributeWriter visitor(*this, type_info.name);
+        node->visit_attributes(visitor);
+        record.attributes.count = static_cast<uint32_t>(m_attributes.size() - record.attributes.first);
+
+        record.rt_info = add_rt_info(node->get_rt_info());
+
+        node_ids.emplace(node.get(), static_cast<uint32_t>(m_nodes.size()));
+        m_nodes.push_back(record);
+    }
+
+    auto indices_of = [&](const std::vector<std::shared_ptr<ov::Node>>& nodes) {
+        std::vector<uint32_t> indices;
+        for (const auto& node : nodes)
+            indices.push_back(node_ids.at(node.get()));
+        return add_indices(indices);
+    };
+    const auto& model_parameters = model.get_parameters();
+    const auto& model_results = model.get_results();
+    const auto& model_sinks = model.get_sinks();
+    std::vector<std::shared_ptr<ov::Node>> parameters(model_parameters.begin(), model_parameters.end());
+    std::vector<std::shared_ptr<ov::Node>> results(model_results.begin(), model_results.end());
+    std::vector<std::shared_ptr<ov::Node>> sinks(model_sinks.begin(), model_sinks.end());
+
+    std::memcpy(m_header.magic, magic, sizeof(magic));
+    m_header.version = format_version;
+    m_header.byte_order = byte_order_mark;
+    m_header.name = add_string(model.get_friendly_name());
+    m_header.parameters = indices_of(parameters);
+    m_header.results = indices_of(results);
+    m_header.sinks = indices_of(sinks);
+}
+
+void BinaryModelWriter::save(std::ostream& stream) const {
+    Header header = m_header;
+    uint64_t offset = align(sizeof(Header));
+    auto place = [&offset](Section& section, uint64_t size) {
+        section = {offset, size};
+        offset = align(offset + size);
+    };
+    place(header.strings, m_strings.size() * sizeof(StringRecord));
+    place(header.string_data, m_string_data.size());
+    place(header.nodes, m_nodes.size() * sizeof(NodeRecord));
+    place(header.inputs, m_inputs.size() * sizeof(InputRecord));
+    place(header.outputs, m_outputs.size() * sizeof(OutputRecord));
+    place(header.attributes, m_attributes.size() * sizeof(AttributeRecord));
+    place(header.rt_info, m_rt_info.size() * sizeof(RTInfoRecord));
+    place(header.attribute_data, m_attribute_data.size());
+    place(header.indices, m_indices.size() * sizeof(uint32_t));
+    place(header.weights, m_weights_size);
+
+    uint64_t position = 0;
+    auto write = [&](const void* data, uint64_t size) {
+        stream.write(static_cast<const char*>(data), size);
+        position += size;
+    };
+    auto pad_to = [&](uint64_t target) {
+        static const char zeros[alignment] = {};
+        while (position < target)
+            write(zeros, std::min<uint64_t>(target - position, alignment));
+    };
+    auto write_section = [&](const Section& section, const void* data) {
+        pad_to(section.offset);
+        write(data, section.size);
+    };
+
+    write(&header, sizeof(header));
+    write_section(header.strings, m_strings.data());
+    write_section(header.string_data, m_string_data.data());
+    write_section(header.nodes, m_nodes.data());
+    write_section(header.inputs, m_inputs.data());
+    write_section(header.outputs, m_outputs.data());
+    write_section(header.attributes, m_attributes.data());
+    write_section(header.rt_info, m_rt_info.data());
+    write_section(header.attribute_data, m_attribute_data.data());
+    write_section(header.indices, m_indices.data());
+    pad_to(header.weights.offset);
+    for (const auto& weights : m_weights) {
+        pad_to(header.weights.offset + weights.offset);
+        write(weights.data, weights.size);
+    }
+    pad_to(header.weights.offset + header.weights.size);
+    stream.flush();
+}
+
+}  // namespace
+
+namespace ov {
+pass::BinarySerialize::BinarySerialize(std::ostream& stream) : m_stream(&stream), m_path{} {}
+
+pass::BinarySerialize::BinarySerialize(const std::string& path) : m_stream(nullptr), m_path(path) {}
+
+bool pass::BinarySerialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_MODEL_SCOPE(BinarySerialize);
+    BinaryModelWriter writer;
+    writer.write_model(*model);
+
+    if (m_stream) {
+        writer.save(*m_stream);
+    } else {
+        auto dir = ov::util::get_directory(m_path);
+        if (dir != m_path)
+            ov::util::create_directory_recursive(dir);
+
+        std::ofstream file(m_path, std::ios::out | std::ios::binary);
+        OPENVINO_ASSERT(file, "Can't open file: \"", m_path, "\"");
+        writer.save(file);
+        OPENVINO_ASSERT(file, "Can't write file: \"", m_path, "\"");
+    }
+
+    // Return false because we didn't change the model
+    return false;
+}
+}  // namespace ov
@@ -129,6 +129,7 @@ void PreStepsList::add_convert_impl(const element::Type& type) {
                                 "Can't insert 'convert_element_type' for dynamic source tensor type.");
                 if (t != node.get_element_type()) {
                     auto convert = std::make_shared<op::v0::Convert>(node, t);
+                    set_is_preprocessing_node(convert);
                     res.emplace_back(convert);
                 } else {
                     res.emplace_back(node);
@@ -280,6 +281,7 @@ void PreStepsList::add_convert_layout_impl(const Layout& layout) {
             auto perm_constant =
                 op::v0::Constant::create<int64_t>(element::i64, Shape{permutation.size()}, permutation);
             auto transpose = std::make_shared<op::v1::Transpose>(node, perm_constant);
+            set_is_preprocessing_node(transpose);
             context.layout() = dst_layout;  // Update context's current layout
             // return false to avoid excess function revalidations as layout conversion
             // doesn't require shape or type propagation.
@@ -305,6 +307,7 @@ void PreStepsList::add_convert_layout_impl(const std::vector<uint64_t>& dims) {
             auto new_layout = layout::utils::apply_permutation(context.layout(), dims);
             auto perm_constant = op::v0::Constant::create<uint64_t>(element::u64, Shape{dims.size()}, dims);
             auto transpose = std::make_shared<op::v1::Transpose>(nodes[0], perm_constant);
+            set_is_preprocessing_node(transpose);
             context.layout() = std::move(new_layout);  // Update context's current layout
             // return false to avoid excess function revalidations as layout conversion
             // doesn't require shape or type propagation.
@@ -0,0 +1,292 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/pool_allocator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+
+namespace {
+
+constexpr size_t min_alignment = 64;
+constexpr size_t min_class_log2 = 6;
+constexpr size_t min_class_size = size_t(1) << min_class_log2;
+// sizes of 1 GB and more are not pooled
+constexpr size_t max_class_log2 = 30;
+// number of size classes between two powers of two, limits the rounding overhead by 25%
+constexpr size_t class_steps = 4;
+constexpr size_t num_classes = (max_class_log2 - min_class_log2) * class_steps + 1;
+constexpr size_t no_class = num_classes;
+// classes up to 256 KB are cached by threads
+constexpr size_t thread_cached_classes = (18 - min_class_log2) * class_steps + 1;
+constexpr size_t thread_cache_blocks = 8;
+
+struct BlockHeader {
+    void* raw;
+    size_t size;
+    size_t size_class;
+};
+
+size_t floor_log2(size_t value) {
+    size_t result = 0;
+    while (value >>= 1)
+        ++result;
+    return result;
+}
+
+size_t get_size_class(const size_t bytes, size_t& class_size) {
+    if (bytes <= min_class_size) {
+        class_size = min_class_size;
+        return 0;
+    }
+    const auto log2 = floor_log2(bytes - 1);
+    if (log2 >= max_class_log2) {
+        class_size = bytes;
+        return no_class;
+    }
+    const size_t base = size_t(1) << log2;
+    const size_t step = base / class_steps;
+    const size_t index = (bytes - 1 - base) / step;
+    class_size = base + (index + 1) * step;
+    return (log2 - min_class_log2) * class_steps + index + 1;
+}
+
+BlockHeader* get_header(void* block) {
+    return static_cast<BlockHeader*>(block) - 1;
+}
+
+void* allocate_block(const size_t size, const size_t alignment, const size_t size_class) {
+    const size_t offset = sizeof(BlockHeader) + alignment - 1;
+    OPENVINO_ASSERT(size <= std::numeric_limits<size_t>::max() - offset,
+                    "Can not allocate storage for at least ",
+                    size,
+                    " bytes");
+    void* raw = std::malloc(size + offset);
+    OPENVINO_ASSERT(raw != nullptr, "Can not allocate storage for at least ", size, " bytes");
+    const auto payload = (reinterpret_cast<uintptr_t>(raw) + offset) & ~static_cast<uintptr_t>(alignment - 1);
+    auto header = reinterpret_cast<BlockHeader*>(payload) - 1;
+    header->raw = raw;
+    header->size = size;
+    header->size_class = size_class;
+    return reinterpret_cast<void*>(payload);
+}
+
+void free_block(void* block) {
+    std::free(get_header(block)->raw);
+}
+
+}  // namespace
+
+struct PoolAllocator::Impl : public std::enable_shared_from_this<PoolAllocator::Impl> {
+    struct Bin {
+        std::mutex mutex;
+        std::vector<void*> blocks;
+    };
+
+    // Blocks of the small classes deallocated by the thread. They are returned to the pool on the thread exit or freed
+    // if the pool doesn't exist anymore.
+    struct ThreadCache {
+        ThreadCache(uint64_t id, const std::shared_ptr<Impl>& pool) : id(id), pool(pool) {}
+
+        ~ThreadCache() {
+            auto owner = pool.lock();
+            for (auto& bin : bins) {
+                for (auto block : bin) {
+                    if (owner) {
+                        owner->cached_bytes.fetch_sub(get_header(block)->size, std::memory_order_relaxed);
+                        owner->release(block);
+                    } else {
+                        free_block(block);
+                    }
+                }
+            }
+        }
+
+        const uint64_t id;
+        const std::weak_ptr<Impl> pool;
+        std::array<std::vector<void*>, thread_cached_classes> bins;
+    };
+
+    explicit Impl(size_t max_cached_bytes) : id(next_id++), max_cached_bytes(max_cached_bytes) {}
+
+    ~Impl() {
+        release_bins();
+    }
+
+    ThreadCache& thread_cache() {
+        thread_local std::vector<std::unique_ptr<ThreadCache>> caches;
+        for (const auto& cache : caches) {
+            if (cache->id == id)
+                return *cache;
+        }
+        // caches of the destroyed pools are dropped here
+        for (auto it = caches.begin(); it != caches.end();) {
+            it = (*it)->pool.expired() ? caches.erase(it) : it + 1;
+        }
+        caches.emplace_back(new ThreadCache(id, shared_from_this()));
+        return *caches.back();
+    }
+
+    void* take(const size_t size_class) {
+        if (size_class < thread_cached_classes) {
+            auto& blocks = thread_cache().bins[size_class];
+            if (!blocks.empty()) {
+                auto block = blocks.back();
+                blocks.pop_back();
+                return block;
+            }
+        }
+        auto& bin = bins[size_class];
+        std::lock_guard<std::mutex> lock(bin.mutex);
+        if (bin.blocks.empty())
+            return nullptr;
+        auto block = bin.blocks.back();
+        bin.blocks.pop_back();
+        return block;
+    }
+
+    // Keeps the block in the pool or frees it if the pool is full. The block is not counted in cached_bytes.
+    void release(void* block) {
+        const auto header = get_header(block);
+        if (cached_bytes.fetch_add(header->size, std::memory_order_relaxed) + header->size > max_cached_bytes) {
+            cached_bytes.fetch_sub(header->size, std::memory_order_relaxed);
+            free_block(block);
+            return;
+        }
+        auto& bin = bins[header->size_class];
+        std::lock_guard<std::mutex> lock(bin.mutex);
+        bin.blocks.push_back(block);
+    }
+
+    void put(void* block) {
+        const auto header = get_header(block);
+        if (header->size_class < thread_cached_classes) {
+            auto& blocks = thread_cache().bins[header->size_class];
+            if (blocks.size() < thread_cache_blocks) {
+                if (cached_bytes.fetch_add(header->size, std::memory_order_relaxed) + header->size <= max_cached_bytes) {
+                    blocks.push_back(block);
+                } else {
+                    cached_bytes.fetch_sub(header->size, std::memory_order_relaxed);
+                    free_block(block);
+                }
+                return;
+            }
+        }
+        release(block);
+    }
+
+    void release_bins() {
+        for (auto& bin : bins) {
+            std::lock_guard<std::mutex> lock(bin.mutex);
+            for (auto block : bin.blocks) {
+                cached_bytes.fetch_sub(get_header(block)->size, std::memory_order_relaxed);
+                free_block(block);
+            }
+            bin.blocks.clear();
+        }
+    }
+
+    void add_live_bytes(const size_t size) {
+        const auto live = live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+        auto high_water = high_water_mark.load(std::memory_order_relaxed);
+        while (live > high_water &&
+               !high_water_mark.compare_exchange_weak(high_water, live, std::memory_order_relaxed)) {
+        }
+    }
+
+    static std::atomic<uint64_t> next_id;
+
+    const uint64_t id;
+    const size_t max_cached_bytes;
+    std::array<Bin, num_classes> bins;
+
+    std::atomic<size_t> live_bytes{0};
+    std::atomic<size_t> high_water_mark{0};
+    std::atomic<size_t> cached_bytes{0};
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> pool_hits{0};
+};
+
+std::atomic<uint64_t> PoolAllocator::Impl::next_id{0};
+
+PoolAllocator::PoolAllocator(size_t max_cached_bytes) : _impl{std::make_shared<Impl>(max_cached_bytes)} {}
+
+PoolAllocator::~PoolAllocator() {
+    _impl = {};
+}
+
+void* PoolAllocator::allocate(const size_t bytes, const size_t alignment) {
+    OPENVINO_ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0,
+                    "Alignment must be a power of two. alignment: ",
+                    alignment);
+    size_t size = 0;
+    auto size_class = get_size_class(bytes, size);
+    if (alignment > min_alignment)
+        size_class = no_class;
+
+    _impl->allocations.fetch_add(1, std::memory_order_relaxed);
+    void* block = size_class != no_class ? _impl->take(size_class) : nullptr;
+    if (block) {
+        _impl->pool_hits.fetch_add(1, std::memory_order_relaxed);
+        _impl->cached_bytes.fetch_sub(size, std::memory_order_relaxed);
+    } else {
+        block = allocate_block(size, std::max(alignment, min_alignment), size_class);
+    }
+    _impl->add_live_bytes(size);
+    return block;
+}
+
+void PoolAllocator::deallocate(void* handle, const size_t bytes, size_t) {
+    if (handle == nullptr)
+        return;
+    const auto header = get_header(handle);
+    OPENVINO_ASSERT(bytes <= header->size,
+                    "Deallocated size is larger than the allocated one. bytes: ",
+                    bytes,
+                    ", allocated: ",
+                    header->size);
+    _impl->live_bytes.fetch_sub(header->size, std::memory_order_relaxed);
+    if (header->size_class == no_class) {
+        free_block(handle);
+    } else {
+        _impl->put(handle);
+    }
+}
+
+bool PoolAllocator::is_equal(const AllocatorImpl& other) const {
+    auto other_pool = dynamic_cast<const PoolAllocator*>(&other);
+    return other_pool != nullptr && other_pool->_impl == _impl;
+}
+
+PoolAllocatorStatistics PoolAllocator::get_statistics() const {
+    PoolAllocatorStatistics statistics;
+    statistics.live_bytes = _impl->live_bytes.load(std::memory_order_relaxed);
+    statistics.high_water_mark = _impl->high_water_mark.load(std::memory_order_relaxed);
+    statistics.cached_bytes = _impl->cached_bytes.load(std::memory_order_relaxed);
+    statistics.allocations = _impl->allocations.load(std::memory_order_relaxed);
+    statistics.pool_hits = _impl->pool_hits.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+void PoolAllocator::release_cached_memory() {
+    for (auto& blocks : _impl->thread_cache().bins) {
+        for (auto block : blocks) {
+            _impl->cached_bytes.fetch_sub(get_header(block)->size, std::memory_order_relaxed);
+            free_block(block);
+        }
+        blocks.clear();
+    }
+    _impl->release_bins();
+}
+
+}  // namespace ov
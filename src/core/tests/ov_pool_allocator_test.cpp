@@ -0,0 +1,104 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/pool_allocator.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+using OVPoolAllocatorTest = ::testing::Test;
+
+TEST_F(OVPoolAllocatorTest, allocationsAreAligned) {
+    ov::PoolAllocator pool;
+    for (size_t alignment : {1, 16, 64, 4096}) {
+        void* ptr = pool.allocate(100, alignment);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % std::max<size_t>(alignment, 64), 0);
+        pool.deallocate(ptr, 100, alignment);
+    }
+    ASSERT_THROW(pool.allocate(64, 3), ov::Exception);
+}
+
+TEST_F(OVPoolAllocatorTest, deallocatedMemoryIsReused) {
+    ov::PoolAllocator pool;
+    void* ptr = pool.allocate(1000);
+    pool.deallocate(ptr, 1000);
+    // the same size class
+    void* reused = pool.allocate(1020);
+    EXPECT_EQ(ptr, reused);
+    pool.deallocate(reused, 0);
+
+    const auto statistics = pool.get_statistics();
+    EXPECT_EQ(statistics.allocations, 2);
+    EXPECT_EQ(statistics.pool_hits, 1);
+    EXPECT_EQ(statistics.live_bytes, 0);
+    EXPECT_EQ(statistics.high_water_mark, 1024);
+    EXPECT_EQ(statistics.cached_bytes, 1024);
+}
+
+TEST_F(OVPoolAllocatorTest, cachedMemoryIsLimited) {
+    ov::PoolAllocator pool(4096);
+    std::vector<void*> ptrs;
+    for (size_t i = 0; i < 4; i++) {
+        ptrs.push_back(pool.allocate(2048));
+    }
+    EXPECT_EQ(pool.get_statistics().live_bytes, 4 * 2048);
+    for (auto ptr : ptrs) {
+        pool.deallocate(ptr, 2048);
+    }
+    EXPECT_EQ(pool.get_statistics().cached_bytes, 4096);
+    EXPECT_EQ(pool.get_statistics().high_water_mark, 4 * 2048);
+
+    pool.release_cached_memory();
+    EXPECT_EQ(pool.get_statistics().cached_bytes, 0);
+}
+
+TEST_F(OVPoolAllocatorTest, memoryCanBeDeallocatedByOtherThreads) {
+    auto pool = std::make_shared<ov::PoolAllocator>();
+    std::vector<void*> ptrs(64);
+    for (auto& ptr : ptrs) {
+        ptr = pool->allocate(512 * 1024);
+    }
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 4; t++) {
+        threads.emplace_back([&, t] {
+            for (size_t i = t; i < ptrs.size(); i += 4) {
+                pool->deallocate(ptrs[i], 0);
+            }
+            for (size_t i = 0; i < 1000; i++) {
+                pool->deallocate(pool->allocate(i * 100), 0);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto statistics = pool->get_statistics();
+    EXPECT_EQ(statistics.live_bytes, 0);
+    EXPECT_EQ(statistics.allocations, 64 + 4 * 1000);
+    EXPECT_GT(statistics.pool_hits, 0);
+}
+
+TEST_F(OVPoolAllocatorTest, canBeUsedByTensors) {
+    auto pool = std::make_shared<ov::PoolAllocator>();
+    ov::Allocator allocator(pool);
+    EXPECT_TRUE(allocator == ov::Allocator(pool));
+    EXPECT_FALSE(allocator == ov::Allocator(std::make_shared<ov::PoolAllocator>()));
+    EXPECT_FALSE(allocator == ov::Allocator());
+    void* data = nullptr;
+    {
+        ov::Tensor tensor(ov::element::f32, {1, 3, 16, 16}, allocator);
+        data = tensor.data();
+        EXPECT_EQ(pool->get_statistics().live_bytes, 3 * 16 * 16 * 4);
+    }
+    EXPECT_EQ(pool->get_statistics().live_bytes, 0);
+    ov::Tensor tensor(ov::element::f32, {1, 3, 16, 16}, allocator);
+    EXPECT_EQ(tensor.data(), data);
+    EXPECT_EQ(pool->get_statistics().pool_hits, 1);
+}
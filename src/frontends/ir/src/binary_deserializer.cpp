@@ -0,0 +1,386 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "binary_deserializer.hpp"
+
+#include <set>
+#include <unordered_set>
+
+#include "ie_common.h"
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/sink.hpp"
+#include "openvino/op/util/assign_base.hpp"
+#include "openvino/op/util/read_value_base.hpp"
+#include "openvino/util/parallel_for.hpp"
+#include "transformations/rt_info/attributes.hpp"
+#include "utils.hpp"
+
+using namespace ov::binary_ir;
+
+namespace ov {
+namespace {
+
+class BinaryAttributeReader : public ov::AttributeVisitor {
+public:
+    BinaryAttributeReader(BinaryDeserializer& model, const Range& attributes)
+        : m_model(model),
+          m_attributes(model.get_attributes(attributes)),
+          m_count(attributes.count) {}
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        const auto attribute = find(name);
+        if (!attribute)
+            return;
+        if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::op::util::Variable>>>(&adapter)) {
+            check_type(*attribute, AttributeType::Variable, name);
+            a->set(m_model.get_variable(m_model.get_string(static_cast<uint32_t>(attribute->value))));
+        } else if (auto a =
+                       ov::as_type<ov::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            check_type(*attribute, AttributeType::Buffer, name);
+            a->set(m_model.get_weights(attribute->value, attribute->size));
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::element::TypeVector>>(&adapter)) {
+            check_type(*attribute, AttributeType::ElementTypeVector, name);
+            const auto ids = m_model.get_data<uint32_t>(attribute->value, attribute->size);
+            ov::element::TypeVector types;
+            for (uint64_t i = 0; i < attribute->size; ++i)
+                types.emplace_back(ov::as_enum<ov::element::Type_t>(m_model.get_string(ids[i])));
+            a->set(types);
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::PartialShape>>(&adapter)) {
+            check_type(*attribute, AttributeType::PartialShape, name);
+            const auto values = m_model.get_data<int64_t>(attribute->value, attribute->size);
+            if (attribute->size == 0 || (values[0] >= 0 && attribute->size != 1 + 2 * static_cast<uint64_t>(values[0])))
+                m_model.throw_error("incorrect shape of the attribute " + name);
+            if (values[0] < 0) {
+                a->set(ov::PartialShape::dynamic());
+            } else {
+                std::vector<ov::Dimension> dims;
+                dims.reserve(values[0]);
+                for (int64_t i = 0; i < values[0]; ++i)
+                    dims.emplace_back(values[1 + 2 * i], values[2 + 2 * i]);
+                a->set(ov::PartialShape(dims));
+            }
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::Dimension>>(&adapter)) {
+            check_type(*attribute, AttributeType::Dimension, name);
+            if (attribute->size != 2)
+                m_model.throw_error("incorrect dimension of the attribute " + name);
+            const auto values = m_model.get_data<int64_t>(attribute->value, attribute->size);
+            a->set(ov::Dimension(values[0], values[1]));
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<std::set<std::string>>>(&adapter)) {
+            const auto strings = get_strings(*attribute, name);
+            a->set(std::set<std::string>(strings.begin(), strings.end()));
+        } else {
+            m_model.throw_error("attribute adapter can not be found for " + name + " parameter");
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        if (const auto attribute = find(name, AttributeType::Bool))
+            adapter.set(attribute->value != 0);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        if (const auto attribute = find(name, AttributeType::String))
+            adapter.set(m_model.get_string(static_cast<uint32_t>(attribute->value)));
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        if (const auto attribute = find(name, AttributeType::Int64))
+            adapter.set(static_cast<int64_t>(attribute->value));
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        if (const auto attribute = find(name, AttributeType::Double)) {
+            double value;
+            std::memcpy(&value, &attribute->value, sizeof(value));
+            adapter.set(value);
+        }
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        set_vector(name, AttributeType::Int32Vector, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        set_vector(name, AttributeType::Int64Vector, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        set_vector(name, AttributeType::UInt64Vector, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        set_vector(name, AttributeType::FloatVector, adapter);
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        if (const auto attribute = find(name))
+            adapter.set(get_strings(*attribute, name));
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        m_model.throw_error("operations with bodies are not supported");
+    }
+
+private:
+    const AttributeRecord* find(const std::string& name) const {
+        for (size_t i = 0; i < m_count; ++i) {
+            if (m_model.string_equals(m_attributes[i].name, name))
+                return m_attributes + i;
+        }
+        return nullptr;
+    }
+
+    const AttributeRecord* find(const std::string& name, AttributeType type) const {
+        const auto attribute = find(name);
+        if (attribute)
+            check_type(*attribute, type, name);
+        return attribute;
+    }
+
+    void check_type(const AttributeRecord& attribute, AttributeType type, const std::string& name) const {
+        if (attribute.type != type)
+            m_model.throw_error("unexpected type of the attribute " + name);
+    }
+
+    std::vector<std::string> get_strings(const AttributeRecord& attribute, const std::string& name) const {
+        check_type(attribute, AttributeType::StringVector, name);
+        const auto ids = m_model.get_data<uint32_t>(attribute.value, attribute.size);
+        std::vector<std::string> strings;
+        strings.reserve(attribute.size);
+        for (uint64_t i = 0; i < attribute.size; ++i)
+            strings.push_back(m_model.get_string(ids[i]));
+        return strings;
+    }
+
+    template <typename T>
+    void set_vector(const std::string& name, AttributeType type, ov::ValueAccessor<std::vector<T>>& adapter) {
+        if (const auto attribute = find(name, type)) {
+            const auto data = m_model.get_data<T>(attribute->value, attribute->size);
+            adapter.set(std::vector<T>(data, data + attribute->size));
+        }
+    }
+
+    BinaryDeserializer& m_model;
+    const AttributeRecord* m_attributes;
+    size_t m_count;
+};
+
+}  // namespace
+
+BinaryDeserializer::BinaryDeserializer(
+    const std::shared_ptr<ov::util::MappedMemory>& model,
+    const std::unordered_map<std::string, ov::OpSet>& opsets,
+    const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
+    : m_model(model),
+      m_data(model->data()),
+      m_size(model->size()),
+      m_opsets(opsets),
+      m_extensions(extensions) {
+    if (!has_magic(m_data, m_size))
+        throw_error("the file is not a binary model");
+    if (reinterpret_cast<uintptr_t>(m_data) % alignof(Header) != 0)
+        throw_error("the model memory is not aligned");
+    m_header = reinterpret_cast<const Header*>(m_data);
+    // the other byte order is detected first, as the version is not readable in this case
+    if (m_header->byte_order != byte_order_mark)
+        throw_error("the model is written in the other byte order");
+    if (m_header->version != format_version)
+        throw_error("unsupported version " + std::to_string(m_header->version));
+
+    m_strings = get_table<StringRecord>(m_header->strings, m_strings_count);
+    size_t string_data_size;
+    get_table<char>(m_header->string_data, string_data_size);
+    m_nodes = get_table<NodeRecord>(m_header->nodes, m_nodes_count);
+    m_inputs = get_table<InputRecord>(m_header->inputs, m_inputs_count);
+    m_outputs = get_table<OutputRecord>(m_header->outputs, m_outputs_count);
+    m_attributes = get_table<AttributeRecord>(m_header->attributes, m_attributes_count);
+    m_rt_info = get_table<RTInfoRecord>(m_header->rt_info, m_rt_info_count);
+    size_t attribute_data_size;
+    get_table<char>(m_header->attribute_data, attribute_data_size);
+    m_indices = get_table<uint32_t>(m_header->indices, m_indices_count);
+    size_t weights_size;
+    get_table<char>(m_header->weights, weights_size);
+}
+
+void BinaryDeserializer::throw_error(const std::string& message) const {
+    IE_THROW() << "Error reading the binary model: " << message;
+}
+
+std::string BinaryDeserializer::get_string(uint32_t id) const {
+    if (id >= m_strings_count)
+        throw_error("the string id is out of the table");
+    const auto& record = m_strings[id];
+    if (record.offset > m_header->string_data.size || record.size > m_header->string_data.size - record.offset)
+        throw_error("the string is out of the section");
+    return std::string(m_data + m_header->string_data.offset + record.offset, record.size);
+}
+
+bool BinaryDeserializer::string_equals(uint32_t id, const std::string& str) const {
+    if (id >= m_strings_count)
+        throw_error("the string id is out of the table");
+    const auto& record = m_strings[id];
+    if (record.offset > m_header->string_data.size || record.size > m_header->string_data.size - record.offset)
+        throw_error("the string is out of the section");
+    return record.size == str.size() &&
+           std::memcmp(m_data + m_header->string_data.offset + record.offset, str.data(), str.size()) == 0;
+}
+
+std::shared_ptr<ov::op::util::Variable> BinaryDeserializer::get_variable(const std::string& variable_id) {
+    // the attributes of the operations are read in parallel, while the variables are shared
+    std::lock_guard<std::mutex> lock(m_variables_mutex);
+    auto& variable = m_variables[variable_id];
+    if (!variable) {
+        variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{ov::PartialShape::dynamic(), ov::element::dynamic, variable_id});
+    }
+    return variable;
+}
+
+std::shared_ptr<ngraph::runtime::AlignedBuffer> BinaryDeserializer::get_weights(uint64_t offset, uint64_t size) const {
+    if (offset > m_header->weights.size || size > m_header->weights.size - offset)
+        throw_error("the constant is out of the weights section");
+    // the constants point to the model memory, so it is kept alive while they are used
+    auto data = const_cast<char*>(m_data) + m_header->weights.offset + offset;
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(data,
+                                                                                                     size,
+                                                                                                     m_model);
+}
+
+void BinaryDeserializer::set_runtime_info(ov::RTMap& rt_info, const Range& range) const {
+    if (!range.count)
+        return;
+    ov::pass::Attributes attrs_factory;
+    const auto records = get_range(m_rt_info, m_rt_info_count, range);
+    for (uint32_t i = 0; i < range.count; ++i) {
+        const auto name = get_string(records[i].name);
+        const auto version = get_string(records[i].version);
+        const auto type_info = ov::DiscreteTypeInfo(name.c_str(), 0, version.c_str());
+        auto attr = attrs_factory.create_by_type_info(type_info);
+        // As runtime attributes are optional, the unknown ones are skipped
+        if (attr.empty() || !attr.is<ov::RuntimeAttribute>())
+            continue;
+        BinaryAttributeReader visitor(const_cast<BinaryDeserializer&>(*this), records[i].attributes);
+        if (!attr.as<ov::RuntimeAttribute>().visit_attributes(visitor))
+            throw_error("visit_attributes is not supported for " + name + " attribute");
+        if (!rt_info.emplace(type_info, attr).second)
+            throw_error("multiple rt_info attributes are detected: " + name);
+    }
+}
+
+std::shared_ptr<ov::Model> BinaryDeserializer::read() {
+    struct OpsetNode {
+        std::shared_ptr<ov::Node> node;
+        bool attributes_visited = false;
+    };
+    std::vector<OpsetNode> opset_nodes(m_nodes_count);
+
+    // Operations and their attributes don't depend on the other nodes, so they are created in parallel,
+    // while connecting them and the shape inference follow the topological order of the nodes table
+    ov::util::parallel_for(m_nodes_count, [&](size_t i) {
+        const auto& record = m_nodes[i];
+        const auto type_name = get_string(record.type);
+        const auto version = get_string(record.version);
+        if (m_extensions.count(ov::DiscreteTypeInfo(type_name.c_str(), 0, version.c_str())))
+            return;
+        const auto opset = m_opsets.find(version);
+        if (opset == m_opsets.end())
+            throw_error("cannot create " + type_name + " operation from unsupported opset " + version);
+        std::shared_ptr<ov::Node> node(opset->second.create_insensitive(type_name));
+        if (!node)
+            throw_error("opset " + version + " doesn't contain the operation with type: " + type_name);
+        // Share weights with the model memory
+        if (auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(node))
+            constant->alloc_buffer_on_visit_attributes(false);
+        BinaryAttributeReader visitor(*this, record.attributes);
+        opset_nodes[i].attributes_visited = node->visit_attributes(visitor);
+        opset_nodes[i].node = node;
+    });
+
+    std::vector<std::shared_ptr<ov::Node>> nodes(m_nodes_count);
+    std::unordered_map<std::string, std::shared_ptr<ov::Node>> variable_id_to_read_value;
+    for (size_t i = 0; i < m_nodes_count; ++i) {
+        const auto& record = m_nodes[i];
+        const auto inputs_records = get_range(m_inputs, m_inputs_count, record.inputs);
+        ov::OutputVector inputs(record.inputs.count);
+        for (uint32_t j = 0; j < record.inputs.count; ++j) {
+            const auto& input = inputs_records[j];
+            if (input.node >= i || input.port >= nodes[input.node]->get_output_size())
+                throw_error("incorrect input " + std::to_string(j) + " of " + get_string(record.name));
+            inputs[j] = nodes[input.node]->output(input.port);
+        }
+
+        std::shared_ptr<ov::Node> node;
+        if (opset_nodes[i].node) {
+            node = opset_nodes[i].node;
+            node->set_arguments(inputs);
+            if (opset_nodes[i].attributes_visited)
+                node->constructor_validate_and_infer_types();
+            // To be sure that all default values will be initialized:
+            node = node->clone_with_new_inputs(node->input_values());
+        } else {
+            const auto type_name = get_string(record.type);
+            const auto version = get_string(record.version);
+            const auto& extension = m_extensions.at(ov::DiscreteTypeInfo(type_name.c_str(), 0, version.c_str()));
+            BinaryAttributeReader visitor(*this, record.attributes);
+            node = extension->create(inputs, visitor).at(0).get_node_shared_ptr();
+        }
+
+        node->set_friendly_name(get_string(record.name));
+        set_runtime_info(node->get_rt_info(), record.rt_info);
+        for (uint32_t j = 0; j < record.inputs.count; ++j)
+            set_runtime_info(node->input(j).get_rt_info(), inputs_records[j].rt_info);
+
+        const auto outputs_records = get_range(m_outputs, m_outputs_count, record.outputs);
+        for (uint32_t j = 0; j < record.outputs.count && j < node->get_output_size(); ++j) {
+            const auto& output = outputs_records[j];
+            if (output.names.count) {
+                const auto ids = get_range(m_indices, m_indices_count, output.names);
+                std::unordered_set<std::string> names;
+                for (uint32_t k = 0; k < output.names.count; ++k)
+                    names.insert(get_string(ids[k]));
+                node->get_output_tensor(j).set_names(names);
+            }
+            set_runtime_info(node->output(j).get_rt_info(), output.rt_info);
+        }
+
+        if (const auto& read_value = std::dynamic_pointer_cast<ov::op::util::ReadValueBase>(node))
+            variable_id_to_read_value[read_value->get_variable_id()] = read_value;
+        nodes[i] = node;
+    }
+
+    auto get_nodes = [&](const Range& range) {
+        const auto ids = get_range(m_indices, m_indices_count, range);
+        std::vector<std::shared_ptr<ov::Node>> result;
+        for (uint32_t i = 0; i < range.count; ++i) {
+            if (ids[i] >= nodes.size())
+                throw_error("the node index is out of the table");
+            result.push_back(nodes[ids[i]]);
+        }
+        return result;
+    };
+    ov::ParameterVector parameters;
+    for (const auto& node : get_nodes(m_header->parameters)) {
+        parameters.push_back(std::dynamic_pointer_cast<ov::op::v0::Parameter>(node));
+        if (!parameters.back())
+            throw_error(node->get_friendly_name() + " is not a Parameter");
+    }
+    ov::ResultVector results;
+    for (const auto& node : get_nodes(m_header->results)) {
+        results.push_back(std::dynamic_pointer_cast<ov::op::v0::Result>(node));
+        if (!results.back())
+            throw_error(node->get_friendly_name() + " is not a Result");
+    }
+    ov::SinkVector sinks;
+    for (const auto& node : get_nodes(m_header->sinks)) {
+        sinks.push_back(std::dynamic_pointer_cast<ov::op::Sink>(node));
+        if (!sinks.back())
+            throw_error(node->get_friendly_name() + " is not a Sink");
+        if (const auto& assign = std::dynamic_pointer_cast<ov::op::util::AssignBase>(node)) {
+            const auto read_value = variable_id_to_read_value.find(assign->get_variable_id());
+            if (read_value != variable_id_to_read_value.end())
+                assign->add_control_dependency(read_value->second);
+        }
+    }
+
+    auto model = std::make_shared<ov::Model>(results, sinks, parameters, get_string(m_header->name));
+    model->get_rt_info()["version"] = int64_t(11);
+    return model;
+}
+
+}  // namespace ov
@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "binary_ir_format.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/core/op_extension.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "openvino/opsets/opset.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+namespace ov {
+
+/**
+ * @brief Reads the model of the binary format written by ov::pass::BinarySerialize. The tables are used in place,
+ * the constants share the data with the model memory
+ */
+class BinaryDeserializer {
+public:
+    BinaryDeserializer(const std::shared_ptr<ov::util::MappedMemory>& model,
+                       const std::unordered_map<std::string, ov::OpSet>& opsets,
+                       const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions);
+
+    std::shared_ptr<ov::Model> read();
+
+    std::string get_string(uint32_t id) const;
+    bool string_equals(uint32_t id, const std::string& str) const;
+
+    template <typename T>
+    const T* get_data(uint64_t offset, uint64_t count) const {
+        if (offset % alignof(T) != 0 || offset > m_header->attribute_data.size ||
+            count > (m_header->attribute_data.size - offset) / sizeof(T))
+            throw_error("attribute data is out of the section");
+        return reinterpret_cast<const T*>(m_data + m_header->attribute_data.offset + offset);
+    }
+
+    const binary_ir::AttributeRecord* get_attributes(const binary_ir::Range& range) const {
+        return get_range(m_attributes, m_attributes_count, range);
+    }
+
+    std::shared_ptr<ov::op::util::Variable> get_variable(const std::string& variable_id);
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> get_weights(uint64_t offset, uint64_t size) const;
+
+    [[noreturn]] void throw_error(const std::string& message) const;
+
+private:
+    template <typename T>
+    const T* get_table(const binary_ir::Section& section, size_t& count) const {
+        if (section.offset % alignof(T) != 0 || section.offset > m_size || section.size > m_size - section.offset ||
+            section.size % sizeof(T) != 0)
+            throw_error("the section is out of the file");
+        count = section.size / sizeof(T);
+        return reinterpret_cast<const T*>(m_data + section.offset);
+    }
+
+    template <typename T>
+    const T* get_range(const T* table, size_t count, const binary_ir::Range& range) const {
+        if (range.first > count || range.count > count - range.first)
+            throw_error("the range is out of the table");
+        return table + range.first;
+    }
+
+    void set_runtime_info(ov::RTMap& rt_info, const binary_ir::Range& range) const;
+
+    std::shared_ptr<ov::util::MappedMemory> m_model;
+    const char* m_data;
+    size_t m_size;
+    const binary_ir::Header* m_header = nullptr;
+
+    const binary_ir::StringRecord* m_strings;
+    size_t m_strings_count;
+    const binary_ir::NodeRecord* m_nodes;
+    size_t m_nodes_count;
+    const binary_ir::InputRecord* m_inputs;
+    size_t m_inputs_count;
+    const binary_ir::OutputRecord* m_outputs;
+    size_t m_outputs_count;
+    const binary_ir::AttributeRecord* m_attributes;
+    size_t m_attributes_count;
+    const binary_ir::RTInfoRecord* m_rt_info;
+    size_t m_rt_info_count;
+    const uint32_t* m_indices;
+    size_t m_indices_count;
+
+    const std::unordered_map<std::string, ov::OpSet>& m_opsets;
+    const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& m_extensions;
+    std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>> m_variables;
+    std::mutex m_variables_mutex;
+};
+
+}  // namespace ov
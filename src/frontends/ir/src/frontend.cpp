@@ -7,12 +7,13 @@
 #include <array>
 #include <vector>
 
+#include "binary_ir_format.hpp"
 #include "input_model.hpp"
-#include "mmap_object.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "so_extension.hpp"
 #include "xml_parse_utils.h"
 
@@ -58,6 +59,49 @@ size_t GetIRVersion(std::istream& model) {
     return 0;
 }
 
+/**
+ * @brief Checks whether the model stream contains the binary model written by ov::pass::BinarySerialize
+ */
+bool is_binary_model(std::istream& model) {
+    std::array<char, sizeof(ov::binary_ir::Header)> header{};
+
+    model.seekg(0, model.beg);
+    model.read(header.data(), header.size());
+    const auto read_size = static_cast<size_t>(model.gcount());
+    model.clear();
+    model.seekg(0, model.beg);
+
+    return ov::binary_ir::has_magic(header.data(), read_size);
+}
+
+/**
+ * @brief Binary model read from a stream, used by the model as the memory mapping of the file
+ */
+class StreamMemory : public ov::util::MappedMemory {
+public:
+    explicit StreamMemory(std::istream& model) {
+        model.seekg(0, model.end);
+        const auto size = static_cast<size_t>(model.tellg());
+        model.seekg(0, model.beg);
+
+        m_buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(size);
+        model.read(m_buffer->get_ptr<char>(), size);
+        if (static_cast<size_t>(model.gcount()) != size)
+            IE_THROW() << "Binary model cannot be read from the stream!";
+    }
+
+    char* data() noexcept override {
+        return m_buffer->get_ptr<char>();
+    }
+
+    size_t size() const noexcept override {
+        return m_buffer->size();
+    }
+
+private:
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> m_buffer;
+};
+
 }  // namespace
 
 bool FrontEnd::supported_impl(const std::vector<ov::Any>& variants) const {
@@ -89,8 +133,12 @@ bool FrontEnd::supported_impl(const std::vector<ov::Any>& variants) const {
 
     size_t version;
     if (provided_model_stream) {
+        if (is_binary_model(*provided_model_stream))
+            return true;
         version = GetIRVersion(*provided_model_stream);
     } else if (local_model_stream.is_open()) {
+        if (is_binary_model(local_model_stream))
+            return true;
         version = GetIRVersion(local_model_stream);
         local_model_stream.close();
     } else {
@@ -163,6 +211,16 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
         provided_model_stream = model_variant.as<std::istringstream*>();
     }
 
+    // The binary model contains the weights and is read from the memory mapping of the file without parsing
+    if (local_model_stream.is_open() && is_binary_model(local_model_stream)) {
+        local_model_stream.close();
+        return std::make_shared<InputModel>(ov::util::load_mmap_object(model_path), create_extensions_map());
+    }
+    if (provided_model_stream && is_binary_model(*provided_model_stream)) {
+        return std::make_shared<InputModel>(std::make_shared<StreamMemory>(*provided_model_stream),
+                                            create_extensions_map());
+    }
+
     // Check weights and extensions
     for (size_t variant_id = 1; variant_id < variants.size(); ++variant_id) {
         const auto& variant = variants.at(variant_id);
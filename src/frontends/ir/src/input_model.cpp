@@ -6,6 +6,7 @@
 
 #include <xml_parse_utils.h>
 
+#include <binary_deserializer.hpp>
 #include <ir_deserializer.hpp>
 #include <ngraph/opsets/opset1.hpp>
 #include <openvino/op/util/framework_node.hpp>
@@ -221,7 +222,35 @@ InputModel::InputModel(std::istream& stream,
     _impl = std::make_shared<InputModelIRImpl>(stream, weights, extensions);
 }
 
+class InputModel::InputModelBinaryImpl {
+    std::shared_ptr<ov::util::MappedMemory> m_model;
+    std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> m_extensions;
+    std::unordered_map<std::string, ov::OpSet> m_opsets;
+
+public:
+    InputModelBinaryImpl(const std::shared_ptr<ov::util::MappedMemory>& model,
+                         const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
+        : m_model(model),
+          m_extensions(extensions) {
+        for (const auto& it : ov::get_available_opsets()) {
+            m_opsets[it.first] = it.second();
+        }
+    }
+
+    std::shared_ptr<Function> convert() {
+        ov::BinaryDeserializer deserializer(m_model, m_opsets, m_extensions);
+        return deserializer.read();
+    }
+};
+
+InputModel::InputModel(const std::shared_ptr<ov::util::MappedMemory>& model,
+                       const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions) {
+    _binary_impl = std::make_shared<InputModelBinaryImpl>(model, extensions);
+}
+
 std::shared_ptr<Function> InputModel::convert() {
+    if (_binary_impl)
+        return _binary_impl->convert();
     return _impl->convert();
 }
 
@@ -10,6 +10,7 @@
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "openvino/frontend/manager.hpp"
 #include "openvino/frontend/visibility.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ov {
 namespace frontend {
@@ -18,13 +19,19 @@ namespace ir {
 class InputModel : public ov::frontend::InputModel {
     friend class FrontEnd;
     class InputModelIRImpl;
+    class InputModelBinaryImpl;
     std::shared_ptr<InputModelIRImpl> _impl;
+    std::shared_ptr<InputModelBinaryImpl> _binary_impl;
 
 public:
     InputModel(std::istream& stream,
                const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
                const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions);
 
+    /// \brief Creates the input model of the binary format written by ov::pass::BinarySerialize
+    InputModel(const std::shared_ptr<ov::util::MappedMemory>& model,
+               const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions);
+
     std::shared_ptr<Model> convert();
 };
 
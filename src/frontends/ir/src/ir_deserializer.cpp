@@ -4,6 +4,7 @@
 
 #include "ir_deserializer.hpp"
 
+#include <mutex>
 #include <pugixml.hpp>
 #include <regex>
 
@@ -12,6 +13,7 @@
 #include "ngraph/op/util/framework_node.hpp"
 #include "ngraph/opsets/opset1.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/util/parallel_for.hpp"
 #include "rt_info_deserializer.hpp"
 #include "transformations/rt_info/attributes.hpp"
 #include "utils.hpp"
@@ -309,6 +311,9 @@ void XmlDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<
         std::string variable_id;
         if (!getStrAttribute(m_node.child("data"), name, variable_id))
             return;
+        // the attributes of the layers are read in parallel, while the variables are shared
+        static std::mutex variables_mutex;
+        std::lock_guard<std::mutex> lock(variables_mutex);
         if (!m_variables.count(variable_id)) {
             m_variables[variable_id] = std::make_shared<ngraph::Variable>(
                 ngraph::VariableInfo{ngraph::PartialShape::dynamic(), ngraph::element::dynamic, variable_id});
@@ -470,6 +475,24 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     };
     std::for_each(outputs.begin(), outputs.end(), dfs);
 
+    // OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ReadAttributes");
+
+    // Operations and their attributes don't depend on the other layers, so they are created in parallel,
+    // while connecting them and the shape inference follow the topological order below
+    struct opset_node {
+        std::shared_ptr<ngraph::Node> node;
+        bool attributes_visited = false;
+    };
+    std::vector<opset_node> opset_nodes(order.size());
+    ov::util::parallel_for(order.size(), [&](size_t i) {
+        const auto p = params.find(order[i]);
+        if (p == params.end())
+            return;
+        auto& opset_node = opset_nodes[i];
+        opset_node.node =
+            createNodeFromOpset(p->second.xml, weights, p->second.params, opset_node.attributes_visited);
+    });
+
     // OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphNodes");
 
     FunctionNodes func_nodes;
@@ -477,7 +500,8 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
 
     //  Following topological order create nGraph operations
-    for (auto& layer_id : order) {
+    for (size_t order_idx = 0; order_idx < order.size(); order_idx++) {
+        const auto layer_id = order[order_idx];
         auto& p = params[layer_id];
         const auto& edgeIt = edges.find(layer_id);
         if (edgeIt == edges.end())
@@ -496,7 +520,8 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
             inputs[realInputPortId] = input_node->output(p_output.getRealOutputPortId(e.fromPortId));
         }
 
-        auto node = createNode(inputs, p.xml, weights, p.params);
+        const auto& opset_node = opset_nodes[order_idx];
+        auto node = createNode(inputs, p.xml, weights, p.params, opset_node.node, opset_node.attributes_visited);
         id_to_node[layer_id] = node;
 
         // Check that output shape after OpenVINO node validation the same as in IR
@@ -686,8 +711,7 @@ GenericLayerParams XmlDeserializer::parseGenericParams(const pugi::xml_node& nod
         FOREACH_CHILD (node, parentNode, "dim") {
             int64_t dim = 0;
             const pugi::char_t* dimVal = node.child_value();
-            std::stringstream ss(dimVal);
-            if (!(ss >> dim) || dim < -1) {
+            if (!parse_integer(dimVal, dimVal + std::strlen(dimVal), dim) || dim < -1) {
                 IE_THROW() << "dimension (" << dimVal << ") in node " << node.name()
                            << " must be greater or equal to -1: at offset " << node.offset_debug();
             }
@@ -753,31 +777,16 @@ static const std::string& translate_type_name(const std::string& name) {
     return name;
 }
 
-std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
-    const std::vector<ngraph::Output<ngraph::Node>>& inputs,
+std::shared_ptr<ngraph::Node> XmlDeserializer::createNodeFromOpset(
     const pugi::xml_node& node,
     const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
-    const GenericLayerParams& params) {
-    // Check that inputs are correctly defined
-    for (size_t i = 0; i < inputs.size(); i++) {
-        if (!inputs[i].get_node())
-            IE_THROW() << params.type << " layer " << params.name << " with id: " << params.layerId
-                       << " has incorrect input with index " << i << "!";
-        if (ngraph::element::Type_t::undefined == inputs[i].get_element_type())
-            IE_THROW() << params.type << " layer " << params.name << " with id: " << params.layerId
-                       << " has undefined element type for input with index " << i << "!";
-    }
-
+    const GenericLayerParams& params,
+    bool& attributes_visited) {
     const std::string& type_name = translate_type_name(params.type);
 
-    std::shared_ptr<ngraph::Node> ngraphNode;
     ov::DiscreteTypeInfo type(type_name.c_str(), 0, params.version.c_str());
-    auto extensionIt = m_extensions.find(type);
-
-    if (extensionIt != m_extensions.end()) {
-        XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
-        ngraphNode = (*extensionIt->second).create(inputs, visitor).at(0).get_node_shared_ptr();
-    }
+    if (m_extensions.count(type))
+        return nullptr;
 
     // Find registered opset
     auto opsetIt = m_opsets.find(params.version);
@@ -798,32 +807,68 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
         opsetIt = m_opsets.find("opset6");
     }
 
-    if (!ngraphNode && opsetIt != m_opsets.end()) {
-        if (params.version == "opset1") {
-            // MVN, ROIPooling and ReorgYolo were missing in opset1
-            if (type_name == "MVN" || type_name == "ROIPooling" || type_name == "ReorgYolo") {
-                opsetIt = m_opsets.find("opset2");
-                if (opsetIt == m_opsets.end()) {
-                    IE_THROW() << "Cannot create " << params.type << " layer " << params.name
-                               << " id:" << params.layerId << " from unsupported opset: " << params.version;
-                }
+    if (opsetIt == m_opsets.end())
+        return nullptr;
+
+    if (params.version == "opset1") {
+        // MVN, ROIPooling and ReorgYolo were missing in opset1
+        if (type_name == "MVN" || type_name == "ROIPooling" || type_name == "ReorgYolo") {
+            opsetIt = m_opsets.find("opset2");
+            if (opsetIt == m_opsets.end()) {
+                IE_THROW() << "Cannot create " << params.type << " layer " << params.name << " id:" << params.layerId
+                           << " from unsupported opset: " << params.version;
             }
         }
+    }
 
-        auto const& opset = opsetIt->second;
+    auto const& opset = opsetIt->second;
 
-        ngraphNode = std::shared_ptr<ngraph::Node>(opset.create_insensitive(type_name));
-        if (!ngraphNode) {
-            IE_THROW() << "Opset " << params.version << " doesn't contain the operation with type: " << type_name;
-        }
-        // Share Weights form constant blob
-        if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(ngraphNode)) {
-            constant->alloc_buffer_on_visit_attributes(false);
-        }
-        ngraphNode->set_arguments(inputs);
+    std::shared_ptr<ngraph::Node> ngraphNode(opset.create_insensitive(type_name));
+    if (!ngraphNode) {
+        IE_THROW() << "Opset " << params.version << " doesn't contain the operation with type: " << type_name;
+    }
+    // Share Weights form constant blob
+    if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(ngraphNode)) {
+        constant->alloc_buffer_on_visit_attributes(false);
+    }
+    XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
+    attributes_visited = ngraphNode->visit_attributes(visitor);
+    return ngraphNode;
+}
+
+std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
+    const std::vector<ngraph::Output<ngraph::Node>>& inputs,
+    const pugi::xml_node& node,
+    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
+    const GenericLayerParams& params,
+    const std::shared_ptr<ngraph::Node>& opset_node,
+    bool attributes_visited) {
+    // Check that inputs are correctly defined
+    for (size_t i = 0; i < inputs.size(); i++) {
+        if (!inputs[i].get_node())
+            IE_THROW() << params.type << " layer " << params.name << " with id: " << params.layerId
+                       << " has incorrect input with index " << i << "!";
+        if (ngraph::element::Type_t::undefined == inputs[i].get_element_type())
+            IE_THROW() << params.type << " layer " << params.name << " with id: " << params.layerId
+                       << " has undefined element type for input with index " << i << "!";
+    }
+
+    const std::string& type_name = translate_type_name(params.type);
+
+    std::shared_ptr<ngraph::Node> ngraphNode;
+    ov::DiscreteTypeInfo type(type_name.c_str(), 0, params.version.c_str());
+    auto extensionIt = m_extensions.find(type);
+
+    if (extensionIt != m_extensions.end()) {
         XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
+        ngraphNode = (*extensionIt->second).create(inputs, visitor).at(0).get_node_shared_ptr();
+    }
 
-        if (ngraphNode->visit_attributes(visitor)) {
+    // The operation is created from the loaded opsets by createNodeFromOpset()
+    if (!ngraphNode && opset_node) {
+        ngraphNode = opset_node;
+        ngraphNode->set_arguments(inputs);
+        if (attributes_visited) {
             ngraphNode->constructor_validate_and_infer_types();
         }
 
@@ -175,10 +175,20 @@ private:
 
     GenericLayerParams parseGenericParams(const pugi::xml_node& node);
 
+    /// \brief Creates the operation from the registered opsets and reads its attributes without setting the inputs.
+    /// Doesn't depend on the other layers, so it's called for the layers in parallel.
+    /// \return nullptr if the operation is created by an extension or is not found in the opsets
+    std::shared_ptr<ov::Node> createNodeFromOpset(const pugi::xml_node& node,
+                                                  const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
+                                                  const GenericLayerParams& params,
+                                                  bool& attributes_visited);
+
     std::shared_ptr<ov::Node> createNode(const ov::OutputVector& inputs,
                                          const pugi::xml_node& node,
                                          const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
-                                         const GenericLayerParams& params);
+                                         const GenericLayerParams& params,
+                                         const std::shared_ptr<ov::Node>& opset_node,
+                                         bool attributes_visited);
 
     void read_meta_data(const std::shared_ptr<ov::Model>& model, const pugi::xml_node& meta_section);
 
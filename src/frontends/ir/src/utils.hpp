@@ -4,8 +4,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <openvino/core/partial_shape.hpp>
+#include <type_traits>
+#include <vector>
 
 #include "openvino/core/type/element_type.hpp"
 #include "xml_parse_utils.h"
@@ -19,8 +25,68 @@ bool get_partial_shape_from_attribute(const pugi::xml_node& node, const std::str
 
 void str_to_container(const std::string& value, std::vector<std::string>& res);
 
+/// \brief Locale independent integer parser in the spirit of std::from_chars, but skipping the leading whitespaces
+/// like the streams do. Negative values are wrapped for the unsigned types, as std::strtoull does.
+/// The out of range values are saturated to the limits of T and reported as a failure, the same as for the streams.
+/// \return pointer to the first character after the number or nullptr if [first, last) doesn't start with a number
+/// or the number doesn't fit T
 template <class T>
-void str_to_container(const std::string& value, T& res) {
+const char* parse_integer(const char* first, const char* last, T& value) {
+    while (first != last && std::isspace(static_cast<unsigned char>(*first)))
+        ++first;
+    bool negative = false;
+    if (first != last && (*first == '-' || *first == '+')) {
+        negative = *first == '-';
+        ++first;
+    }
+    // the magnitude limit: max for the positive and the unsigned values, -min for the negative signed values
+    const uint64_t max_value = static_cast<uint64_t>(std::numeric_limits<T>::max());
+    const uint64_t limit = negative && std::is_signed<T>::value ? max_value + 1 : max_value;
+    const char* digits = first;
+    uint64_t result = 0;
+    bool overflow = false;
+    for (; first != last && *first >= '0' && *first <= '9'; ++first) {
+        const auto digit = static_cast<uint64_t>(*first - '0');
+        overflow = overflow || result > (limit - digit) / 10;
+        if (!overflow)
+            result = result * 10 + digit;
+    }
+    if (first == digits)
+        return nullptr;
+    if (overflow) {
+        value = negative && std::is_signed<T>::value ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+        return nullptr;
+    }
+    value = static_cast<T>(negative ? 0 - result : result);
+    return first;
+}
+
+template <class T>
+using is_integer_value = std::integral_constant<bool,
+                                                std::is_integral<typename T::value_type>::value &&
+                                                    !std::is_same<typename T::value_type, bool>::value>;
+
+/// \brief Parses comma separated integers without the per-value string streams
+template <class T>
+typename std::enable_if<is_integer_value<T>::value>::type str_to_container(const std::string& value, T& res) {
+    const char* first = value.c_str();
+    const char* const last = first + value.size();
+    while (first != last) {
+        const char* field_end = std::find(first, last, ',');
+        if (field_end == first)
+            IE_THROW() << "Cannot get vector of parameters! \"" << value << "\" is incorrect";
+        // the same as reading from a stream: the characters after the number are ignored
+        // and the value is zero if the field doesn't start with a number
+        typename T::value_type val = 0;
+        parse_integer(first, field_end, val);
+        res.insert(res.end(), val);
+        // the trailing delimiter doesn't start a new field
+        first = field_end == last ? last : field_end + 1;
+    }
+}
+
+template <class T>
+typename std::enable_if<!is_integer_value<T>::value>::type str_to_container(const std::string& value, T& res) {
     std::stringstream ss(value);
     std::string field;
     while (getline(ss, field, ',')) {
@@ -47,7 +113,14 @@ bool getParameters(const pugi::xml_node& node, const std::string& name, std::vec
 }
 
 template <class T>
-T stringToType(const std::string& valStr) {
+typename std::enable_if<std::is_integral<T>::value, T>::type stringToType(const std::string& valStr) {
+    T ret{0};
+    parse_integer(valStr.c_str(), valStr.c_str() + valStr.size(), ret);
+    return ret;
+}
+
+template <class T>
+typename std::enable_if<!std::is_integral<T>::value, T>::type stringToType(const std::string& valStr) {
     T ret{0};
     std::istringstream ss(valStr);
     if (!ss.eof()) {
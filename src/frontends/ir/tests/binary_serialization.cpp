@@ -0,0 +1,199 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstddef>
+#include <cstring>
+#include <sstream>
+
+#include "binary_ir_format.hpp"
+#include "frontend_test.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/pass/serialize.hpp"
+#include "transformations/rt_info/fused_names_attribute.hpp"
+
+class IRFrontendBinarySerialization : public ::testing::Test, public IRFrontendTestsImpl {
+protected:
+    std::string modelFileName = "IrFrontendBinaryTestModel.ovb";
+
+    void TearDown() override {
+        std::remove(modelFileName.c_str());
+    }
+
+    static std::string serialize(const std::shared_ptr<ov::Model>& model) {
+        std::stringstream stream;
+        ov::pass::Manager manager;
+        manager.register_pass<ov::pass::BinarySerialize>(stream);
+        manager.run_passes(model);
+        return stream.str();
+    }
+
+    static std::shared_ptr<ov::Model> createModel() {
+        auto data = std::make_shared<ov::opset8::Parameter>(
+            ov::element::f32,
+            ov::PartialShape{1, ov::Dimension::dynamic(), ov::Dimension(10, 20), 8});
+        data->set_friendly_name("data");
+        data->get_output_tensor(0).set_names({"data", "input"});
+
+        auto weights = ov::opset8::Constant::create(ov::element::f32, {4, 3, 1, 1}, std::vector<float>(12, 0.5f));
+        weights->set_friendly_name("weights");
+        auto conv = std::make_shared<ov::opset8::Convolution>(data,
+                                                              weights,
+                                                              ov::Strides{1, 1},
+                                                              ov::CoordinateDiff{0, 0},
+                                                              ov::CoordinateDiff{0, 0},
+                                                              ov::Strides{1, 1});
+        conv->set_friendly_name("conv");
+        ov::FusedNames fused_names("conv_fused");
+        conv->get_rt_info()[ov::FusedNames::get_type_info_static()] = fused_names;
+
+        auto bias = ov::opset8::Constant::create(ov::element::f32, {1, 4, 1, 1}, {1.f, 2.f, 3.f, 4.f});
+        bias->set_friendly_name("bias");
+        auto add = std::make_shared<ov::opset8::Add>(conv, bias);
+        add->set_friendly_name("add");
+
+        auto clamp = std::make_shared<ov::opset8::Clamp>(add, 0.5, 6.0);
+        clamp->set_friendly_name("clamp");
+        clamp->get_output_tensor(0).set_names({"output"});
+
+        auto result = std::make_shared<ov::opset8::Result>(clamp);
+        result->set_friendly_name("result");
+
+        auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{data}, "Network");
+        return model;
+    }
+
+    static void compare(const std::shared_ptr<ov::Model>& model, const std::shared_ptr<ov::Model>& ref) {
+        const auto fc = FunctionsComparator::with_default()
+                            .enable(FunctionsComparator::ATTRIBUTES)
+                            .enable(FunctionsComparator::PRECISIONS)
+                            .enable(FunctionsComparator::RUNTIME_KEYS)
+                            .enable(FunctionsComparator::NAMES)
+                            .enable(FunctionsComparator::CONST_VALUES);
+        const auto res = fc.compare(model, ref);
+        EXPECT_TRUE(res.valid) << res.message;
+    }
+};
+
+TEST_F(IRFrontendBinarySerialization, stream) {
+    const auto ref = createModel();
+
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = getWithIRFrontend(serialize(ref)));
+    ASSERT_TRUE(!!model);
+
+    compare(model, ref);
+    EXPECT_EQ(model->get_friendly_name(), "Network");
+    EXPECT_EQ(model->input().get_names(), (std::unordered_set<std::string>{"data", "input"}));
+    EXPECT_EQ(model->output().get_names(), std::unordered_set<std::string>{"output"});
+    EXPECT_EQ(model->get_rt_info().at("version").as<int64_t>(), 11);
+}
+
+TEST_F(IRFrontendBinarySerialization, file) {
+    const auto ref = createModel();
+
+    ov::pass::Manager manager;
+    manager.register_pass<ov::pass::BinarySerialize>(modelFileName);
+    manager.run_passes(ref);
+
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = core.read_model(modelFileName));
+    ASSERT_TRUE(!!model);
+
+    compare(model, ref);
+    for (const auto& op : model->get_ops()) {
+        if (op->get_friendly_name() == "conv") {
+            EXPECT_EQ(ov::getFusedNames(op), "conv_fused");
+        }
+    }
+}
+
+TEST_F(IRFrontendBinarySerialization, deduplicate_weights) {
+    auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{4, 32});
+    auto add_1 = std::make_shared<ov::opset8::Add>(
+        data,
+        ov::opset8::Constant::create(ov::element::f32, {4, 32}, std::vector<float>(128, 0.5f)));
+    auto add_2 = std::make_shared<ov::opset8::Add>(
+        add_1,
+        ov::opset8::Constant::create(ov::element::f32, {4, 32}, std::vector<float>(128, 0.5f)));
+    const auto ref = std::make_shared<ov::Model>(ov::NodeVector{add_2}, ov::ParameterVector{data});
+
+    ov::pass::Manager manager;
+    manager.register_pass<ov::pass::BinarySerialize>(modelFileName);
+    manager.run_passes(ref);
+
+    const auto get_data = [](const std::shared_ptr<ov::Model>& model, const std::string& name) {
+        for (const auto& op : model->get_ordered_ops()) {
+            if (op->get_friendly_name() == name)
+                return ov::as_type<ov::opset8::Constant>(op->get_input_node_ptr(1))->get_data_ptr();
+        }
+        return static_cast<const void*>(nullptr);
+    };
+
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = core.read_model(modelFileName));
+    EXPECT_NE(get_data(model, add_1->get_friendly_name()), get_data(model, add_2->get_friendly_name()));
+
+    core.set_property(ov::deduplicate_weights(true));
+    EXPECT_TRUE(core.get_property(ov::deduplicate_weights.name()).as<bool>());
+    ASSERT_NO_THROW(model = core.read_model(modelFileName));
+    EXPECT_EQ(get_data(model, add_1->get_friendly_name()), get_data(model, add_2->get_friendly_name()));
+    compare(model, ref);
+}
+
+TEST_F(IRFrontendBinarySerialization, stateful) {
+    auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 4});
+    data->set_friendly_name("data");
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{ov::PartialShape{1, 4}, ov::element::f32, "state"});
+    auto read_value = std::make_shared<ov::opset8::ReadValue>(data, variable);
+    read_value->set_friendly_name("read_value");
+    auto add = std::make_shared<ov::opset8::Add>(read_value, data);
+    add->set_friendly_name("add");
+    auto assign = std::make_shared<ov::opset8::Assign>(add, variable);
+    assign->set_friendly_name("assign");
+    auto result = std::make_shared<ov::opset8::Result>(add);
+    result->set_friendly_name("result");
+    const auto ref = std::make_shared<ov::Model>(ov::ResultVector{result},
+                                                 ov::SinkVector{assign},
+                                                 ov::ParameterVector{data},
+                                                 "Network");
+
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = getWithIRFrontend(serialize(ref)));
+    ASSERT_TRUE(!!model);
+
+    ASSERT_EQ(model->get_ops().size(), ref->get_ops().size());
+    ASSERT_EQ(model->get_sinks().size(), 1);
+    ASSERT_EQ(model->get_variables().size(), 1);
+    EXPECT_EQ(model->get_variables()[0]->get_info().variable_id, "state");
+    const auto& dependencies = model->get_sinks()[0]->get_control_dependencies();
+    ASSERT_EQ(dependencies.size(), 1);
+    EXPECT_EQ(dependencies[0]->get_friendly_name(), "read_value");
+}
+
+TEST_F(IRFrontendBinarySerialization, model_rt_info_is_not_supported) {
+    const auto ref = createModel();
+    ref->get_rt_info()["framework"] = std::string("test");
+
+    EXPECT_THROW(serialize(ref), ov::Exception);
+}
+
+TEST_F(IRFrontendBinarySerialization, other_byte_order) {
+    auto model_string = serialize(createModel());
+    ov::binary_ir::Header header;
+    std::memcpy(&header, model_string.data(), sizeof(header));
+    ASSERT_EQ(header.byte_order, ov::binary_ir::byte_order_mark);
+
+    // the mark as it is read from the file written in the big endian byte order
+    const uint32_t swapped_mark = 0x04030201;
+    std::memcpy(&model_string[offsetof(ov::binary_ir::Header, byte_order)], &swapped_mark, sizeof(swapped_mark));
+    EXPECT_ANY_THROW(getWithIRFrontend(model_string));
+}
+
+TEST_F(IRFrontendBinarySerialization, truncated_model) {
+    const auto model_string = serialize(createModel());
+
+    EXPECT_ANY_THROW(getWithIRFrontend(model_string.substr(0, model_string.size() / 2)));
+}
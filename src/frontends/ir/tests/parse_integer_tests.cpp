@@ -0,0 +1,101 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "utils.hpp"
+
+namespace {
+template <class T>
+const char* parse(const std::string& str, T& value) {
+    return ov::parse_integer(str.c_str(), str.c_str() + str.size(), value);
+}
+}  // namespace
+
+TEST(IRFrontendParseInteger, sign) {
+    int32_t value = 0;
+    ASSERT_NE(parse("42", value), nullptr);
+    EXPECT_EQ(value, 42);
+    ASSERT_NE(parse("+42", value), nullptr);
+    EXPECT_EQ(value, 42);
+    ASSERT_NE(parse("-42", value), nullptr);
+    EXPECT_EQ(value, -42);
+    ASSERT_NE(parse(" \t-7", value), nullptr);
+    EXPECT_EQ(value, -7);
+
+    // negative values are wrapped for the unsigned types, as the streams do
+    uint32_t unsigned_value = 0;
+    ASSERT_NE(parse("-1", unsigned_value), nullptr);
+    EXPECT_EQ(unsigned_value, std::numeric_limits<uint32_t>::max());
+}
+
+TEST(IRFrontendParseInteger, limits) {
+    int32_t value = 0;
+    ASSERT_NE(parse("2147483647", value), nullptr);
+    EXPECT_EQ(value, std::numeric_limits<int32_t>::max());
+    ASSERT_NE(parse("-2147483648", value), nullptr);
+    EXPECT_EQ(value, std::numeric_limits<int32_t>::min());
+
+    int64_t int64_value = 0;
+    ASSERT_NE(parse("-9223372036854775808", int64_value), nullptr);
+    EXPECT_EQ(int64_value, std::numeric_limits<int64_t>::min());
+
+    uint64_t uint64_value = 0;
+    ASSERT_NE(parse("18446744073709551615", uint64_value), nullptr);
+    EXPECT_EQ(uint64_value, std::numeric_limits<uint64_t>::max());
+}
+
+TEST(IRFrontendParseInteger, overflow) {
+    int32_t value = 0;
+    EXPECT_EQ(parse("2147483648", value), nullptr);
+    EXPECT_EQ(value, std::numeric_limits<int32_t>::max());
+    EXPECT_EQ(parse("-2147483649", value), nullptr);
+    EXPECT_EQ(value, std::numeric_limits<int32_t>::min());
+    EXPECT_EQ(parse("99999999999999999999999", value), nullptr);
+    EXPECT_EQ(value, std::numeric_limits<int32_t>::max());
+
+    int64_t int64_value = 0;
+    EXPECT_EQ(parse("9223372036854775808", int64_value), nullptr);
+    EXPECT_EQ(int64_value, std::numeric_limits<int64_t>::max());
+
+    uint64_t uint64_value = 0;
+    EXPECT_EQ(parse("18446744073709551616", uint64_value), nullptr);
+    EXPECT_EQ(uint64_value, std::numeric_limits<uint64_t>::max());
+
+    uint8_t uint8_value = 0;
+    EXPECT_EQ(parse("256", uint8_value), nullptr);
+    EXPECT_EQ(uint8_value, std::numeric_limits<uint8_t>::max());
+}
+
+TEST(IRFrontendParseInteger, trailingCharacters) {
+    const std::string str = "12abc";
+    int32_t value = 0;
+    EXPECT_EQ(ov::parse_integer(str.c_str(), str.c_str() + str.size(), value), str.c_str() + 2);
+    EXPECT_EQ(value, 12);
+
+    // only the characters in the range are parsed
+    EXPECT_EQ(ov::parse_integer(str.c_str(), str.c_str() + 1, value), str.c_str() + 1);
+    EXPECT_EQ(value, 1);
+
+    value = 5;
+    EXPECT_EQ(parse("abc", value), nullptr);
+    EXPECT_EQ(parse("", value), nullptr);
+    EXPECT_EQ(parse("-", value), nullptr);
+    EXPECT_EQ(parse(" ", value), nullptr);
+    EXPECT_EQ(value, 5);
+}
+
+TEST(IRFrontendParseInteger, containerKeepsStreamBehavior) {
+    std::vector<int32_t> values;
+    ov::str_to_container("1, -2,3x,y,99999999999", values);
+    EXPECT_EQ(values, (std::vector<int32_t>{1, -2, 3, 0, std::numeric_limits<int32_t>::max()}));
+
+    EXPECT_EQ(ov::stringToType<int64_t>(" -5"), -5);
+    EXPECT_EQ(ov::stringToType<int32_t>("4294967296"), std::numeric_limits<int32_t>::max());
+}
@@ -0,0 +1,115 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <sstream>
+
+#include "frontend_test.hpp"
+
+class IRFrontendReadTimeBenchmark : public ::testing::TestWithParam<size_t>, public IRFrontendTestsImpl {
+protected:
+    static constexpr size_t chain_length = 100;
+
+    // Parameter -> (layers_count / chain_length) x (chain_length x MaxPool -> Result),
+    // every layer has a few numeric attributes to parse
+    static std::string generateModel(size_t layers_count) {
+        const std::string port = R"V0G0N(
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>)V0G0N";
+        std::stringstream layers, edges;
+        layers << R"V0G0N(
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,3,8,8"/>
+            <output>
+                <port id="0" precision="FP32">)V0G0N"
+               << port << R"V0G0N(
+            </output>
+        </layer>)V0G0N";
+        size_t id = 1;
+        for (size_t chain = 0; chain < layers_count / chain_length; chain++) {
+            for (size_t i = 0; i < chain_length; i++, id++) {
+                layers << R"V0G0N(
+        <layer name="pool_)V0G0N"
+                       << id << R"V0G0N(" type="MaxPool" id=")V0G0N" << id << R"V0G0N(" version="opset1">
+            <data auto_pad="explicit" kernel="1,1" pads_begin="0,0" pads_end="0,0" rounding_type="floor" strides="1,1"/>
+            <input>
+                <port id="0" precision="FP32">)V0G0N"
+                       << port << R"V0G0N(
+            </input>
+            <output>
+                <port id="1" precision="FP32">)V0G0N"
+                       << port << R"V0G0N(
+            </output>
+        </layer>)V0G0N";
+                const size_t from_layer = i == 0 ? 0 : id - 1;
+                edges << R"V0G0N(
+        <edge from-layer=")V0G0N" << from_layer << R"V0G0N(" from-port=")V0G0N" << (from_layer == 0 ? 0 : 1)
+                      << R"V0G0N(" to-layer=")V0G0N" << id << R"V0G0N(" to-port="0"/>)V0G0N";
+            }
+            layers << R"V0G0N(
+        <layer name="output_)V0G0N"
+                   << id << R"V0G0N(" type="Result" id=")V0G0N" << id << R"V0G0N(" version="opset1">
+            <input>
+                <port id="0" precision="FP32">)V0G0N"
+                   << port << R"V0G0N(
+            </input>
+        </layer>)V0G0N";
+            edges << R"V0G0N(
+        <edge from-layer=")V0G0N" << id - 1 << R"V0G0N(" from-port="1" to-layer=")V0G0N" << id
+                  << R"V0G0N(" to-port="0"/>)V0G0N";
+            id++;
+        }
+
+        std::stringstream model;
+        model << R"V0G0N(<net name="Network" version="11">
+    <layers>)V0G0N"
+              << layers.str() << R"V0G0N(
+    </layers>
+    <edges>)V0G0N"
+              << edges.str() << R"V0G0N(
+    </edges>
+</net>
+)V0G0N";
+        return model.str();
+    }
+
+    static void checkModel(const std::shared_ptr<ov::Model>& model, size_t layers_count) {
+        ASSERT_TRUE(!!model);
+        const auto chains_count = layers_count / chain_length;
+        ASSERT_EQ(model->get_results().size(), chains_count);
+        ASSERT_EQ(model->get_ops().size(), 1 + layers_count + chains_count);
+        ASSERT_EQ(model->get_results()[0]->get_output_partial_shape(0), ov::PartialShape({1, 3, 8, 8}));
+    }
+};
+
+TEST_P(IRFrontendReadTimeBenchmark, read_model) {
+    const auto layers_count = GetParam();
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = getWithIRFrontend(generateModel(layers_count)));
+    checkModel(model, layers_count);
+}
+
+// The read time is reported as the read_time_ms property of the test (e.g. --gtest_output=xml), it is run manually
+// with --gtest_also_run_disabled_tests
+TEST_P(IRFrontendReadTimeBenchmark, DISABLED_read_model_time) {
+    const auto layers_count = GetParam();
+    const auto model_string = generateModel(layers_count);
+
+    const auto begin = std::chrono::steady_clock::now();
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = getWithIRFrontend(model_string));
+    const auto end = std::chrono::steady_clock::now();
+
+    checkModel(model, layers_count);
+    RecordProperty("read_time_ms",
+                   static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count()));
+}
+
+INSTANTIATE_TEST_SUITE_P(small_and_medium, IRFrontendReadTimeBenchmark, ::testing::Values(100, 10000));
+
+// takes several seconds, so it is run manually with --gtest_also_run_disabled_tests
+INSTANTIATE_TEST_SUITE_P(DISABLED_huge, IRFrontendReadTimeBenchmark, ::testing::Values(100000));
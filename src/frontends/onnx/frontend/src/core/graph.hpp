@@ -12,6 +12,7 @@
 
 #include "core/graph_cache.hpp"
 #include "core/model.hpp"
+#include "utils/tensor_external_data.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "onnx_import/core/operator_set.hpp"
@@ -77,6 +78,8 @@ protected:
 private:
     std::vector<Node> m_nodes;
     std::string m_model_dir;
+    // external data files mapped by initializers, Constants keep the mappings alive after the graph is converted
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 /// \brief      Representation of ONNX subgraph. It is used for example by ONNX Loop op.
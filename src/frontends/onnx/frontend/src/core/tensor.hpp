@@ -12,6 +12,7 @@
 
 #include "ngraph/op/constant.hpp"
 #include "ngraph/shape.hpp"
+#include "exceptions.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "onnx_common/utils.hpp"
 #include "utils/common.hpp"
@@ -105,10 +106,13 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor, const std::string& model_dir)
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                    const std::string& model_dir,
+                    detail::MappedMemoryHandles mmap_cache = nullptr)
         : m_tensor_proto{&tensor},
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
-          m_model_dir{model_dir} {
+          m_model_dir{model_dir},
+          m_mmap_cache{std::move(mmap_cache)} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -194,6 +198,9 @@ public:
         if (m_tensor_proto->has_segment()) {
             throw error::tensor::segments_unsupported{};
         }
+        if (has_external_data() && m_mmap_cache) {
+            return make_ng_constant_from_mmap(get_ng_type());
+        }
         switch (m_tensor_proto->data_type()) {
         case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_BOOL:
             return make_ng_constant<char>(element::boolean);
@@ -274,6 +281,33 @@ private:
         return constant;
     }
 
+    // The Constant points into the mapped external data file, so no weights are read until they are used.
+    // ONNX stores external data in the same little-endian layout as Constant, so no conversion is needed.
+    std::shared_ptr<ngraph::op::Constant> make_ng_constant_from_mmap(const element::Type& type) const {
+        const auto tensor_external_data = detail::TensorExternalData(*m_tensor_proto);
+        auto buffer = tensor_external_data.load_external_mmap_data(m_model_dir, m_mmap_cache);
+        const auto byte_size = shape_size(m_shape) * type.size();
+        if (buffer->size() < byte_size) {
+            throw error::invalid_external_data{tensor_external_data};
+        }
+
+        std::shared_ptr<default_opset::Constant> constant{nullptr};
+        if (buffer->size() == byte_size) {
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+        } else {
+            // the data length is not specified, so the buffer spans up to the end of the file
+            auto trimmed_buffer = std::make_shared<ngraph::runtime::SharedBuffer<detail::MappedBuffer>>(
+                buffer->get_ptr<char>(),
+                byte_size,
+                buffer);
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, trimmed_buffer);
+        }
+        if (m_tensor_proto->has_name()) {
+            constant->set_friendly_name(get_name());
+        }
+        return constant;
+    }
+
     bool has_external_data() const {
         return m_tensor_proto->has_data_location() &&
                m_tensor_proto->data_location() ==
@@ -331,6 +365,7 @@ private:
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
     Shape m_shape;
     std::string m_model_dir;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
@@ -72,6 +72,49 @@ std::string TensorExternalData::load_external_data(const std::string& model_dir)
     return read_data;
 }
 
+MappedBuffer TensorExternalData::load_external_mmap_data(const std::string& model_dir,
+                                                        const MappedMemoryHandles& cache) const {
+    NGRAPH_SUPPRESS_DEPRECATED_START
+    auto full_path = file_util::path_join(model_dir, m_data_location);
+    NGRAPH_SUPPRESS_DEPRECATED_END
+
+    std::shared_ptr<ov::util::MappedMemory> mapped_memory;
+    const auto cached = cache->find(full_path);
+    if (cached != cache->end()) {
+        mapped_memory = cached->second;
+    } else {
+        try {
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+            NGRAPH_SUPPRESS_DEPRECATED_START
+            auto win_path = full_path;
+            file_util::convert_path_win_style(win_path);
+            NGRAPH_SUPPRESS_DEPRECATED_END
+            mapped_memory = ov::util::load_mmap_object(ov::util::string_to_wstring(win_path));
+#else
+            mapped_memory = ov::util::load_mmap_object(full_path);
+#endif
+        } catch (const std::runtime_error&) {
+            throw error::invalid_external_data{*this};
+        }
+        cache->emplace(full_path, mapped_memory);
+    }
+
+    const uint64_t file_size = mapped_memory->size();
+    if (m_offset + m_data_length > file_size || m_offset > file_size) {
+        throw error::invalid_external_data{*this};
+    }
+
+    if (m_sha1_digest.size() > 0) {
+        NGRAPH_WARN << "SHA1 checksum is not supported";
+    }
+
+    const uint64_t data_length = m_data_length > 0 ? m_data_length : file_size - m_offset;
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+        mapped_memory->data() + m_offset,
+        data_length,
+        mapped_memory);
+}
+
 std::string TensorExternalData::to_string() const {
     std::stringstream s;
     s << "ExternalDataInfo(";
@@ -6,9 +6,20 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+/// \brief     Buffer pointing into the mapped external data file, it keeps the mapping alive
+using MappedBuffer = std::shared_ptr<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>;
+/// \brief     Memory mappings of the external data files shared by all tensors of a model, keyed by full path
+using MappedMemoryHandles = std::shared_ptr<std::map<std::string, std::shared_ptr<ov::util::MappedMemory>>>;
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -23,6 +34,15 @@ public:
     /// \return     External binary data loaded into a std::string
     std::string load_external_data(const std::string& model_dir) const;
 
+    /// \brief      Map external data from tensor passed to constructor
+    ///
+    /// \note       The external file is mapped only once per \p cache, so all tensors stored
+    ///             in the same file share the mapping. Pages are read when the data is accessed.
+    ///             If mapping the external file fails, the invalid_external_data exception is thrown.
+    ///
+    /// \return     Buffer pointing into the mapped file
+    MappedBuffer load_external_mmap_data(const std::string& model_dir, const MappedMemoryHandles& cache) const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
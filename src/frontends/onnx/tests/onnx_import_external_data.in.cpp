@@ -93,6 +93,25 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file) {
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file_share_mapping) {
+    const auto function = onnx_import::import_onnx_model(
+        file_util::path_join(CommonTestUtils::getExecutableDirectory(),
+                             SERIALIZED_ZOO,
+                             "onnx/external_data/external_data_two_tensors_data_in_the_same_file.onnx"));
+
+    std::map<std::string, std::shared_ptr<default_opset::Constant>> constants;
+    for (const auto& op : function->get_ordered_ops()) {
+        if (const auto constant = std::dynamic_pointer_cast<default_opset::Constant>(op)) {
+            constants[constant->get_friendly_name()] = constant;
+        }
+    }
+    ASSERT_EQ(constants.count("data_a"), 1);
+    ASSERT_EQ(constants.count("data_b"), 1);
+    // both Constants point into the single mapping of the external file: data_b is stored at offset 4096
+    EXPECT_EQ(constants["data_b"]->get_data_ptr<char>() - constants["data_a"]->get_data_ptr<char>(), 4096);
+    EXPECT_EQ(constants["data_a"]->get_byte_size(), 12);
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception) {
     try {
         auto function = onnx_import::import_onnx_model(
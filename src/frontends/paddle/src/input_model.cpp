@@ -4,15 +4,21 @@
 
 #include "input_model.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <queue>
 
 #include "decoder_proto.hpp"
 #include "framework.pb.h"
 #include "input_model.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/frontend/paddle/node_context.hpp"
 #include "openvino/opsets/opset7.hpp"
 #include "openvino/util/common_util.hpp"
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+#include "openvino/util/parallel_for.hpp"
 #include "paddle_utils.hpp"
 #include "place.hpp"
 
@@ -60,6 +66,14 @@ private:
     void loadPlaces();
     template <typename T>
     void loadConsts(const std::basic_string<T>& folder_with_weights, std::istream* weight_stream);
+    void loadMappedConsts(const std::shared_ptr<ov::util::MappedMemory>& weights);
+    void storeConsts(const std::vector<std::shared_ptr<opset7::Constant>>& const_nodes);
+    struct ConstDesc {
+        std::string name;
+        element::Type type;
+        Shape shape;
+    };
+    std::vector<ConstDesc> getPersistableVars() const;
     void createTempConsts();
     std::vector<std::shared_ptr<OpPlace>> determine_cut_nodes() const;
 
@@ -168,6 +182,37 @@ bool read_tensor(std::istream& is, char* data, size_t len) {
     return true;
 }
 
+// The tensor is serialized as: uint32 version, uint64 LoD level, uint32 tensor version,
+// int32 size of TensorDesc, TensorDesc proto, raw data.
+// Returns the offset of the data of the tensor starting at `offset` in the mapped memory.
+size_t get_mapped_tensor_data_offset(ov::util::MappedMemory& weights,
+                                     size_t offset,
+                                     size_t len,
+                                     const std::string& name) {
+    const auto size = weights.size();
+    FRONT_END_GENERAL_CHECK(offset + 20 <= size, "File containing constant with name ", name, " is truncated.");
+    uint32_t dims_len = 0;
+    std::memcpy(&dims_len, weights.data() + offset + 16, sizeof(dims_len));
+    const auto data_offset = offset + 20 + dims_len;
+    FRONT_END_GENERAL_CHECK(data_offset <= size && len <= size - data_offset,
+                            "File containing constant with name ",
+                            name,
+                            " wasn't successfully read.");
+    return data_offset;
+}
+
+// Constant is a view into the mapped memory, weight pages are read when the Constant data is accessed
+std::shared_ptr<opset7::Constant> make_mapped_constant(const std::shared_ptr<ov::util::MappedMemory>& weights,
+                                                       size_t data_offset,
+                                                       const element::Type& type,
+                                                       const Shape& shape) {
+    auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+        weights->data() + data_offset,
+        shape_size(shape) * type.size(),
+        weights);
+    return std::make_shared<opset7::Constant>(type, shape, buffer);
+}
+
 template <typename T>
 std::basic_string<T> get_const_path(const std::basic_string<T>& folder_with_weights, const std::string& name) {
     return folder_with_weights + paddle::get_path_sep<T>() + name;
@@ -183,16 +228,17 @@ std::basic_string<wchar_t> get_const_path(const std::basic_string<wchar_t>& fold
 #endif
 
 template <typename T>
-std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstream* weights_stream) {
+std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::basic_string<T>* weights_path) {
     std::string model_file{path};
     std::string ext = ".pdmodel";
     if (ov::util::ends_with(model_file, ext)) {
         std::string params_ext = ".pdiparams";
         std::string weights_file{path};
         weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
+        // Don't throw error if file doesn't exist
         // It may mean that model don't have constants
+        if (ov::util::file_exists(weights_file))
+            *weights_path = weights_file;
     } else {
         model_file += paddle::get_path_sep<T>() + "__model__";
     }
@@ -201,16 +247,18 @@ std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstr
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
 template <>
-std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path, std::ifstream* weights_stream) {
+std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path,
+                                          std::basic_string<wchar_t>* weights_path) {
     std::wstring model_file{path};
     std::wstring ext = L".pdmodel";
     if (ov::util::ends_with(model_file, ext)) {
         std::wstring params_ext = L".pdiparams";
         std::wstring weights_file{path};
         weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
+        // Don't throw error if file doesn't exist
         // It may mean that model don't have constants
+        if (ov::util::file_exists(weights_file))
+            *weights_path = weights_file;
     } else {
         model_file += paddle::get_path_sep<wchar_t>() + L"__model__";
     }
@@ -267,9 +315,8 @@ std::vector<std::shared_ptr<OpPlace>> InputModel::InputModelImpl::determine_cut_
     return new_op_places;
 }
 
-template <typename T>
-void InputModel::InputModelImpl::loadConsts(const std::basic_string<T>& folder_with_weights,
-                                            std::istream* weight_stream) {
+std::vector<InputModel::InputModelImpl::ConstDesc> InputModel::InputModelImpl::getPersistableVars() const {
+    std::vector<ConstDesc> consts;
     for (const auto& item : m_var_places) {
         const auto& var_desc = item.second->get_desc();
         const auto& name = item.first;
@@ -280,30 +327,77 @@ void InputModel::InputModelImpl::loadConsts(const std::basic_string<T>& folder_w
 
         FRONT_END_GENERAL_CHECK(var_desc.type().type() == ::paddle::framework::proto::VarType::LOD_TENSOR);
         const auto& tensor = var_desc.type().lod_tensor().tensor();
-        Shape shape(tensor.dims().cbegin(), tensor.dims().cend());
-        const auto& type = TYPE_MAP[tensor.data_type()];
-        const auto& data_length = shape_size(shape) * type.size();
-        std::vector<uint8_t> tensor_data(data_length);
-
-        bool read_succeed = false;
-        if (weight_stream) {
-            read_succeed = read_tensor(*weight_stream, reinterpret_cast<char*>(&tensor_data[0]), data_length);
-        } else if (!folder_with_weights.empty()) {
-            std::ifstream is(get_const_path(folder_with_weights, name), std::ios::in | std::ifstream::binary);
-            FRONT_END_GENERAL_CHECK(is && is.is_open(), "Cannot open file for constant value.");
-            read_succeed = read_tensor(is, reinterpret_cast<char*>(&tensor_data[0]), data_length);
-        } else {
-            FRONT_END_GENERAL_CHECK(false, "Either folder with weights or stream must be provided.");
+        consts.push_back({name, TYPE_MAP[tensor.data_type()], Shape(tensor.dims().cbegin(), tensor.dims().cend())});
+    }
+    return consts;
+}
+
+void InputModel::InputModelImpl::storeConsts(const std::vector<std::shared_ptr<opset7::Constant>>& const_nodes) {
+    for (const auto& const_node : const_nodes) {
+        m_tensor_values[const_node->get_friendly_name()] = const_node;
+    }
+}
+
+template <typename T>
+void InputModel::InputModelImpl::loadConsts(const std::basic_string<T>& folder_with_weights,
+                                            std::istream* weight_stream) {
+    const auto consts = getPersistableVars();
+    std::vector<std::shared_ptr<opset7::Constant>> const_nodes(consts.size());
+    if (weight_stream) {
+        // tensors are stored one after another in the order of names
+        for (size_t i = 0; i < consts.size(); ++i) {
+            const auto& desc = consts[i];
+            const auto data_length = shape_size(desc.shape) * desc.type.size();
+            std::vector<uint8_t> tensor_data(data_length);
+            const bool read_succeed =
+                read_tensor(*weight_stream, reinterpret_cast<char*>(&tensor_data[0]), data_length);
+            FRONT_END_GENERAL_CHECK(read_succeed,
+                                    "File containing constant with name ",
+                                    desc.name,
+                                    " wasn't successfully read.");
+            const_nodes[i] = opset7::Constant::create(desc.type, desc.shape, &tensor_data[0]);
+            const_nodes[i]->set_friendly_name(desc.name);
         }
-        FRONT_END_GENERAL_CHECK(read_succeed,
-                                "File containing constant with name ",
-                                name,
-                                " wasn't successfully read.");
-
-        auto const_node = opset7::Constant::create(type, shape, &tensor_data[0]);
-        const_node->set_friendly_name(name);
-        m_tensor_values[name] = const_node;
+    } else if (!consts.empty()) {
+        FRONT_END_GENERAL_CHECK(!folder_with_weights.empty(), "Either folder with weights or stream must be provided.");
+        // every tensor is stored in its own file, so the files are opened and their headers are read independently
+        std::vector<std::shared_ptr<ov::util::MappedMemory>> weights(consts.size());
+        std::vector<size_t> data_offsets(consts.size());
+        ov::util::parallel_for(consts.size(), [&](size_t i) {
+            const auto& desc = consts[i];
+            try {
+                weights[i] = ov::util::load_mmap_object(get_const_path(folder_with_weights, desc.name));
+            } catch (const std::runtime_error&) {
+                FRONT_END_GENERAL_CHECK(false, "Cannot open file for constant value.");
+            }
+            const auto data_length = shape_size(desc.shape) * desc.type.size();
+            data_offsets[i] = get_mapped_tensor_data_offset(*weights[i], 0, data_length, desc.name);
+        });
+        for (size_t i = 0; i < consts.size(); ++i) {
+            const_nodes[i] = make_mapped_constant(weights[i], data_offsets[i], consts[i].type, consts[i].shape);
+            const_nodes[i]->set_friendly_name(consts[i].name);
+        }
+    }
+    storeConsts(const_nodes);
+}
+
+void InputModel::InputModelImpl::loadMappedConsts(const std::shared_ptr<ov::util::MappedMemory>& weights) {
+    const auto consts = getPersistableVars();
+    // tensors are stored one after another in the order of names, so their offsets are indexed in one pass
+    std::vector<size_t> data_offsets(consts.size());
+    size_t offset = 0;
+    for (size_t i = 0; i < consts.size(); ++i) {
+        const auto data_length = shape_size(consts[i].shape) * consts[i].type.size();
+        data_offsets[i] = get_mapped_tensor_data_offset(*weights, offset, data_length, consts[i].name);
+        offset = data_offsets[i] + data_length;
     }
+
+    std::vector<std::shared_ptr<opset7::Constant>> const_nodes(consts.size());
+    for (size_t i = 0; i < consts.size(); ++i) {
+        const_nodes[i] = make_mapped_constant(weights, data_offsets[i], consts[i].type, consts[i].shape);
+        const_nodes[i]->set_friendly_name(consts[i].name);
+    }
+    storeConsts(const_nodes);
 }
 
 template <typename T>
@@ -314,8 +408,8 @@ InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
       m_input_model(input_model),
       m_telemetry(telemetry) {
     std::string empty_str;
-    std::ifstream weights_stream;
-    std::ifstream pb_stream(get_model_path<T>(path, &weights_stream), std::ios::in | std::ifstream::binary);
+    std::basic_string<T> weights_path;
+    std::ifstream pb_stream(get_model_path<T>(path, &weights_path), std::ios::in | std::ifstream::binary);
 
     FRONT_END_GENERAL_CHECK(pb_stream && pb_stream.is_open(), "Model file doesn't exist");
     FRONT_END_GENERAL_CHECK(m_fw_ptr->ParseFromIstream(&pb_stream), "Model can't be parsed");
@@ -328,8 +422,14 @@ InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
         version >= 2000000 || version == 0,
         "[Frontend]Only Support Paddle greater than 2.0.0, current version " + std::to_string(version));
     loadPlaces();
-    if (weights_stream && weights_stream.is_open()) {
-        loadConsts(std::basic_string<T>{}, &weights_stream);
+    if (!weights_path.empty()) {
+        std::shared_ptr<ov::util::MappedMemory> weights;
+        try {
+            weights = ov::util::load_mmap_object(weights_path);
+        } catch (const std::runtime_error& ex) {
+            FRONT_END_GENERAL_CHECK(false, "Weights file can't be mapped: ", ex.what());
+        }
+        loadMappedConsts(weights);
     } else {
         loadConsts(path, nullptr);
     }
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -20,7 +21,11 @@ namespace tensorflow {
 
 class DecoderProto : public ov::frontend::tensorflow::DecoderBase {
 public:
-    explicit DecoderProto(const ::tensorflow::NodeDef* node_def) : m_node_def(node_def) {}
+    /// \param owner  Message owning the node, Const values returned by get_attribute share its memory
+    ///               and keep it alive. If it is not set, the values are copied.
+    explicit DecoderProto(const ::tensorflow::NodeDef* node_def, std::shared_ptr<const void> owner = nullptr)
+        : m_node_def(node_def),
+          m_owner(std::move(owner)) {}
 
     ov::Any get_attribute(const std::string& name) const override;
 
@@ -35,8 +40,9 @@ public:
     const std::string& get_op_name() const override;
 
 private:
-    std::vector<::tensorflow::AttrValue> decode_attribute_helper(const std::string& name) const;
+    const ::tensorflow::AttrValue* decode_attribute_helper(const std::string& name) const;
     const ::tensorflow::NodeDef* m_node_def;
+    std::shared_ptr<const void> m_owner;
 };
 }  // namespace tensorflow
 }  // namespace frontend
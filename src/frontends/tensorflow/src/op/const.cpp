@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "op_table.hpp"
 #include "openvino/opsets/opset8.hpp"
 
@@ -15,7 +16,11 @@ namespace op {
 
 OutputVector translate_const_op(const NodeContext& node) {
     auto tensor = node.get_attribute<ov::Tensor>("value");
-    auto res = std::make_shared<ov::opset8::Constant>(tensor.get_element_type(), tensor.get_shape(), tensor.data());
+    // the Constant shares the tensor memory, which may alias the parsed model (see DecoderProto)
+    auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<ov::Tensor>>(static_cast<char*>(tensor.data()),
+                                                                              tensor.get_byte_size(),
+                                                                              tensor);
+    auto res = std::make_shared<ov::opset8::Constant>(tensor.get_element_type(), tensor.get_shape(), buffer);
     set_node_name(node.get_name(), res);
     return {res};
 }
@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <exception>
-#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -39,25 +41,115 @@ namespace InferenceEngine {
  */
 class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
     enum InferState { Idle, Busy, Cancelled, Stop };
-    using Futures = std::vector<std::shared_future<void>>;
-    using Promise = std::shared_ptr<std::promise<void>>;
     enum Stage_e : std::uint8_t { executor, task };
     IInferRequestInternal::Ptr _syncRequest;
 
     friend struct DisableCallbackGuard;
     struct DisableCallbackGuard {
         explicit DisableCallbackGuard(AsyncInferRequestThreadSafeDefault* this_) : _this{this_} {
-            std::lock_guard<std::mutex> lock{_this->_mutex};
+            std::lock_guard<std::mutex> lock{_this->_callbackMutex};
             std::swap(_callback, _this->_callback);
+            _this->_hasCallback = false;
         }
         ~DisableCallbackGuard() {
-            std::lock_guard<std::mutex> lock{_this->_mutex};
+            std::lock_guard<std::mutex> lock{_this->_callbackMutex};
             _this->_callback = _callback;
+            _this->_hasCallback = static_cast<bool>(_callback);
         }
         AsyncInferRequestThreadSafeDefault* _this = nullptr;
         Callback _callback;
     };
 
+    /**
+     * @brief Completion of the pipelines reused by all the runs of the request.
+     * Runs are numbered in the order they are started. A run is completed after the callback is called.
+     * The mutex and the condition variable are used only if there are threads waiting for completion
+     * or if the run has failed.
+     */
+    struct Completion {
+        /**
+         * @brief Marks the run as completed. The request may be destroyed right after the run is marked as completed,
+         * so the caller should keep the completion alive by a shared pointer.
+         */
+        void Complete(std::uint64_t run, std::exception_ptr exception) {
+            if (exception != nullptr) {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _exception = std::move(exception);
+                _failedRun = run;
+            }
+            // The callback may start the next run which may complete before this one
+            auto completed = _completedRun.load();
+            while (completed < run && !_completedRun.compare_exchange_weak(completed, run)) {
+            }
+            --_running;
+            if (_waiters > 0) {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _condVar.notify_all();
+            }
+        }
+
+        /**
+         * @brief Waits for the completion of the run
+         * @param run Run number
+         * @param millis_timeout Timeout in `ms`, negative value means infinite wait
+         * @return `true` if the run is completed
+         */
+        bool Wait(std::uint64_t run, int64_t millis_timeout) {
+            return WaitFor(millis_timeout, [&] {
+                return _completedRun >= run;
+            });
+        }
+
+        /**
+         * @brief Waits until there are no running pipelines
+         */
+        void WaitAll() {
+            WaitFor(-1, [&] {
+                return _running == 0;
+            });
+        }
+
+        /**
+         * @brief Returns exception of the completed run or nullptr if the run has succeeded
+         */
+        std::exception_ptr GetException(std::uint64_t run) {
+            if (_failedRun != run) {
+                return nullptr;
+            }
+            std::lock_guard<std::mutex> lock{_mutex};
+            return _failedRun == run ? _exception : nullptr;
+        }
+
+        std::atomic<std::uint64_t> _startedRun{0};
+        std::atomic<int> _running{0};
+
+    private:
+        template <typename Predicate>
+        bool WaitFor(int64_t millis_timeout, const Predicate& predicate) {
+            if (predicate() || millis_timeout == 0) {
+                return predicate();
+            }
+            ++_waiters;
+            {
+                std::unique_lock<std::mutex> lock{_mutex};
+                if (millis_timeout < 0) {
+                    _condVar.wait(lock, predicate);
+                } else {
+                    _condVar.wait_for(lock, std::chrono::milliseconds{millis_timeout}, predicate);
+                }
+            }
+            --_waiters;
+            return predicate();
+        }
+
+        std::atomic<std::uint64_t> _completedRun{0};
+        std::atomic<std::uint64_t> _failedRun{0};
+        std::atomic<int> _waiters{0};
+        std::exception_ptr _exception;
+        std::mutex _mutex;
+        std::condition_variable _condVar;
+    };
+
     struct ImmediateStreamsExecutor : public InferenceEngine::ITaskExecutor {
         explicit ImmediateStreamsExecutor(const IStreamsExecutor::Ptr& streamsExecutor)
             : _streamsExecutor{streamsExecutor} {}
@@ -71,43 +163,32 @@ class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
     void InferImpl(const F& f) {
         _syncRequest->checkBlobs();
         InferState state = InferState::Idle;
-        {
-            std::lock_guard<std::mutex> lock{_mutex};
-            state = _state;
-            switch (_state) {
+        if (!_state.compare_exchange_strong(state, InferState::Busy)) {
+            switch (state) {
             case InferState::Busy:
                 IE_THROW(RequestBusy);
             case InferState::Cancelled:
                 IE_THROW(InferCancelled);
-            case InferState::Idle: {
-                _futures.erase(std::remove_if(std::begin(_futures),
-                                              std::end(_futures),
-                                              [](const std::shared_future<void>& future) {
-                                                  if (future.valid()) {
-                                                      return (std::future_status::ready ==
-                                                              future.wait_for(std::chrono::milliseconds{0}));
-                                                  } else {
-                                                      return true;
-                                                  }
-                                              }),
-                               _futures.end());
-                _promise = {};
-                _futures.emplace_back(_promise.get_future().share());
-            } break;
-            case InferState::Stop:
-                break;
+            default:
+                return;
             }
-            _state = InferState::Busy;
         }
-        if (state != InferState::Stop) {
-            try {
-                f();
-            } catch (...) {
-                _promise.set_exception(std::current_exception());
-                std::lock_guard<std::mutex> lock{_mutex};
-                _state = InferState::Idle;
-                throw;
-            }
+        ++_completion->_running;
+        _run = ++_completion->_startedRun;
+        try {
+            f();
+        } catch (...) {
+            auto completion = _completion;
+            SetIdleState();
+            completion->Complete(_run, std::current_exception());
+            throw;
+        }
+    }
+
+    void SetIdleState() {
+        InferState state = _state;
+        while ((state == InferState::Busy || state == InferState::Cancelled) &&
+               !_state.compare_exchange_weak(state, InferState::Idle)) {
         }
     }
 
@@ -116,8 +197,7 @@ protected:
      * @brief Throws exception if inference request is busy or canceled
      */
     void CheckState() const {
-        std::lock_guard<std::mutex> lock{_mutex};
-        switch (_state) {
+        switch (_state.load()) {
         case InferState::Busy:
             IE_THROW(RequestBusy);
         case InferState::Cancelled:
@@ -153,9 +233,11 @@ public:
                      [this] {
                          _syncRequest->InferImpl();
                      }}},
-          _syncPipeline{{std::make_shared<ImmediateExecutor>(), [this] {
+          _syncPipeline{{std::make_shared<ImmediateExecutor>(),
+                         [this] {
                              _syncRequest->InferImpl();
-                         }}} {
+                         }}},
+          _completion{std::make_shared<Completion>()} {
         auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(taskExecutor);
         if (streamsExecutor != nullptr) {
             _syncPipeline = {{std::make_shared<ImmediateStreamsExecutor>(std::move(streamsExecutor)), [this] {
@@ -182,33 +264,30 @@ public:
             IE_THROW(ParameterMismatch) << " Timeout can't be less " << InferRequest::WaitMode::RESULT_READY
                                         << " for InferRequest::Wait\n";
         }
-        auto status = std::future_status::deferred;
-
-        // Just use the last '_futures' member to wait pipeline completion
-        auto future = [&] {
-            std::lock_guard<std::mutex> lock{_mutex};
-            return _futures.empty() ? std::shared_future<void>{} : _futures.back();
-        }();
-
-        if (!future.valid()) {
+        // Just wait for the last started run
+        const auto run = _completion->_startedRun.load();
+        if (run == 0) {
             return StatusCode::INFER_NOT_STARTED;
         }
 
+        bool ready = false;
         switch (millis_timeout) {
         case InferRequest::WaitMode::RESULT_READY: {
-            future.wait();
-            status = std::future_status::ready;
+            ready = _completion->Wait(run, -1);
         } break;
         case InferRequest::WaitMode::STATUS_ONLY: {
-            status = future.wait_for(std::chrono::milliseconds{0});
+            ready = _completion->Wait(run, 0);
         } break;
         default: {
-            status = future.wait_for(std::chrono::milliseconds{millis_timeout});
+            ready = _completion->Wait(run, millis_timeout);
         } break;
         }
 
-        if (std::future_status::ready == status) {
-            future.get();
+        if (ready) {
+            auto exception = _completion->GetException(run);
+            if (exception != nullptr) {
+                std::rethrow_exception(exception);
+            }
             return StatusCode::OK;
         } else {
             return StatusCode::RESULT_NOT_READY;
@@ -234,6 +313,11 @@ public:
         return _syncRequest->GetPerformanceCounts();
     }
 
+    std::map<std::string, std::map<std::string, uint64_t>> GetHardwareCounters() const override {
+        CheckState();
+        return _syncRequest->GetHardwareCounters();
+    }
+
     void SetBlob(const std::string& name, const Blob::Ptr& data) override {
         CheckState();
         _syncRequest->SetBlob(name, data);
@@ -270,7 +354,18 @@ public:
 
     void SetCallback(Callback callback) override {
         CheckState();
+        std::lock_guard<std::mutex> lock{_callbackMutex};
         _callback = std::move(callback);
+        _hasCallback = static_cast<bool>(_callback);
+    }
+
+    void SetSchedulingInfo(const TaskSchedulingInfo& info) override {
+        CheckState();
+        _schedulingInfo = info;
+    }
+
+    std::chrono::nanoseconds GetQueueWaitTime() const override {
+        return _queueWaitTime;
     }
 
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> QueryState() override {
@@ -279,17 +374,14 @@ public:
     }
 
     void ThrowIfCanceled() const {
-        std::lock_guard<std::mutex> lock{_mutex};
         if (_state == InferState::Cancelled) {
             IE_THROW(InferCancelled);
         }
     }
 
     void Cancel() override {
-        std::lock_guard<std::mutex> lock{_mutex};
-        if (_state == InferState::Busy) {
-            _state = InferState::Cancelled;
-        }
+        InferState state = InferState::Busy;
+        _state.compare_exchange_strong(state, InferState::Cancelled);
     }
 
     void setModelInputsOutputs(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
@@ -310,9 +402,10 @@ protected:
     using Pipeline = std::vector<Stage>;
 
     /**
-     * @brief Creates and run the first stage task. If destructor was not called add a new std::future to the
-     * AsyncInferRequestThreadSafeDefault::_futures list that would be used to wait
-     * AsyncInferRequestThreadSafeDefault::_pipeline finish
+     * @brief Runs the first stage task. The pipeline position is kept in the request itself,
+     * so the stage tasks capture only `this` and running the pipeline doesn't allocate memory.
+     * The task is scheduled with IInferRequestInternal::_schedulingInfo, which applies to this start only,
+     * and the time it waited for the executor is reported by GetQueueWaitTime()
      * @param[in]  itBeginStage Iterator to begin of pipeline
      * @param[in]  itEndStage End pipeline iterator
      * @param[in]  callbackExecutor Final or error stage executor
@@ -322,7 +415,22 @@ protected:
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
         auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
         IE_ASSERT(nullptr != firstStageExecutor);
-        firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
+        _itStage = itBeginStage;
+        _itEndStage = itEndStage;
+        _stageCallbackExecutor = callbackExecutor;
+        _stageException = nullptr;
+        // priority and deadline apply to this start only, the NUMA node preference is kept by the request
+        const auto schedulingInfo = _schedulingInfo;
+        _schedulingInfo.priority = 0;
+        _schedulingInfo.deadline = TaskSchedulingInfo::Clock::time_point::max();
+        _enqueueTime = TaskSchedulingInfo::Clock::now();
+        firstStageExecutor->runScheduled(
+            [this] {
+                _queueWaitTime = std::chrono::duration_cast<std::chrono::nanoseconds>(TaskSchedulingInfo::Clock::now() -
+                                                                                      _enqueueTime);
+                RunStage();
+            },
+            schedulingInfo);
     }
 
     /**
@@ -331,23 +439,14 @@ protected:
      * pipeline tasks
      */
     void StopAndWait() {
-        Futures futures;
-        InferState state = InferState::Idle;
-        {
-            std::lock_guard<std::mutex> lock{_mutex};
-            state = _state;
-            if (state != InferState::Stop) {
-                _callback = {};
-                _state = InferState::Stop;
-                futures = std::move(_futures);
-            }
-        }
+        InferState state = _state.exchange(InferState::Stop);
         if (state != InferState::Stop) {
-            for (auto&& future : futures) {
-                if (future.valid()) {
-                    future.wait();
-                }
+            {
+                std::lock_guard<std::mutex> lock{_callbackMutex};
+                _callback = {};
+                _hasCallback = false;
             }
+            _completion->WaitAll();
         }
     }
 
@@ -382,79 +481,86 @@ protected:
 
 private:
     /**
-     * @brief Create a task with next pipeline stage.
-     * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
+     * @brief Runs the current pipeline stage and passes the next stage to its executor.
      * On last stage or if the exception is raised from `_pipeline` task
-     * the last stage task is called or passed to callback executor if it is presented. The last stage task call the
-     * callback, if it is presented, capture the `_promise` member and use it to forward completion or exception to the
-     * one of `_futures` member
-     * @param[in]  itStage Iterator to next stage of pipeline
-     * @param[in]  itEndStage End pipeline iterator
-     * @param[in]  callbackExecutor Executor that will run final stage with callback call
-     * @return A next stage task
+     * the last stage is called or passed to callback executor if it is presented.
      */
-    Task MakeNextStageTask(const Pipeline::iterator itStage,
-                           const Pipeline::iterator itEndStage,
-                           const ITaskExecutor::Ptr callbackExecutor) {
-        return std::bind(
-            [this, itStage, itEndStage](ITaskExecutor::Ptr& callbackExecutor) mutable {
-                std::exception_ptr currentException = nullptr;
-                auto& thisStage = *itStage;
-                auto itNextStage = itStage + 1;
+    void RunStage() {
+        std::exception_ptr currentException = nullptr;
+        const auto itStage = _itStage;
+        const auto itEndStage = _itEndStage;
+        const auto itNextStage = itStage + 1;
+        auto callbackExecutor = _stageCallbackExecutor;
+        try {
+            auto& stageTask = std::get<Stage_e::task>(*itStage);
+            IE_ASSERT(nullptr != stageTask);
+            stageTask();
+            if (itEndStage != itNextStage) {
+                auto& nextStageExecutor = std::get<Stage_e::executor>(*itNextStage);
+                IE_ASSERT(nullptr != nextStageExecutor);
+                _itStage = itNextStage;
+                nextStageExecutor->run([this] {
+                    RunStage();
+                });
+            }
+        } catch (...) {
+            currentException = std::current_exception();
+        }
+
+        if ((itEndStage == itNextStage) || (nullptr != currentException)) {
+            _stageException = currentException;
+            if (nullptr == callbackExecutor) {
+                RunLastStage();
+            } else {
+                callbackExecutor->run([this] {
+                    RunLastStage();
+                });
+            }
+        }
+    }
+
+    /**
+     * @brief Calls the callback, if it is presented, and completes the run forwarding the exception to Wait().
+     * The request becomes idle before the callback call, so the callback can start the next run.
+     */
+    void RunLastStage() {
+        auto currentException = std::move(_stageException);
+        const auto run = _run;
+        // The request may be destroyed as soon as the run is completed
+        auto completion = _completion;
+        SetIdleState();
+        if (_hasCallback) {
+            Callback callback;
+            {
+                std::lock_guard<std::mutex> lock{_callbackMutex};
+                std::swap(callback, _callback);
+            }
+            if (callback) {
                 try {
-                    auto& stageTask = std::get<Stage_e::task>(thisStage);
-                    IE_ASSERT(nullptr != stageTask);
-                    stageTask();
-                    if (itEndStage != itNextStage) {
-                        auto& nextStage = *itNextStage;
-                        auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
-                        IE_ASSERT(nullptr != nextStageExecutor);
-                        nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
-                    }
+                    callback(currentException);
                 } catch (...) {
                     currentException = std::current_exception();
                 }
-
-                if ((itEndStage == itNextStage) || (nullptr != currentException)) {
-                    auto lastStageTask = [this, currentException]() mutable {
-                        auto promise = std::move(_promise);
-                        Callback callback;
-                        {
-                            std::lock_guard<std::mutex> lock{_mutex};
-                            _state = InferState::Idle;
-                            std::swap(callback, _callback);
-                        }
-                        if (callback) {
-                            try {
-                                callback(currentException);
-                            } catch (...) {
-                                currentException = std::current_exception();
-                            }
-                            std::lock_guard<std::mutex> lock{_mutex};
-                            if (!_callback) {
-                                std::swap(callback, _callback);
-                            }
-                        }
-                        if (nullptr == currentException) {
-                            promise.set_value();
-                        } else {
-                            promise.set_exception(currentException);
-                        }
-                    };
-
-                    if (nullptr == callbackExecutor) {
-                        lastStageTask();
-                    } else {
-                        callbackExecutor->run(std::move(lastStageTask));
-                    }
+                std::lock_guard<std::mutex> lock{_callbackMutex};
+                if (!_callback) {
+                    std::swap(callback, _callback);
                 }
-            },
-            std::move(callbackExecutor));
+            }
+        }
+        completion->Complete(run, std::move(currentException));
     }
 
-    std::promise<void> _promise;
-    mutable std::mutex _mutex;
-    Futures _futures;
-    InferState _state = InferState::Idle;
+    std::shared_ptr<Completion> _completion;
+    std::atomic<InferState> _state{InferState::Idle};
+    std::atomic<bool> _hasCallback{false};
+    std::mutex _callbackMutex;
+    // State of the running pipeline
+    std::uint64_t _run = 0;
+    Pipeline::iterator _itStage;
+    Pipeline::iterator _itEndStage;
+    ITaskExecutor::Ptr _stageCallbackExecutor;
+    std::exception_ptr _stageException;
+    TaskSchedulingInfo::Clock::time_point _enqueueTime;
+    std::atomic<std::chrono::nanoseconds> _queueWaitTime{std::chrono::nanoseconds{0}};
 };
 }  // namespace InferenceEngine
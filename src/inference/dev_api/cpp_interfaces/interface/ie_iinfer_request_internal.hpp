@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -15,6 +16,7 @@
 #include "ie_preprocess_data.hpp"
 #include "openvino/core/node_output.hpp"
 #include "so_ptr.hpp"
+#include "threading/ie_itask_executor.hpp"
 
 namespace InferenceEngine {
 
@@ -78,6 +80,13 @@ public:
      */
     virtual std::map<std::string, InferenceEngineProfileInfo> GetPerformanceCounts() const;
 
+    /**
+     * @brief Queries hardware performance counters per layer collected along with the performance measures.
+     *  Note: not all plugins collect hardware counters
+     *  @return - a map of layer names to counter values by counter names, empty by default.
+     */
+    virtual std::map<std::string, std::map<std::string, uint64_t>> GetHardwareCounters() const;
+
     /**
      * @brief Set input/output data to infer
      * @note Memory allocation doesn't happen
@@ -173,6 +182,20 @@ public:
      */
     virtual void StartAsyncImpl();
 
+    /**
+     * @brief Sets priority and deadline used to schedule the next StartAsync() call in device task executors.
+     *        Priority and deadline apply to that call only, the following calls are scheduled with the default ones.
+     * @param info - scheduling metadata
+     */
+    virtual void SetSchedulingInfo(const TaskSchedulingInfo& info);
+
+    /**
+     * @brief Returns time the last started inference spent waiting in a task executor queue
+     *        before its first pipeline stage was started
+     * @return Queue wait time
+     */
+    virtual std::chrono::nanoseconds GetQueueWaitTime() const;
+
     /**
      * @brief Waits for the result to become available. Blocks until specified millis_timeout has elapsed or the result
      * becomes available, whichever comes first.
@@ -355,7 +378,8 @@ protected:
      * @note Needed to correctly handle ownership between objects.
      */
     std::shared_ptr<void> _so;
-    Callback _callback;  //!< A callback
+    Callback _callback;                  //!< A callback
+    TaskSchedulingInfo _schedulingInfo;  //!< Priority and deadline of the next started inference
 
 private:
     void* _userData = nullptr;
@@ -20,7 +20,10 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from the queues.
+ *        The queues are ordered by task priority and deadline (see InferenceEngine::TaskSchedulingInfo)
+ *        with aging, so tasks of lower priority are delayed but not starved.
+ *        Tasks with NUMA node preference are run by streams of that node, other streams take them only when idle.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -42,12 +45,16 @@ public:
 
     void run(Task task) override;
 
+    void runScheduled(Task task, const TaskSchedulingInfo& info) override;
+
     void Execute(Task task) override;
 
     int GetStreamId() override;
 
     int GetNumaNodeId() override;
 
+    int GetStreamSpan() override;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
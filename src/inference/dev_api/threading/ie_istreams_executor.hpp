@@ -104,6 +104,8 @@ public:
         int _threads_per_stream_small = 0;  //!< Threads per stream in small cores
         int _small_core_offset = 0;         //!< Calculate small core start offset when binding cpu cores
         bool _enable_hyper_thread = true;   //!< enable hyper thread
+        int _elasticSpan = 1;               //!< Largest number of streams whose threads a task can use while the
+                                            //!< other streams are idle, 1 disables it. TBB only, not for pinned threads
         enum StreamMode { DEFAULT, AGGRESSIVE, LESSAGGRESSIVE };
         enum PreferredCoreType {
             ANY,
@@ -161,6 +163,12 @@ public:
      */
     virtual int GetNumaNodeId() = 0;
 
+    /**
+     * @brief Return the number of streams whose threads the current task runs on
+     * @return The number of streams, 1 if the task runs on the threads of the current stream only
+     */
+    virtual int GetStreamSpan();
+
     /**
      * @brief Execute the task in the current thread using streams executor configuration and constraints
      * @param task A task to start
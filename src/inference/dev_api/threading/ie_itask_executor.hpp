@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -24,6 +25,33 @@ namespace InferenceEngine {
  */
 using Task = std::function<void()>;
 
+/**
+ * @brief Scheduling metadata that can be attached to a task.
+ *        Executors that keep a queue of pending tasks may use it to order the queue, other executors ignore it.
+ * @ingroup ie_dev_api_threading
+ */
+struct TaskSchedulingInfo {
+    /**
+     * @brief A clock used for deadlines
+     */
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Priority of the task. Tasks with larger value are served first, `0` is the default priority
+     */
+    int priority = 0;
+
+    /**
+     * @brief Point in time the task is expected to be started before. `Clock::time_point::max()` means no deadline
+     */
+    Clock::time_point deadline = Clock::time_point::max();
+
+    /**
+     * @brief NUMA node whose threads should preferably execute the task, `-1` means any node
+     */
+    int numaNodeId = -1;
+};
+
 /**
 * @interface ITaskExecutor
 * @ingroup ie_dev_api_threading
@@ -61,6 +89,14 @@ public:
      */
     virtual void run(Task task) = 0;
 
+    /**
+     * @brief Execute InferenceEngine::Task inside task executor context taking scheduling metadata into account.
+     *        Default implementation ignores the metadata and calls run()
+     * @param task A task to start
+     * @param info Priority and deadline of the task
+     */
+    virtual void runScheduled(Task task, const TaskSchedulingInfo& info);
+
     /**
      * @brief Execute all of the tasks and waits for its completion.
      *        Default runAndWait() method implementation uses run() pure virtual method
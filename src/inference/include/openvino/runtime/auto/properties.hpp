@@ -18,5 +18,44 @@ namespace intel_auto {
  */
 static constexpr Property<bool> device_bind_buffer{"DEVICE_BIND_BUFFER"};
 
+/**
+ * @brief Enum to define the policy used by multi device to select the device for the next inference request
+ */
+enum class SchedulePolicy {
+    DEVICE_PRIORITY = 0,      //!<  The first device with an idle infer request in the priority order
+    EARLIEST_COMPLETION = 1,  //!<  The device with the earliest expected completion by the measured latency and load
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const SchedulePolicy& policy) {
+    switch (policy) {
+    case SchedulePolicy::DEVICE_PRIORITY:
+        return os << "DEVICE_PRIORITY";
+    case SchedulePolicy::EARLIEST_COMPLETION:
+        return os << "EARLIEST_COMPLETION";
+    default:
+        throw ov::Exception{"Unsupported schedule policy"};
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, SchedulePolicy& policy) {
+    std::string str;
+    is >> str;
+    if (str == "DEVICE_PRIORITY") {
+        policy = SchedulePolicy::DEVICE_PRIORITY;
+    } else if (str == "EARLIEST_COMPLETION") {
+        policy = SchedulePolicy::EARLIEST_COMPLETION;
+    } else {
+        throw ov::Exception{"Unsupported schedule policy: " + str};
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief multi device setting that defines how the infer requests are distributed between the devices
+ */
+static constexpr Property<SchedulePolicy> schedule_policy{"MULTI_SCHEDULE_POLICY"};
+
 }  // namespace intel_auto
 }  // namespace ov
\ No newline at end of file
@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -16,6 +17,7 @@
 #include "openvino/core/node_output.hpp"
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/profiling_info.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/runtime/variable_state.hpp"
 
@@ -281,6 +283,25 @@ public:
      */
     void start_async();
 
+    /**
+     * @brief Starts inference of specified input(s) in asynchronous mode with scheduling hints.
+     * When the request has to wait for a device executor, requests of higher priority and requests with
+     * an earlier deadline are started first. Waiting requests of lower priority are aged, so they are delayed
+     * but not starved.
+     * @note Devices that do not queue inference tasks ignore the hints.
+     * @param priority Priority of the request relative to other requests of the same compiled model.
+     * @param deadline Time, measured from the call, the request is expected to be started within.
+     * Zero value means no deadline.
+     */
+    void start_async(ov::hint::Priority priority, std::chrono::milliseconds deadline = std::chrono::milliseconds{0});
+
+    /**
+     * @brief Returns time the last started inference spent waiting for a device executor
+     * before its execution has started.
+     * @return Queue wait time.
+     */
+    std::chrono::nanoseconds get_queue_wait_time() const;
+
     /**
      * @brief Waits for the result to become available. Blocks until the result
      * becomes available.
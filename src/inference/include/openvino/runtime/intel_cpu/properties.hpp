@@ -49,5 +49,161 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
 
 static constexpr Property<float> sparse_weights_decompression_rate{"SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief This property enables on the fly decompression of the compressed weights of FullyConnected layers.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * FP16, BF16 and INT8 weights of MatMul layers (with optional per output channel or per tensor zero points and scales
+ * applied after the conversion to FP32) are kept in memory in their original precision instead of being converted to
+ * FP32 at compile time. For small batches, which are bound by the weights reading, the weights are converted to FP32
+ * in registers right inside the matrix multiplication, which reduces the memory traffic. Larger batches are computed
+ * with the weights decompressed once when the layer is prepared. The activations are processed in FP32.
+ *
+ * @code
+ * ie.set_property(ov::intel_cpu::weights_decompression(true));
+ * @endcode
+ */
+static constexpr Property<bool> weights_decompression{"CPU_WEIGHTS_DECOMPRESSION"};
+
+/**
+ * @brief This property enables elastic streams.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * In throughput mode every stream runs one inference request at a time on its own fixed group of threads.
+ * With elastic streams, when there are fewer requests in flight than streams, an inference request runs its parallel
+ * regions on the threads of the idle streams as well. The extra threads are given back as soon as the load rises,
+ * so latency at low load approaches latency mode while peak throughput is not affected.
+ * Streams pinned to cores (ov::Affinity::CORE) are not elastic, streams bound to NUMA nodes only lend their threads
+ * to the streams of the same node. The model is prepared separately for every number of streams a request runs on,
+ * on the first inference with that number, so the first inferences at low load take longer.
+ *
+ * @code
+ * ie.set_property(ov::intel_cpu::elastic_streams(true));
+ * @endcode
+ */
+static constexpr Property<bool> elastic_streams{"CPU_ELASTIC_STREAMS"};
+
+/**
+ * @brief Read-only property that reports NUMA placement of the compiled model memory.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * Element `i` is the NUMA node the workspace of stream `i` is placed on, or -1 if the placement is left to the OS
+ * (streams are not bound to NUMA nodes or the system has a single NUMA node). Infer requests are assigned to these NUMA
+ * nodes in the round-robin fashion: their input and output tensors are placed on the assigned node and they are
+ * preferably executed by the streams of that node.
+ */
+static constexpr Property<std::vector<int>, PropertyMutability::RO> streams_numa_nodes{"CPU_STREAMS_NUMA_NODES"};
+
+/**
+ * @brief Read-only property that reports where the compilation time of the model was spent, in milliseconds.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The graphs of the streams are compiled concurrently, so every stage except `transformations` and `total` reports
+ * the slowest stream:
+ *  - `transformations` - common and CPU specific transformations of the model
+ *  - `graph_build` - creation of the nodes, graph optimizations, primitive descriptors selection and memory allocation
+ *  - `jit` - creation of the primitives including the JIT code generation
+ *  - `reorders` - execution of the constant part of the graph, mostly reorders of the weights
+ *  - `total` - wall time of the graphs compilation for all the streams
+ *  - `stream_<i>` - compilation time of the graph of the stream `i`, reported for every stream compiled together
+ *    with the model
+ *
+ * @code
+ * auto breakdown = compiled_model.get_property(ov::intel_cpu::compilation_breakdown);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, double>, PropertyMutability::RO> compilation_breakdown{
+    "CPU_COMPILATION_BREAKDOWN"};
+
+/**
+ * @brief This property enables collection of hardware performance counters for every node of the model.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The counters (`cycles`, `instructions`, `llc_references`, `llc_misses`) are collected only together with
+ * ov::enable_profiling and are reported in ov::ProfilingInfo::counters. The counters are sampled on the thread which
+ * executes the node, so for the nodes parallelized over several threads the absolute values cover the share of that
+ * thread while the ratios (IPC, LLC miss rate) are representative. Currently supported on Linux only. The counters
+ * which are not available (e.g. perf events are restricted by perf_event_paranoid or by the container) are omitted.
+ *
+ * @code
+ * auto compiled_model = core.compile_model(model, "CPU", ov::enable_profiling(true),
+ *                                          ov::intel_cpu::hardware_counters(true));
+ * @endcode
+ */
+static constexpr Property<bool> hardware_counters{"CPU_HARDWARE_COUNTERS"};
+
+/**
+ * @brief This property enables allocation of the tensors created by the infer requests from the memory pool.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The input and output tensors allocated by the infer requests and the temporary tensors of the input precision
+ * conversion are taken from the ov::PoolAllocator shared by all the compiled models of the ov::Core which enable the
+ * pool, so the memory released by one request is reused by the others instead of returning it to the system.
+ * The property can be set for the device or for a single compiled model.
+ *
+ * @code
+ * auto compiled_model = core.compile_model(model, "CPU", ov::intel_cpu::tensor_pool(true));
+ * @endcode
+ */
+static constexpr Property<bool> tensor_pool{"CPU_TENSOR_POOL"};
+
+/**
+ * @brief Read-only property that reports the statistics of the tensor pool, see ov::PoolAllocatorStatistics:
+ * `live_bytes`, `high_water_mark`, `cached_bytes`, `allocations`, `pool_hits`.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The compiled model reports an empty map if it doesn't use the pool.
+ *
+ * @code
+ * auto statistics = core.get_property("CPU", ov::intel_cpu::tensor_pool_statistics);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> tensor_pool_statistics{
+    "CPU_TENSOR_POOL_STATISTICS"};
+
+/**
+ * @brief This property sets the directory used to share the constant weights of the compiled models between processes.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The weights computed on the model compilation (e.g. reordered to the blocked layouts of the convolutions and fully
+ * connected layers) are stored to the files of the directory, so the other processes compiling the same model on the
+ * same hardware map the files read-only instead of keeping own copies of the weights. Using a directory on tmpfs (e.g. /dev/shm/ov_weights) keeps the
+ * weights in the shared memory, a subdirectory of ov::cache_dir keeps them between the runs. Empty value (default)
+ * disables the sharing. Currently supported on Linux only.
+ *
+ * @code
+ * auto compiled_model = core.compile_model(model, "CPU", ov::intel_cpu::shared_weights_dir("/dev/shm/ov_weights"));
+ * @endcode
+ */
+static constexpr Property<std::string> shared_weights_dir{"CPU_SHARED_WEIGHTS_DIR"};
+
+/**
+ * @brief This property enables the built-in runtime tracer of the CPU plugin.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The tracer records the stages of infer requests, the time requests spend in the executor queue and the execution of
+ * every node including reorders. The tracer is shared by all compiled models, so the property is set for the plugin
+ * only: compiling a model with it throws. The tracer can be enabled or disabled at any time, enabling it drops the
+ * events recorded before. Every thread keeps only the latest events.
+ * The recorded events are reported by the ov::intel_cpu::runtime_trace property.
+ *
+ * @code
+ * core.set_property("CPU", ov::intel_cpu::runtime_tracing(true));
+ * @endcode
+ */
+static constexpr Property<bool> runtime_tracing{"CPU_RUNTIME_TRACING"};
+
+/**
+ * @brief Read-only property that reports the events recorded by the runtime tracer in Chrome trace event format.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The returned JSON can be opened in chrome://tracing or https://ui.perfetto.dev
+ *
+ * @code
+ * std::ofstream("trace.json") << core.get_property("CPU", ov::intel_cpu::runtime_trace);
+ * @endcode
+ */
+static constexpr Property<std::string, PropertyMutability::RO> runtime_trace{"CPU_RUNTIME_TRACE"};
+
 }  // namespace intel_cpu
 }  // namespace ov
@@ -11,6 +11,8 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
+#include <map>
 #include <string>
 
 namespace ov {
@@ -62,6 +64,12 @@ struct ProfilingInfo {
      * @brief Node type.
      */
     std::string node_type;
+
+    /**
+     * @brief Hardware performance counters of the node averaged over its executions, e.g. `cycles`, `instructions`.
+     * Empty if the device doesn't collect hardware counters.
+     */
+    std::map<std::string, uint64_t> counters;
 };
 
 }  // namespace ov
\ No newline at end of file
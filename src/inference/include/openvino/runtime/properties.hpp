@@ -517,6 +517,15 @@ static constexpr Property<std::tuple<unsigned int, unsigned int, unsigned int>,
  */
 static constexpr Property<bool, PropertyMutability::RW> force_tbb_terminate{"FORCE_TBB_TERMINATE"};
 
+/**
+ * @brief Read-write property to set whether byte-identical constants of the read models share the memory
+ * value type: boolean
+ *   - True the constant payloads are hashed at read_model and the duplicates are replaced with views to one buffer
+ *   - False (default) the constants are kept as read by the frontend
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> deduplicate_weights{"DEDUPLICATE_WEIGHTS"};
+
 /**
  * @brief Namespace with device properties
  */
@@ -455,6 +455,14 @@ std::vector<ProfilingInfo> InferRequest::get_profiling_info() const {
             info.node_type = std::string{ieInfo.layer_type};
             ieInfos.erase(itIeInfo);
         }
+        const auto hwCounters = _impl->GetHardwareCounters();
+        if (!hwCounters.empty()) {
+            for (auto& info : infos) {
+                auto it = hwCounters.find(info.node_name);
+                if (it != hwCounters.end())
+                    info.counters = it->second;
+            }
+        }
         return infos;
     })
 }
@@ -463,6 +471,23 @@ void InferRequest::start_async() {
     OV_INFER_REQ_CALL_STATEMENT(_impl->StartAsync();)
 }
 
+void InferRequest::start_async(ov::hint::Priority priority, std::chrono::milliseconds deadline) {
+    OV_INFER_REQ_CALL_STATEMENT({
+        ie::TaskSchedulingInfo info;
+        // MEDIUM (default) priority maps to 0, the priority of tasks scheduled without hints
+        info.priority = static_cast<int>(priority) - static_cast<int>(ov::hint::Priority::DEFAULT);
+        if (deadline.count() > 0) {
+            info.deadline = ie::TaskSchedulingInfo::Clock::now() + deadline;
+        }
+        _impl->SetSchedulingInfo(info);
+        _impl->StartAsync();
+    })
+}
+
+std::chrono::nanoseconds InferRequest::get_queue_wait_time() const {
+    OV_INFER_REQ_CALL_STATEMENT(return _impl->GetQueueWaitTime();)
+}
+
 void InferRequest::wait() {
     OPENVINO_ASSERT(_impl != nullptr, "InferRequest was not initialized.");
     try {
@@ -92,6 +92,10 @@ std::map<std::string, InferenceEngineProfileInfo> IInferRequestInternal::GetPerf
     IE_THROW(NotImplemented);
 }
 
+std::map<std::string, std::map<std::string, uint64_t>> IInferRequestInternal::GetHardwareCounters() const {
+    return {};
+}
+
 std::shared_ptr<const ov::Node> IInferRequestInternal::findInputByNodeName(const std::string& name) const {
     for (const auto& input : GetInputs()) {
         if (input->get_friendly_name() == name)
@@ -445,6 +449,14 @@ void IInferRequestInternal::StartAsyncImpl() {
     IE_THROW(NotImplemented);
 }
 
+void IInferRequestInternal::SetSchedulingInfo(const TaskSchedulingInfo& info) {
+    _schedulingInfo = info;
+}
+
+std::chrono::nanoseconds IInferRequestInternal::GetQueueWaitTime() const {
+    IE_THROW(NotImplemented);
+}
+
 StatusCode IInferRequestInternal::Wait(int64_t millis_timeout) {
     IE_THROW(NotImplemented);
 }
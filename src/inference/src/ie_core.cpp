@@ -40,9 +40,12 @@
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/core.hpp"
 #include "openvino/util/common_util.hpp"
+#include "openvino/pass/manager.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/log.hpp"
 #include "openvino/util/shared_object.hpp"
 #include "so_extension.hpp"
+#include "transformations/common_optimizations/weights_deduplication.hpp"
 #include "xml_parse_utils.h"
 
 #ifdef OPENVINO_STATIC_LIBRARY
@@ -246,6 +249,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         };
 
         bool flag_allow_auto_batching = true;
+        bool flag_deduplicate_weights = false;
 
         void setAndUpdate(ov::AnyMap& config) {
             auto it = config.find(CONFIG_KEY(CACHE_DIR));
@@ -271,6 +275,12 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                 flag_allow_auto_batching = flag;
                 config.erase(it);
             }
+
+            it = config.find(ov::deduplicate_weights.name());
+            if (it != config.end()) {
+                flag_deduplicate_weights = it->second.as<bool>();
+                config.erase(it);
+            }
         }
 
         void setCacheForDevice(const std::string& dir, const std::string& name) {
@@ -647,14 +657,29 @@ public:
 
     ie::CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from file");
-        return InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions, ov_extensions, newAPI);
+        auto network = InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions, ov_extensions, newAPI);
+        DeduplicateWeights(network);
+        return network;
     }
 
     ie::CNNNetwork ReadNetwork(const std::string& model,
                                const ie::Blob::CPtr& weights,
                                bool frontendMode = false) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from memory");
-        return InferenceEngine::details::ReadNetwork(model, weights, extensions, ov_extensions, newAPI, frontendMode);
+        auto network =
+            InferenceEngine::details::ReadNetwork(model, weights, extensions, ov_extensions, newAPI, frontendMode);
+        DeduplicateWeights(network);
+        return network;
+    }
+
+    void DeduplicateWeights(ie::CNNNetwork& network) const {
+        if (!coreConfig.flag_deduplicate_weights || !network.getFunction())
+            return;
+        OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::DeduplicateWeights");
+        ov::pass::Manager manager;
+        auto deduplication = manager.register_pass<ov::pass::WeightsDeduplication>();
+        manager.run_passes(network.getFunction());
+        OPENVINO_DEBUG << "Weights deduplication saved " << deduplication->get_saved_bytes() << " bytes";
     }
 
     bool isNewAPI() const override {
@@ -1024,6 +1049,8 @@ public:
         } else if (name == ov::hint::allow_auto_batching.name()) {
             const auto flag = coreConfig.flag_allow_auto_batching;
             return decltype(ov::hint::allow_auto_batching)::value_type(flag);
+        } else if (name == ov::deduplicate_weights.name()) {
+            return decltype(ov::deduplicate_weights)::value_type(coreConfig.flag_deduplicate_weights);
         }
 
         IE_THROW() << "Exception is thrown while trying to call get_property with unsupported property: '" << name
@@ -4,10 +4,13 @@
 
 #include "threading/ie_cpu_streams_executor.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <climits>
 #include <condition_variable>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
@@ -26,7 +29,44 @@
 using namespace openvino;
 
 namespace InferenceEngine {
+namespace {
+// Queued tasks are ordered by the latest time they should be started at: the deadline for tasks with a deadline,
+// the enqueue time plus taskDefaultSlack for the others. So a task with a deadline overtakes the tasks without a
+// deadline only if it is more urgent than them, and a task without a deadline is overtaken only by the tasks which
+// are due before its own implicit deadline, so nothing starves.
+constexpr std::chrono::milliseconds taskDefaultSlack{1000};
+// Every priority level moves the task by taskAgingStep towards the head of the queue
+constexpr std::chrono::milliseconds taskAgingStep{100};
+// A task preferring a NUMA node is taken by the streams of other nodes only if the streams of its node are busy with
+// other tasks or did not take it within taskStealDelay, so the memory of the task is accessed locally when possible.
+constexpr std::chrono::milliseconds taskStealDelay{1};
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
+    struct QueuedTask {
+        Task _task;
+        TaskSchedulingInfo::Clock::time_point _key;
+        std::uint64_t _sequence;
+        TaskSchedulingInfo::Clock::time_point _stealTime;  // streams of other NUMA nodes can take the task after it
+    };
+
+    // Streams of a NUMA node wait for tasks on their own condition variable, so a task is given to a stream of the
+    // node it prefers
+    struct StreamsGroup {
+        std::condition_variable _queueCondVar;
+        int _streams = 0;          // streams of the node
+        int _busyStreams = 0;      // streams executing tasks
+        int _idleStreams = 0;      // streams waiting for tasks
+        int _notifiedStreams = 0;  // idle streams woken up to take a task, but not running yet
+    };
+
+    struct QueuedTaskOrder {
+        // max-heap comparator: the task with the earliest key (FIFO for equal keys) is on top of the heap
+        bool operator()(const QueuedTask& lhs, const QueuedTask& rhs) const {
+            return lhs._key != rhs._key ? lhs._key > rhs._key : lhs._sequence > rhs._sequence;
+        }
+    };
+
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         struct Observer : public custom::task_scheduler_observer {
@@ -208,6 +248,23 @@ struct CPUStreamsExecutor::Impl {
             }
 #endif
         }
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+        custom::task_arena& GetElasticArena(const int span) {
+            if (_elasticArenas.empty()) {
+                _elasticArenas.resize(_impl->_maxElasticSpan);
+            }
+            auto& arena = _elasticArenas[span - 1];
+            if (nullptr == arena) {
+                const auto concurrency = span * _impl->_config._threadsPerStream;
+                if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
+                    arena.reset(new custom::task_arena{custom::task_arena::constraints{_numaNodeId, concurrency}});
+                } else {
+                    arena.reset(new custom::task_arena{concurrency});
+                }
+            }
+            return *arena;
+        }
+#endif
         ~Stream() {
             {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
@@ -223,11 +280,14 @@ struct CPUStreamsExecutor::Impl {
         Impl* _impl = nullptr;
         int _streamId = 0;
         int _numaNodeId = 0;
+        int _span = 1;  // streams whose threads the current task runs on
         bool _execute = false;
         std::queue<Task> _taskQueue;
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         std::unique_ptr<custom::task_arena> _taskArena;
         std::unique_ptr<Observer> _observer;
+        // arenas of the elastic mode, arena `i` has threads of `i + 1` streams; created on first use
+        std::vector<std::unique_ptr<custom::task_arena>> _elasticArenas;
 #endif
     };
 
@@ -245,6 +305,13 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = numaNodes;
         }
+        _taskQueues.resize(1 + _usedNumaNodes.size());
+        _streamsGroups = std::vector<StreamsGroup>(_taskQueues.size());
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            // the same distribution of the streams between the NUMA nodes as in Stream constructor
+            const auto streamsPerNode = (_config._streams + _usedNumaNodes.size() - 1) / _usedNumaNodes.size();
+            ++_streamsGroups[1 + streamId / streamsPerNode]._streams;
+        }
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         if (ThreadBindingType::HYBRID_AWARE == config._threadBindingType) {
             const auto core_types = custom::info::core_types();
@@ -274,46 +341,194 @@ struct CPUStreamsExecutor::Impl {
                 total_streams_on_core_types.push_back({type, sum});
             }
         }
+        // Threads of the idle streams are taken by the TBB market from their arenas on demand, so a task can use them
+        // from a wider arena. Pinned threads are not shared, so CORES and HYBRID_AWARE bindings are not elastic.
+        if (_config._elasticSpan > 1 && _config._streams > 1 && _config._threadsPerStream > 0 &&
+            (ThreadBindingType::NONE == _config._threadBindingType ||
+             ThreadBindingType::NUMA == _config._threadBindingType)) {
+            // with NUMA binding a task can only borrow the threads of streams of the same NUMA node
+            const auto streamsPerNode = (_config._streams + static_cast<int>(_usedNumaNodes.size()) - 1) /
+                                        static_cast<int>(_usedNumaNodes.size());
+            _maxElasticSpan = std::min(_config._elasticSpan,
+                                       ThreadBindingType::NUMA == _config._threadBindingType ? streamsPerNode
+                                                                                             : _config._streams);
+        }
 #endif
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                const auto localQueueIdx = GetQueueIndex(_streams.local()->_numaNodeId);
+                auto& group = _streamsGroups[localQueueIdx];
+                bool busy = false;
                 for (bool stopped = false; !stopped;) {
                     Task task;
+                    int span = 1;
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                        if (busy) {
+                            --group._busyStreams;
+                            busy = false;
+                        }
+                        std::vector<QueuedTask>* queue = nullptr;
+                        for (;;) {
+                            auto stealTime = TaskSchedulingInfo::Clock::time_point::max();
+                            queue = SelectQueue(localQueueIdx, stealTime);
+                            if (nullptr != queue || (stopped = _isStopped)) {
+                                break;
+                            }
+                            ++group._idleStreams;
+                            if (stealTime == TaskSchedulingInfo::Clock::time_point::max()) {
+                                group._queueCondVar.wait(lock);
+                            } else {
+                                group._queueCondVar.wait_until(lock, stealTime);
+                            }
+                            --group._idleStreams;
+                            group._notifiedStreams = std::max(0, group._notifiedStreams - 1);
+                        }
+                        if (nullptr != queue) {
+                            std::pop_heap(queue->begin(), queue->end(), QueuedTaskOrder{});
+                            task = std::move(queue->back()._task);
+                            queue->pop_back();
+                            --_queuedTasks;
+                            ++group._busyStreams;
+                            busy = true;
+                            if (_maxElasticSpan > 1) {
+                                // streams are split evenly between running and queued tasks, so a task gets
+                                // extra threads only while there are idle streams
+                                const int load = ++_runningTasks + static_cast<int>(_queuedTasks);
+                                span = std::max(1, std::min(_maxElasticSpan, _config._streams / load));
+                            }
                         }
                     }
                     if (task) {
-                        Execute(task, *(_streams.local()));
+                        Execute(task, *(_streams.local()), span);
+                        if (_maxElasticSpan > 1) {
+                            --_runningTasks;
+                        }
                     }
                 }
             });
         }
     }
 
-    void Enqueue(Task task) {
+    void Enqueue(Task task, const TaskSchedulingInfo& info = {}) {
+        // The key is the latest start time of the task shifted by its priority. It does not depend on the current
+        // time, so the heap order stays valid while tasks are waiting: the slack of all the tasks decreases equally.
+        const auto now = TaskSchedulingInfo::Clock::now();
+        const auto latestStart =
+            info.deadline == TaskSchedulingInfo::Clock::time_point::max() ? now + taskDefaultSlack : info.deadline;
+        const auto key = latestStart - info.priority * taskAgingStep;
+        StreamsGroup* group = nullptr;
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            const auto queueIdx = GetQueueIndex(info.numaNodeId);
+            auto& queue = _taskQueues[queueIdx];
+            queue.push_back({std::move(task), key, _taskSequence++, now + taskStealDelay});
+            std::push_heap(queue.begin(), queue.end(), QueuedTaskOrder{});
+            ++_queuedTasks;
+            group = SelectStreamsToWake(queueIdx);
+            if (nullptr != group) {
+                ++group->_notifiedStreams;
+            }
         }
-        _queueCondVar.notify_one();
+        if (nullptr != group) {
+            group->_queueCondVar.notify_one();
+        }
+    }
+
+    // Number of idle streams of the group which are not woken up to take a task yet. Must be called under the lock.
+    int AvailableStreams(const std::size_t groupIdx) const {
+        return _streamsGroups[groupIdx]._idleStreams - _streamsGroups[groupIdx]._notifiedStreams;
     }
 
-    void Execute(const Task& task, Stream& stream) {
+    // The NUMA node is saturated if its queue has more tasks than the node has streams not executing other tasks.
+    // Must be called under the lock.
+    bool IsSaturated(const std::size_t queueIdx) const {
+        const auto& group = _streamsGroups[queueIdx];
+        return static_cast<int>(_taskQueues[queueIdx].size()) > group._streams - group._busyStreams;
+    }
+
+    // The task is given to a stream of its NUMA node, if the node is not saturated. If the task has no preference or
+    // the node is saturated, it is given to an idle stream of the node with the most idle streams.
+    // Returns nullptr if no stream needs to be woken up. Must be called under the lock.
+    StreamsGroup* SelectStreamsToWake(const std::size_t queueIdx) {
+        if (0 != queueIdx && !IsSaturated(queueIdx)) {
+            // if all the free streams of the node are already woken up, one of them takes the task when it is done
+            return AvailableStreams(queueIdx) > 0 ? &_streamsGroups[queueIdx] : nullptr;
+        }
+        StreamsGroup* selected = nullptr;
+        int selectedStreams = 0;
+        for (std::size_t groupIdx = 0; groupIdx < _streamsGroups.size(); ++groupIdx) {
+            if (AvailableStreams(groupIdx) > selectedStreams) {
+                selected = &_streamsGroups[groupIdx];
+                selectedStreams = AvailableStreams(groupIdx);
+            }
+        }
+        return selected;
+    }
+
+    // queue 0 keeps tasks without NUMA node preference, queue `i + 1` keeps tasks preferring `_usedNumaNodes[i]`
+    std::size_t GetQueueIndex(const int numaNodeId) const {
+        if (numaNodeId < 0) {
+            return 0;
+        }
+        const auto it = std::find(_usedNumaNodes.begin(), _usedNumaNodes.end(), numaNodeId);
+        return it == _usedNumaNodes.end() ? 0 : 1 + std::distance(_usedNumaNodes.begin(), it);
+    }
+
+    // A stream takes the earliest task of its NUMA node queue and of the queue of tasks without preference.
+    // If both are empty it takes the earliest task of saturated NUMA nodes or a task which the streams of its node
+    // did not take in time, otherwise `stealTime` is set to the time the stream can take such a task at.
+    // Returns nullptr if there is no task for the stream. Must be called under the `_mutex` lock.
+    std::vector<QueuedTask>* SelectQueue(const std::size_t localQueueIdx,
+                                         TaskSchedulingInfo::Clock::time_point& stealTime) {
+        if (0 == _queuedTasks) {
+            return nullptr;
+        }
+        std::vector<QueuedTask>* selected = nullptr;
+        auto consider = [&selected](std::vector<QueuedTask>& queue) {
+            if (!queue.empty() && (nullptr == selected || QueuedTaskOrder{}(selected->front(), queue.front()))) {
+                selected = &queue;
+            }
+        };
+        consider(_taskQueues[0]);
+        consider(_taskQueues[localQueueIdx]);
+        if (nullptr == selected) {
+            const auto now = TaskSchedulingInfo::Clock::now();
+            for (std::size_t queueIdx = 1; queueIdx < _taskQueues.size(); ++queueIdx) {
+                auto& queue = _taskQueues[queueIdx];
+                if (queue.empty()) {
+                    continue;
+                }
+                if (IsSaturated(queueIdx) || queue.front()._stealTime <= now) {
+                    consider(queue);
+                } else {
+                    stealTime = std::min(stealTime, queue.front()._stealTime);
+                }
+            }
+        }
+        return selected;
+    }
+
+    void Execute(const Task& task, Stream& stream, const int span = 1) {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+        // the span of the outer task is restored when the task is executed from it (see Defer)
+        const auto outerSpan = stream._span;
+        stream._span = span;
         auto& arena = stream._taskArena;
-        if (nullptr != arena) {
-            arena->execute(std::move(task));
-        } else {
-            task();
+        try {
+            if (span > 1) {
+                stream.GetElasticArena(span).execute(std::move(task));
+            } else if (nullptr != arena) {
+                arena->execute(std::move(task));
+            } else {
+                task();
+            }
+        } catch (...) {
+            stream._span = outerSpan;
+            throw;
         }
+        stream._span = outerSpan;
 #else
         task();
 #endif
@@ -341,8 +556,12 @@ struct CPUStreamsExecutor::Impl {
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
     std::mutex _mutex;
-    std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    std::vector<std::vector<QueuedTask>> _taskQueues;  // binary heaps ordered by QueuedTaskOrder, see GetQueueIndex
+    std::vector<StreamsGroup> _streamsGroups;          // streams of the NUMA nodes, indexed as the task queues
+    std::size_t _queuedTasks = 0;
+    std::uint64_t _taskSequence = 0;
+    int _maxElasticSpan = 1;               // the largest number of streams a task can span, 1 if not elastic
+    std::atomic<int> _runningTasks = {0};  // tasks executed by the streams, counted in the elastic mode only
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
@@ -368,6 +587,11 @@ int CPUStreamsExecutor::GetNumaNodeId() {
     return stream->_numaNodeId;
 }
 
+int CPUStreamsExecutor::GetStreamSpan() {
+    auto stream = _impl->_streams.local();
+    return stream->_span;
+}
+
 CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) : _impl{new Impl{config}} {}
 
 CPUStreamsExecutor::~CPUStreamsExecutor() {
@@ -375,7 +599,9 @@ CPUStreamsExecutor::~CPUStreamsExecutor() {
         std::lock_guard<std::mutex> lock(_impl->_mutex);
         _impl->_isStopped = true;
     }
-    _impl->_queueCondVar.notify_all();
+    for (auto& group : _impl->_streamsGroups) {
+        group._queueCondVar.notify_all();
+    }
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
             thread.join();
@@ -395,4 +621,12 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::runScheduled(Task task, const TaskSchedulingInfo& info) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), info);
+    }
+}
+
 }  // namespace InferenceEngine
@@ -22,6 +22,10 @@
 namespace InferenceEngine {
 IStreamsExecutor::~IStreamsExecutor() {}
 
+int IStreamsExecutor::GetStreamSpan() {
+    return 1;
+}
+
 std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() const {
     return {
         CONFIG_KEY(CPU_THROUGHPUT_STREAMS),
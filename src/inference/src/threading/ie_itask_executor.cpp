@@ -11,6 +11,10 @@
 
 namespace InferenceEngine {
 
+void ITaskExecutor::runScheduled(Task task, const TaskSchedulingInfo&) {
+    run(std::move(task));
+}
+
 void ITaskExecutor::runAndWait(const std::vector<Task>& tasks) {
     std::vector<std::packaged_task<void()>> packagedTasks;
     std::vector<std::future<void>> futures;
@@ -40,6 +40,16 @@ TEST(InferRequestOVTests, throwsOnUninitializedStartAsync) {
     ASSERT_THROW(req.start_async(), ov::Exception);
 }
 
+TEST(InferRequestOVTests, throwsOnUninitializedStartAsyncWithPriority) {
+    ov::InferRequest req;
+    ASSERT_THROW(req.start_async(ov::hint::Priority::HIGH, std::chrono::milliseconds{10}), ov::Exception);
+}
+
+TEST(InferRequestOVTests, throwsOnUninitializedGetQueueWaitTime) {
+    ov::InferRequest req;
+    ASSERT_THROW(req.get_queue_wait_time(), ov::Exception);
+}
+
 TEST(InferRequestOVTests, throwsOnUninitializedWait) {
     ov::InferRequest req;
     ASSERT_THROW(req.wait(), ov::Exception);
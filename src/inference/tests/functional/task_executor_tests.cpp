@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
 #include <future>
 
 #include <gtest/gtest.h>
@@ -187,6 +188,209 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+class CPUStreamsExecutorSchedulingTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        executor = std::make_shared<CPUStreamsExecutor>(
+            IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1, IStreamsExecutor::ThreadBindingType::NONE});
+        // occupy the only stream, so all the following tasks are queued
+        futures.emplace_back(async(executor, [this] {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                isStarted = true;
+            }
+            cv.notify_all();
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [this] { return !isBlocked; });
+        }));
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this] { return isStarted; });
+    }
+
+    void TearDown() override {
+        releaseAndWait();
+    }
+
+    void schedule(int id, const TaskSchedulingInfo& info) {
+        auto task = std::make_shared<std::packaged_task<void()>>([this, id] {
+            order.push_back(id);
+        });
+        futures.emplace_back(task->get_future());
+        executor->runScheduled([task] {
+            (*task)();
+        }, info);
+    }
+
+    std::vector<int> releaseAndWait() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            isBlocked = false;
+        }
+        cv.notify_all();
+        for (auto& future : futures) {
+            future.wait();
+        }
+        return order;
+    }
+
+    static TaskSchedulingInfo makeInfo(int priority, std::chrono::milliseconds deadline) {
+        TaskSchedulingInfo info;
+        info.priority = priority;
+        info.deadline = TaskSchedulingInfo::Clock::now() + deadline;
+        return info;
+    }
+
+    std::shared_ptr<CPUStreamsExecutor> executor;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool isStarted = false;
+    bool isBlocked = true;
+    std::vector<int> order;
+    std::vector<Future> futures;
+};
+
+TEST_F(CPUStreamsExecutorSchedulingTests, queuedTasksAreOrderedByPriorityAndDeadline) {
+    TaskSchedulingInfo low;
+    low.priority = -1;
+    TaskSchedulingInfo high;
+    high.priority = 1;
+    schedule(0, low);
+    schedule(1, {});
+    schedule(2, high);
+    schedule(3, {});
+    schedule(4, makeInfo(0, -std::chrono::hours{1}));
+
+    ASSERT_EQ((std::vector<int>{4, 2, 1, 3, 0}), releaseAndWait());
+}
+
+TEST_F(CPUStreamsExecutorSchedulingTests, urgentFutureDeadlinesOvertakeTasksWithoutDeadline) {
+    schedule(0, {});
+    schedule(1, {});
+    // due long after the tasks without a deadline, so it does not overtake them
+    schedule(2, makeInfo(0, std::chrono::hours{1}));
+    schedule(3, makeInfo(0, std::chrono::milliseconds{50}));
+    // low priority delays the task, but it is still more urgent than the tasks without a deadline
+    schedule(4, makeInfo(-1, std::chrono::milliseconds{10}));
+    schedule(5, {});
+
+    ASSERT_EQ((std::vector<int>{3, 4, 0, 1, 5, 2}), releaseAndWait());
+}
+
+class CPUStreamsExecutorNumaTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        numaNodes = getAvailableNUMANodes();
+        executor = std::make_shared<CPUStreamsExecutor>(
+            IStreamsExecutor::Config{"TestCPUStreamsExecutor", streamsPerNode * static_cast<int>(numaNodes.size()), 1,
+                                     IStreamsExecutor::ThreadBindingType::NUMA});
+        // every stream takes one of the tasks, so all the streams are started and idle after that
+        const auto streams = streamsPerNode * numaNodes.size();
+        std::atomic<std::size_t> started{0};
+        std::vector<Future> futures;
+        for (std::size_t i = 0; i < streams; ++i) {
+            futures.emplace_back(async(executor, [&] {
+                ++started;
+                while (started < streams) {
+                    std::this_thread::yield();
+                }
+            }));
+        }
+        for (auto& future : futures) {
+            future.wait();
+        }
+        waitStreamsAreIdle();
+    }
+
+    // a stream is busy until it comes back for the next task, which is a bit later than its task is completed
+    static void waitStreamsAreIdle() {
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+
+    // runs the task preferring the NUMA node, the future returns the NUMA node of the stream executed the task
+    std::future<int> runOnNode(int numaNodeId, std::function<void()> body = {}) {
+        auto task = std::make_shared<std::packaged_task<int()>>([this, body] {
+            if (body) {
+                body();
+            }
+            return executor->GetNumaNodeId();
+        });
+        auto future = task->get_future();
+        TaskSchedulingInfo info;
+        info.numaNodeId = numaNodeId;
+        executor->runScheduled([task] {
+            (*task)();
+        }, info);
+        return future;
+    }
+
+    static constexpr int streamsPerNode = 2;
+    std::vector<int> numaNodes;
+    std::shared_ptr<CPUStreamsExecutor> executor;
+};
+
+TEST_F(CPUStreamsExecutorNumaTests, tasksAreExecutedByStreamsOfPreferredNode) {
+    for (int iteration = 0; iteration < 10; ++iteration) {
+        for (auto numaNodeId : numaNodes) {
+            waitStreamsAreIdle();
+            ASSERT_EQ(numaNodeId, runOnNode(numaNodeId).get());
+        }
+    }
+}
+
+TEST_F(CPUStreamsExecutorNumaTests, tasksAreStolenWhenStreamsOfPreferredNodeAreBusy) {
+    if (numaNodes.size() < 2) {
+        GTEST_SKIP() << "The test requires several NUMA nodes";
+    }
+    const auto busyNode = numaNodes.front();
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    std::atomic<int> started{0};
+    std::vector<std::future<int>> blockers;
+    std::shared_ptr<void> releaseGuard(nullptr, [&](void*) {
+        release.set_value();
+    });
+    for (int i = 0; i < streamsPerNode; ++i) {
+        blockers.emplace_back(runOnNode(busyNode, [&] {
+            ++started;
+            released.wait();
+        }));
+    }
+    while (started < streamsPerNode) {
+        std::this_thread::yield();
+    }
+
+    auto stolen = runOnNode(busyNode);
+    ASSERT_EQ(std::future_status::ready, stolen.wait_for(std::chrono::seconds{10}));
+    ASSERT_NE(busyNode, stolen.get());
+
+    releaseGuard.reset();
+    for (auto& blocker : blockers) {
+        ASSERT_EQ(busyNode, blocker.get());
+    }
+}
+
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+TEST(CPUStreamsExecutorElasticTests, loneTaskRunsOnThreadsOfIdleStreams) {
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 4, 1, IStreamsExecutor::ThreadBindingType::NONE};
+    config._elasticSpan = config._streams;
+    auto executor = std::make_shared<CPUStreamsExecutor>(config);
+    int span = 0, threads = 0, nestedSpan = 0, nestedThreads = 0;
+    async(executor, [&] {
+        span = executor->GetStreamSpan();
+        threads = parallel_get_max_threads();
+        // the tasks executed from the task run on the threads of the stream only
+        executor->Execute([&] {
+            nestedSpan = executor->GetStreamSpan();
+            nestedThreads = parallel_get_max_threads();
+        });
+    }).wait();
+    ASSERT_EQ(config._streams, span);
+    ASSERT_EQ(config._streams, threads);
+    ASSERT_EQ(1, nestedSpan);
+    ASSERT_EQ(1, nestedThreads);
+}
+#endif
+
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
 static auto Executors = ::testing::Values(
@@ -208,6 +412,14 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
     },
+    [] {
+        auto streams = getNumberOfLogicalCPUCores(false);
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                        streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+        config._elasticSpan = streams;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     }
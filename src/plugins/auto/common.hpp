@@ -57,6 +57,7 @@ struct WorkerInferRequest {
     std::exception_ptr _exceptionPtr = nullptr;
     std::list<Time>    _startTimes;
     std::list<Time>    _endTimes;
+    Time               _submitTime;
     int                _index = 0;
 };
 
@@ -123,6 +124,7 @@ public:
     bool                                           _needPerfCounters;
     bool                                           _batchingDisabled = {false};
     bool                                           _bindBuffer = false;
+    bool                                           _earliestCompletionSchedule = false;
     virtual ~MultiScheduleContext() = default;
 };
 
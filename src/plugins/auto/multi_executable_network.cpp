@@ -101,6 +101,7 @@ IE::Parameter MultiExecutableNetwork::GetMetric(const std::string& name) const {
             ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
 
             // Configs
+            ov::PropertyName{ov::intel_auto::schedule_policy.name(), ov::PropertyMutability::RO},
             // device priority can be changed on-the-fly in MULTI
             ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RW}
         };
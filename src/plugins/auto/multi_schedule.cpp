@@ -143,6 +143,12 @@ void MultiSchedule::GenerateWorkers(const std::string& device,
     _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<IE::ThreadSafeQueue<IE::Task>>(new IE::ThreadSafeQueue<IE::Task>);
     auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
     idleWorkerRequests.set_capacity(numRequests);
+    // the device load is tracked only when the schedule policy needs it
+    DeviceLoad* deviceLoad = nullptr;
+    if (_multiSContext->_earliestCompletionSchedule) {
+        _deviceLoads[device] = std::unique_ptr<DeviceLoad>(new DeviceLoad(numRequests));
+        deviceLoad = _deviceLoads[device].get();
+    }
     int num = 0;
     for (auto&& workerRequest : workerRequests) {
         workerRequest._inferRequest = {executableNetwork->CreateInferRequest(), executableNetwork._so};
@@ -150,9 +156,16 @@ void MultiSchedule::GenerateWorkers(const std::string& device,
         workerRequestPtr->_index = num++;
         IE_ASSERT(idleWorkerRequests.try_push(workerRequestPtr) == true);
         workerRequest._inferRequest->SetCallback(
-            [workerRequestPtr, this, device, idleWorkerRequestsPtr](std::exception_ptr exceptionPtr) mutable {
+            [workerRequestPtr, this, device, idleWorkerRequestsPtr, deviceLoad](std::exception_ptr exceptionPtr) mutable {
                 IdleGuard<NotBusyWorkerRequests> idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                 workerRequestPtr->_exceptionPtr = exceptionPtr;
+                if (deviceLoad) {
+                    if (nullptr == exceptionPtr) {
+                        deviceLoad->UpdateLatency(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - workerRequestPtr->_submitTime).count());
+                    }
+                    deviceLoad->_inFlight--;
+                }
                 {
                     auto capturedTask = std::move(workerRequestPtr->_task);
                     capturedTask();
@@ -165,6 +178,8 @@ void MultiSchedule::GenerateWorkers(const std::string& device,
                     if (_inferPipelineTasks.try_pop(t)) {
                         ScheduleToWorkerInferRequest(std::move(t));
                     } else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t)) {
+                        if (deviceLoad)
+                            deviceLoad->_queued--;
                         ScheduleToWorkerInferRequest(std::move(t), device);
                     }
                 }
@@ -173,6 +188,9 @@ void MultiSchedule::GenerateWorkers(const std::string& device,
 }
 
 bool MultiSchedule::ScheduleToWorkerInferRequest(IE::Task inferPipelineTask, DeviceName preferred_device) {
+    if (_multiSContext->_earliestCompletionSchedule) {
+        return ScheduleToEarliestCompletion(inferPipelineTask, preferred_device);
+    }
     std::vector<DeviceInformation> devices;
     devices = [&] {
         std::lock_guard<std::mutex> lock(_multiSContext->_mutex);
@@ -196,6 +214,43 @@ bool MultiSchedule::ScheduleToWorkerInferRequest(IE::Task inferPipelineTask, Dev
     return false;
 }
 
+bool MultiSchedule::ScheduleToEarliestCompletion(IE::Task& inferPipelineTask, const DeviceName& preferred_device) {
+    DeviceName device = preferred_device;
+    if (device.empty()) {
+        std::lock_guard<std::mutex> lock(_multiSContext->_mutex);
+        auto earliest = std::numeric_limits<double>::max();
+        for (auto&& deviceInfo : _multiSContext->_devicePriorities) {
+            // when all the devices are busy and not measured yet, the task waits for the first device in the priority
+            if (device.empty())
+                device = deviceInfo.deviceName;
+            auto itLoad = _deviceLoads.find(deviceInfo.deviceName);
+            if (itLoad == _deviceLoads.end())
+                continue;
+            const auto expected = itLoad->second->ExpectedCompletion();
+            if (expected < earliest) {
+                earliest = expected;
+                device = deviceInfo.deviceName;
+            }
+        }
+    }
+    auto itLoad = _deviceLoads.find(device);
+    if (itLoad == _deviceLoads.end()) {
+        // the device list is empty when the schedule is being destroyed
+        _inferPipelineTasks.push(std::move(inferPipelineTask));
+        return false;
+    }
+    auto& load = *itLoad->second;
+    load._inFlight++;
+    if (RunPipelineTask(inferPipelineTask, _idleWorkerRequests[device], preferred_device)) {
+        return true;
+    }
+    load._inFlight--;
+    // the device has no vacant requests, the task waits for the device rather than goes to the first free one
+    load._queued++;
+    _inferPipelineTasksDeviceSpecific[device]->push(std::move(inferPipelineTask));
+    return false;
+}
+
 bool MultiSchedule::RunPipelineTask(IE::Task& inferPipelineTask,
     NotBusyWorkerRequests& idleWorkerRequests,
     const DeviceName& preferred_device) {
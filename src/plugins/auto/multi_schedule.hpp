@@ -5,6 +5,9 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <atomic>
+#include <limits>
+
 #include "schedule.hpp"
 
 #ifdef  MULTIUNITTEST
@@ -19,11 +22,37 @@ struct ThisRequestExecutor : public IE::ITaskExecutor {
     explicit ThisRequestExecutor(WorkerInferRequest** ptr): _workptrptr{ptr} {}
     void run(IE::Task task) override {
         (*_workptrptr)->_task = std::move(task);
+        (*_workptrptr)->_submitTime = std::chrono::steady_clock::now();
         (*_workptrptr)->_inferRequest->StartAsync();
     };
     WorkerInferRequest** _workptrptr = nullptr;
 };
 
+// online model of the device used by the EARLIEST_COMPLETION schedule policy
+struct DeviceLoad {
+    explicit DeviceLoad(unsigned int numWorkers) : _numWorkers{numWorkers > 0 ? numWorkers : 1} {}
+    // exponentially weighted moving average of the infer request execution time (with the weight 1/8 of the new sample)
+    void UpdateLatency(int64_t latency) {
+        auto average = _latency.load(std::memory_order_relaxed);
+        while (!_latency.compare_exchange_weak(average, average == 0 ? latency : average + (latency - average) / 8,
+                                               std::memory_order_relaxed)) {}
+    }
+    // time to complete the new request: the requests running on the device and waiting for it are drained first,
+    // devices that were not measured yet are probed while they have an idle request
+    double ExpectedCompletion() const {
+        const auto latency = _latency.load(std::memory_order_relaxed);
+        const auto inFlight = _inFlight.load(std::memory_order_relaxed);
+        if (latency == 0)
+            return inFlight < static_cast<int>(_numWorkers) ? 0.0 : std::numeric_limits<double>::max();
+        const auto pending = inFlight + _queued.load(std::memory_order_relaxed) + 1;
+        return static_cast<double>(latency) * pending / _numWorkers;
+    }
+    std::atomic<int64_t> _latency = {0};   // nanoseconds
+    std::atomic<int>     _inFlight = {0};  // requests started on the device
+    std::atomic<int>     _queued = {0};    // tasks waiting in the device specific queue
+    const unsigned int   _numWorkers;
+};
+
 class MultiSchedule : public Schedule, public IE::ITaskExecutor {
 public:
     using Ptr = std::shared_ptr<MultiSchedule>;
@@ -47,6 +76,7 @@ protected:
     virtual void GenerateWorkers(const std::string& device, const IE::SoExecutableNetworkInternal& executableNetwork);
     static bool RunPipelineTask(IE::Task& inferPipelineTask, NotBusyWorkerRequests& idleWorkerRequests, const DeviceName& preferred_device);
     virtual bool ScheduleToWorkerInferRequest(IE::Task, DeviceName preferred_device = "");
+    bool ScheduleToEarliestCompletion(IE::Task& inferPipelineTask, const DeviceName& preferred_device);
     std::string GetLogTag() const noexcept;
 
 protected:
@@ -54,6 +84,7 @@ protected:
     DeviceMap<std::unique_ptr<IE::ThreadSafeQueue<IE::Task>>> _inferPipelineTasksDeviceSpecific;
     DeviceMap<NotBusyWorkerRequests>                          _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                _workerRequests;
+    DeviceMap<std::unique_ptr<DeviceLoad>>                    _deviceLoads;
     mutable std::mutex                                        _mutex;
     std::atomic_size_t                                        _numRequestsCreated = {0};
     MultiScheduleContext::Ptr                                 _multiSContext;
@@ -238,6 +238,8 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetConfig(const std::stri
                 return ov::util::from_string(val, ov::auto_batch_timeout);
             } else if (name == ov::intel_auto::device_bind_buffer) {
                 return val == PluginConfigParams::YES ? true : false;
+            } else if (name == ov::intel_auto::schedule_policy) {
+                return ov::util::from_string(val, ov::intel_auto::schedule_policy);
             } else if (name == ov::log::level) {
                 return ov::util::from_string(val, ov::log::level);
             } else if (name == ov::device::priorities) {
@@ -577,6 +579,13 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
     multiSContext->_needPerfCounters = enablePerfCounters;
     multiSContext->_core = GetCore();
     multiSContext->_LogTag = _LogTag;
+    auto policyIter = fullConfig.find(ov::intel_auto::schedule_policy.name());
+    if (policyIter != fullConfig.end()) {
+        multiSContext->_config[policyIter->first] = policyIter->second;
+        multiSContext->_earliestCompletionSchedule =
+            ov::util::from_string(policyIter->second, ov::intel_auto::schedule_policy) ==
+            ov::intel_auto::SchedulePolicy::EARLIEST_COMPLETION;
+    }
     IExecutableNetworkInternal::Ptr impl;
     auto tmpiter = fullConfig.find(ov::intel_auto::device_bind_buffer.name());
     if (tmpiter != fullConfig.end() && tmpiter->second == PluginConfigParams::YES) {
@@ -24,6 +24,7 @@ struct PluginConfig {
                 _devicePriority(""),
                 _modelPriority(1),
                 _deviceBindBuffer(false),
+                _schedulePolicy("DEVICE_PRIORITY"),
                 _logLevel("LOG_NONE") {
         adjustKeyMapValues();
     }
@@ -37,6 +38,7 @@ struct PluginConfig {
             res.push_back(ov::hint::allow_auto_batching.name());
             res.push_back(ov::log::level.name());
             res.push_back(ov::intel_auto::device_bind_buffer.name());
+            res.push_back(ov::intel_auto::schedule_policy.name());
             res.push_back(ov::auto_batch_timeout.name());
             return res;
         }();
@@ -65,6 +67,7 @@ struct PluginConfig {
                                                        RW_property(ov::hint::performance_mode.name()),
                                                        RW_property(ov::hint::num_requests.name()),
                                                        RW_property(ov::intel_auto::device_bind_buffer.name()),
+                                                       RW_property(ov::intel_auto::schedule_policy.name()),
                                                        RW_property(ov::cache_dir.name())};
             std::vector<ov::PropertyName> supportedProperties;
             supportedProperties.reserve(roProperties.size() + rwProperties.size());
@@ -152,6 +155,12 @@ struct PluginConfig {
                 else
                     IE_THROW() << "Unsupported config value: " << kvp.second
                             << " for key: " << kvp.first;
+            } else if (kvp.first == ov::intel_auto::schedule_policy.name()) {
+                if (kvp.second == "DEVICE_PRIORITY" || kvp.second == "EARLIEST_COMPLETION")
+                    _schedulePolicy = kvp.second;
+                else
+                    IE_THROW() << "Unsupported config value: " << kvp.second
+                            << " for key: " << kvp.first;
             } else if (kvp.first == ov::device::priorities.name()) {
                 if (!kvp.second.empty())
                     ParsePrioritiesDevices(kvp.second);
@@ -257,6 +266,7 @@ struct PluginConfig {
             _keyConfigMap[ov::intel_auto::device_bind_buffer.name()] = PluginConfigParams::YES;
         else
             _keyConfigMap[ov::intel_auto::device_bind_buffer.name()] = PluginConfigParams::NO;
+        _keyConfigMap[ov::intel_auto::schedule_policy.name()] = _schedulePolicy;
 
         _keyConfigMap[ov::auto_batch_timeout.name()] = _batchTimeout;
 
@@ -277,6 +287,7 @@ struct PluginConfig {
     std::string _devicePriority;
     int _modelPriority;
     bool _deviceBindBuffer;
+    std::string _schedulePolicy;
     std::string _logLevel;
     PerfHintsConfig  _perfHintsConfig;
     // Add this flag to check if user app sets hint with none value that is equal to the default value of hint.
@@ -3,6 +3,7 @@
 //
 
 #include "async_infer_request.h"
+#include "utils/tracer.hpp"
 #include <memory>
 
 ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr& inferRequest,
@@ -10,6 +11,27 @@ ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(const InferenceEngine::IInfe
                                                     const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
     : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
     static_cast<InferRequestBase*>(inferRequest.get())->SetAsyncRequest(this);
+    // requests are preferably executed by the streams of the NUMA node their tensors are placed on
+    _numaNodeId = static_cast<InferRequestBase*>(inferRequest.get())->getNumaNodeId();
+    _schedulingInfo.numaNodeId = _numaNodeId;
+    _pipeline = {{taskExecutor, [this, inferRequest] {
+        if (_submitTime != 0) {
+            Tracer::record("Executor", "AsyncInferRequest::Queued", _submitTime, Tracer::now());
+            _submitTime = 0;
+        }
+        inferRequest->InferImpl();
+    }}};
+}
+
+void ov::intel_cpu::AsyncInferRequest::StartAsync_ThreadUnsafe() {
+    _submitTime = Tracer::isEnabled() ? Tracer::now() : 0;
+    InferenceEngine::AsyncInferRequestThreadSafeDefault::StartAsync_ThreadUnsafe();
+}
+
+void ov::intel_cpu::AsyncInferRequest::SetSchedulingInfo(const InferenceEngine::TaskSchedulingInfo& info) {
+    auto numaInfo = info;
+    numaInfo.numaNodeId = _numaNodeId;
+    InferenceEngine::AsyncInferRequestThreadSafeDefault::SetSchedulingInfo(numaInfo);
 }
 
 ov::intel_cpu::AsyncInferRequest::~AsyncInferRequest() {
@@ -18,6 +18,16 @@ public:
                       const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
                       const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
     ~AsyncInferRequest();
+
+    void SetSchedulingInfo(const InferenceEngine::TaskSchedulingInfo& info) override;
+
+protected:
+    void StartAsync_ThreadUnsafe() override;
+
+private:
+    int _numaNodeId = -1;
+    // time the request was queued to the streams executor at, zero if the runtime tracing is disabled
+    uint64_t _submitTime = 0;
 };
 
 }   // namespace intel_cpu
@@ -17,6 +17,7 @@
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include <cpu/x64/cpu_isa_traits.hpp>
 
 namespace ov {
@@ -88,6 +89,35 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             } else {
                 fcSparseWeiDecompressionRate = val_f;
             }
+        } else if (key == ov::intel_cpu::weights_decompression.name()) {
+            if (val == PluginConfigParams::YES) fcWeightsDecompression = true;
+            else if (val == PluginConfigParams::NO) fcWeightsDecompression = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::weights_decompression.name()
+                                   << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::hardware_counters.name()) {
+            if (val == PluginConfigParams::YES) collectHardwareCounters = true;
+            else if (val == PluginConfigParams::NO) collectHardwareCounters = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::hardware_counters.name()
+                                   << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::tensor_pool.name()) {
+            if (val == PluginConfigParams::YES) tensorPool = true;
+            else if (val == PluginConfigParams::NO) tensorPool = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::tensor_pool.name()
+                                   << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::elastic_streams.name()) {
+            if (val == PluginConfigParams::YES) elasticStreams = true;
+            else if (val == PluginConfigParams::NO) elasticStreams = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::elastic_streams.name()
+                                   << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::shared_weights_dir.name()) {
+            sharedWeightsDir = val;
+        } else if (key == ov::intel_cpu::runtime_tracing.name()) {
+            // the tracer is process wide, so it is enabled by the plugin property only, see Engine::SetConfig
+            IE_THROW() << "Property " << key << " can be set only for the CPU plugin, not for a compiled model";
         } else if (key == PluginConfigParams::KEY_PERF_COUNT) {
             if (val == PluginConfigParams::YES) collectPerfCounters = true;
             else if (val == PluginConfigParams::NO) collectPerfCounters = false;
@@ -30,11 +30,16 @@ struct Config {
     };
 
     bool collectPerfCounters = false;
+    bool collectHardwareCounters = false;
+    bool tensorPool = false;
+    bool elasticStreams = false;
+    std::string sharedWeightsDir = "";
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
     float fcSparseWeiDecompressionRate = 1.0f;
+    bool fcWeightsDecompression = false;
     size_t rtCacheCapacity = 5000ul;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
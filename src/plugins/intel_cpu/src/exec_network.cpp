@@ -13,6 +13,8 @@
 #include "serialize.h"
 #include "ngraph/type/element_type.hpp"
 #include "nodes/memory.hpp"
+#include "utils/pool_blob_allocator.hpp"
+#include "utils/tracer.hpp"
 #include <threading/ie_executor_manager.hpp>
 #define FIX_62820 0
 #if FIX_62820 && ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
@@ -25,10 +27,13 @@
 #include <ie_ngraph_utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
@@ -94,6 +99,9 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
     }
 
+    if (!_cfg.sharedWeightsDir.empty())
+        _numaNodesWeights.setSharedStorage(std::make_shared<SharedWeightsStorage>(_cfg.sharedWeightsDir));
+
     if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = _plugin->executorManager()->getExecutor("CPU");
@@ -101,6 +109,24 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig, isFloatModel);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
         _cfg.streamExecutorConfig._threads = streamsExecutorConfig._threads;
+        _numaPlacement = streamsExecutorConfig._streams != 0 &&
+                         streamsExecutorConfig._threadBindingType == IStreamsExecutor::ThreadBindingType::NUMA &&
+                         getAvailableNUMANodes().size() > 1;
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+        // the threads pinned to cores are not lent to other streams, with NUMA binding a task runs on the streams
+        // of its own node only
+        if (_cfg.elasticStreams && streamsExecutorConfig._streams > 1 && streamsExecutorConfig._threadsPerStream > 0 &&
+            (streamsExecutorConfig._threadBindingType == IStreamsExecutor::ThreadBindingType::NONE ||
+             streamsExecutorConfig._threadBindingType == IStreamsExecutor::ThreadBindingType::NUMA)) {
+            const auto streams = streamsExecutorConfig._streams;
+            const auto numaNodes = static_cast<int>(
+                std::min(static_cast<size_t>(streams), getAvailableNUMANodes().size()));
+            _elasticSpan = streamsExecutorConfig._threadBindingType == IStreamsExecutor::ThreadBindingType::NUMA
+                               ? (streams + numaNodes - 1) / numaNodes
+                               : streams;
+            streamsExecutorConfig._elasticSpan = _elasticSpan;
+        }
+#endif
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         _taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
 #else
@@ -119,18 +145,35 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
         _callbackExecutor = _taskExecutor;
     }
 
+    const auto compilationBegin = std::chrono::steady_clock::now();
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
+    _elasticGraphs.resize((_elasticSpan - 1) * streams);
     if (_cfg.streamExecutorConfig._streams != 0) {
         auto all_graphs_ready = [&] {
             return std::all_of(_graphs.begin(), _graphs.end(), [&] (Graph& graph) {
                 return graph.IsReady();
             });
         };
+        // The executor has a thread per stream only if the requests are not muxed into the single queue. Then every
+        // task holds its stream until all the tasks are started, so each stream gets exactly one task and the graphs
+        // are compiled concurrently instead of retrying the streams which were skipped by the executor.
+        const bool waitAllStreams = !cfg.exclusiveAsyncRequests;
+        std::mutex startedMutex;
+        std::condition_variable startedCondVar;
+        int started = 0;
         do {
             for (auto&& task : tasks) {
-                task = [this] {
+                task = [&] {
+                    if (waitAllStreams) {
+                        std::unique_lock<std::mutex> lock{startedMutex};
+                        if (++started == streams) {
+                            startedCondVar.notify_all();
+                        } else {
+                            startedCondVar.wait(lock, [&] { return started >= streams; });
+                        }
+                    }
                     ExecNetwork::GetGraph();
                 };
             }
@@ -139,6 +182,25 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         ExecNetwork::GetGraph();
     }
+    const std::chrono::duration<double, std::milli> compilationTime = std::chrono::steady_clock::now() - compilationBegin;
+    for (size_t i = 0; i < _graphs.size(); i++) {
+        auto& graph = _graphs[i];
+        const auto& times = graph.getCompilationTimes();
+        _compilationBreakdown["graph_build"] = std::max(_compilationBreakdown["graph_build"], times.build);
+        _compilationBreakdown["jit"] = std::max(_compilationBreakdown["jit"], times.jit);
+        _compilationBreakdown["reorders"] = std::max(_compilationBreakdown["reorders"], times.reorders);
+        if (graph.IsReady())
+            _compilationBreakdown["stream_" + std::to_string(i)] = times.build + times.jit + times.reorders;
+    }
+    _compilationBreakdown["transformations"] = 0;
+    _compilationBreakdown["total"] = compilationTime.count();
+    for (const auto& graph : _graphs) {
+        const auto numaNodeId = graph.getNumaNodeId();
+        if (numaNodeId >= 0 &&
+            std::find(_requestsNumaNodes.begin(), _requestsNumaNodes.end(), numaNodeId) == _requestsNumaNodes.end()) {
+            _requestsNumaNodes.push_back(numaNodeId);
+        }
+    }
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
@@ -167,26 +229,36 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
 ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
     int streamId = 0;
     int numaNodeId = 0;
+    int span = 1;
     auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
     if (nullptr != streamsExecutor) {
         streamId = streamsExecutor->GetStreamId();
         numaNodeId = streamsExecutor->GetNumaNodeId();
+        span = std::min(streamsExecutor->GetStreamSpan(), _elasticSpan);
     }
-    auto graphLock = GraphGuard::Lock(_graphs[streamId % _graphs.size()]);
+    auto graphLock = GraphGuard::Lock(span > 1 ? _elasticGraphs[(span - 2) * _graphs.size() + streamId % _graphs.size()]
+                                               : _graphs[streamId % _graphs.size()]);
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
         auto makeGraph = [&] {
             try {
+                Config config;
                 {
                     std::lock_guard<std::mutex> lock{*_mutex.get()};
-                    graphLock._graph.setConfig(_cfg);
+                    config = _cfg;
                 }
+                graphLock._graph.setConfig(config);
+                graphLock._graph.setNumaNodeId(_numaPlacement ? numaNodeId : -1);
                 graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId], _mutex);
             } catch(...) {
                 exception = std::current_exception();
             }
         };
-        if (nullptr != streamsExecutor) {
+        if (span > 1) {
+            // the nodes prepare the per thread data and split the work for the threads of the arena the graph is
+            // created in, so the graph of the task spanning several streams is created in the arena of the task
+            makeGraph();
+        } else if (nullptr != streamsExecutor) {
             streamsExecutor->Execute(makeGraph);
         } else {
             makeGraph();
@@ -203,14 +275,21 @@ void ExecNetwork::setProperty(const std::map<std::string, std::string> &properti
         std::lock_guard<std::mutex> lock{*_mutex.get()};
         _cfg.readProperties(properties);
     }
-    for (auto& g : _graphs) {
-        auto graphLock = GraphGuard::Lock(g);
-        if (graphLock._graph.IsReady()) {
-            graphLock._graph.setProperty(properties);
+    for (auto graphs : {&_graphs, &_elasticGraphs}) {
+        for (auto& g : *graphs) {
+            auto graphLock = GraphGuard::Lock(g);
+            if (graphLock._graph.IsReady()) {
+                graphLock._graph.setProperty(properties);
+            }
         }
     }
 }
 
+void ExecNetwork::setTensorPool(const std::shared_ptr<ov::PoolAllocator>& pool) {
+    _tensorPool = pool;
+    _blobAllocator = std::make_shared<PoolBlobAllocator>(pool);
+}
+
 InferenceEngine::IInferRequestInternal::Ptr ExecNetwork::CreateInferRequest() {
     return CreateAsyncInferRequestFromSync<AsyncInferRequest>();
 }
@@ -312,6 +391,15 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::hint::inference_precision.name()),
             RO_property(ov::hint::performance_mode.name()),
             RO_property(ov::hint::num_requests.name()),
+            RO_property(ov::intel_cpu::elastic_streams.name()),
+            RO_property(ov::intel_cpu::streams_numa_nodes.name()),
+            RO_property(ov::intel_cpu::compilation_breakdown.name()),
+            RO_property(ov::intel_cpu::weights_decompression.name()),
+            RO_property(ov::intel_cpu::hardware_counters.name()),
+            RO_property(ov::intel_cpu::runtime_trace.name()),
+            RO_property(ov::intel_cpu::tensor_pool.name()),
+            RO_property(ov::intel_cpu::tensor_pool_statistics.name()),
+            RO_property(ov::intel_cpu::shared_weights_dir.name()),
         };
     }
 
@@ -354,6 +442,35 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = config.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
+    } else if (name == ov::intel_cpu::elastic_streams) {
+        const bool elastic = config.elasticStreams;
+        return decltype(ov::intel_cpu::elastic_streams)::value_type(elastic);
+    } else if (name == ov::intel_cpu::streams_numa_nodes) {
+        std::vector<int> numaNodes;
+        for (const auto& g : _graphs) {
+            numaNodes.push_back(g.getNumaNodeId());
+        }
+        return decltype(ov::intel_cpu::streams_numa_nodes)::value_type(numaNodes);
+    } else if (name == ov::intel_cpu::compilation_breakdown) {
+        return decltype(ov::intel_cpu::compilation_breakdown)::value_type(_compilationBreakdown);
+    } else if (name == ov::intel_cpu::weights_decompression) {
+        const bool weightsDecompression = config.fcWeightsDecompression;
+        return decltype(ov::intel_cpu::weights_decompression)::value_type(weightsDecompression);
+    } else if (name == ov::intel_cpu::hardware_counters) {
+        const bool hardwareCounters = config.collectHardwareCounters;
+        return decltype(ov::intel_cpu::hardware_counters)::value_type(hardwareCounters);
+    } else if (name == ov::intel_cpu::runtime_trace) {
+        return decltype(ov::intel_cpu::runtime_trace)::value_type(Tracer::exportChromeTrace());
+    } else if (name == ov::intel_cpu::tensor_pool) {
+        const bool tensorPool = config.tensorPool;
+        return decltype(ov::intel_cpu::tensor_pool)::value_type(tensorPool);
+    } else if (name == ov::intel_cpu::shared_weights_dir) {
+        return decltype(ov::intel_cpu::shared_weights_dir)::value_type(config.sharedWeightsDir);
+    } else if (name == ov::intel_cpu::tensor_pool_statistics) {
+        std::map<std::string, uint64_t> statistics;
+        if (_tensorPool)
+            statistics = poolStatisticsToMap(_tensorPool->get_statistics());
+        return decltype(ov::intel_cpu::tensor_pool_statistics)::value_type(statistics);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -10,6 +10,7 @@
 #include "graph.h"
 #include "extension_mngr.h"
 #include <threading/ie_thread_local.hpp>
+#include <openvino/runtime/pool_allocator.hpp>
 
 #include <vector>
 #include <memory>
@@ -40,6 +41,18 @@ public:
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    /**
+     * @brief Sets time of the model transformations done by the plugin before the network creation, in milliseconds
+     */
+    void setTransformationsTime(double time) {
+        _compilationBreakdown["transformations"] = time;
+    }
+
+    /**
+     * @brief Sets the pool which allocates the tensors created by the infer requests
+     */
+    void setTensorPool(const std::shared_ptr<ov::PoolAllocator>& pool);
+
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
@@ -58,6 +71,12 @@ protected:
     mutable std::shared_ptr<std::mutex>         _mutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
+    // memory of graphs and requests is placed on NUMA nodes explicitly only when streams are bound to NUMA nodes
+    bool                                        _numaPlacement = false;
+    // the largest number of streams a task of elastic streams runs on, 1 if the streams are not elastic
+    int                                         _elasticSpan = 1;
+    // NUMA nodes of the streams, infer requests are assigned to them in the round-robin fashion
+    std::vector<int>                            _requestsNumaNodes;
     std::string                                 _name;
     struct GraphGuard : public Graph {
         std::mutex  _mutex;
@@ -69,7 +88,15 @@ protected:
 
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
+    // graphs of the tasks running on several elastic streams, the graph of a stream for `span` streams is
+    // `(span - 2) * _graphs.size() + streamId`. They are created on first use in the arena of the task.
+    mutable std::deque<GraphGuard>              _elasticGraphs;
     mutable NumaNodesWeights                    _numaNodesWeights;
+    // reported by ov::intel_cpu::compilation_breakdown
+    std::map<std::string, double>               _compilationBreakdown;
+    // the tensors of the infer requests are allocated by the system allocator if not set
+    std::shared_ptr<ov::PoolAllocator>          _tensorPool;
+    std::shared_ptr<InferenceEngine::IAllocator> _blobAllocator;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <chrono>
 #include <string>
 #include <map>
 #include <vector>
@@ -13,6 +14,7 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <sstream>
 
 #include "graph.h"
 #include "graph_dumper.h"
@@ -37,10 +39,13 @@
 #include <ie_plugin_config.hpp>
 
 #include "utils/general_utils.h"
+#include "utils/tracer.hpp"
+#include "utils/hardware_counters.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/node_dumper.h"
 #include "utils/ngraph_utils.hpp"
 #include "utils/cpu_utils.hpp"
+#include "utils/numa_utils.hpp"
 #include "utils/verbose.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
@@ -80,16 +85,20 @@ void Graph::CreateGraph(NET &net, const ExtensionManager::Ptr& extMgr,
 
     if (IsReady())
         ForgetGraphData();
-    // disable weights caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // disable weights caching if graph was created only once and the weights are not shared with other processes
+    weightsCache = config.streamExecutorConfig._streams != 1 || (w_cache && w_cache->getSharedStorage()) ? w_cache
+                                                                                                          : nullptr;
 
     rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
     sharedMutex = mutex;
     rtScratchPad = std::make_shared<DnnlScratchPad>(getEngine());
 
+    const auto begin = std::chrono::steady_clock::now();
     Replicate(net, extMgr);
+    const std::chrono::duration<double, std::milli> replicateTime = std::chrono::steady_clock::now() - begin;
 
     InitGraph();
+    compilationTimes.build += replicateTime.count();
 
     CPU_DEBUG_CAP_ENABLE(serialize(*this));
 }
@@ -100,8 +109,9 @@ void Graph::CreateGraph(const std::vector<NodePtr> &graphNodes,
                               std::string name) {
     if (IsReady())
         ForgetGraphData();
-    // disable weights caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // disable weights caching if graph was created only once and the weights are not shared with other processes
+    weightsCache = config.streamExecutorConfig._streams != 1 || (w_cache && w_cache->getSharedStorage()) ? w_cache
+                                                                                                          : nullptr;
 
     rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
     rtScratchPad = std::make_shared<DnnlScratchPad>(getEngine());
@@ -396,6 +406,14 @@ void Graph::Replicate(const CNNNetwork &network, const ExtensionManager::Ptr& ex
 }
 
 void Graph::InitGraph() {
+    using clock = std::chrono::steady_clock;
+    auto elapsed = [](clock::time_point& begin) {
+        const auto end = clock::now();
+        const double time = std::chrono::duration<double, std::milli>(end - begin).count();
+        begin = end;
+        return time;
+    };
+    auto stageBegin = clock::now();
     GraphOptimizer optimizer;
 
     SortTopologically();
@@ -438,9 +456,12 @@ void Graph::InitGraph() {
         this->reuse_io_tensors = false;
     }
 
+    initSharedWeights();
     Allocate();
+    compilationTimes.build = elapsed(stageBegin);
 
     CreatePrimitives();
+    compilationTimes.jit = elapsed(stageBegin);
 
 #ifndef CPU_DEBUG_CAPS
     for (auto &graphNode : graphNodes) {
@@ -448,8 +469,15 @@ void Graph::InitGraph() {
     }
 #endif
     ExtractConstantAndExecutableNodes();
+    if (haveDynNodes) {
+        symbolicShapes.init(executableGraphNodes);
+        DEBUG_LOG("Symbolic shape functions are compiled for ", symbolicShapes.compiledNodesCount(), " of ",
+                  executableGraphNodes.size(), " executable nodes");
+    }
 
     ExecuteConstantNodesOnly();
+    StoreSharedWeights();
+    compilationTimes.reorders = elapsed(stageBegin);
     status = haveDynNodes ? Status::ReadyDynamic : Status::ReadyStatic;
 }
 
@@ -550,7 +578,22 @@ void Graph::ExecuteConstantNodesOnly() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    auto isMapped = [this](const NodePtr & node) {
+        if (sharedWeightsMapped.empty() || node->getChildEdges().empty())
+            return false;
+        for (size_t i = 0; i < node->getChildEdges().size(); ++i) {
+            auto edgePtr = node->getChildEdgeAt(i);
+            if (!edgePtr || !sharedWeightsMapped.count(edgePtr->getMemoryPtr()->GetData()))
+                return false;
+        }
+        return true;
+    };
+
     for (const auto &node : constantGraphNodes) {
+        // the outputs were computed by other process
+        if (isMapped(node))
+            continue;
+
         if (weightsCache) {
             auto sharedOutputs = acquireSharedOutputs(node);
 
@@ -566,6 +609,80 @@ void Graph::ExecuteConstantNodesOnly() const {
     }
 }
 
+void Graph::initSharedWeights() {
+    sharedWeightsMapped.clear();
+    sharedWeightsToStore.clear();
+    sharedWeightsConstantHashes.clear();
+    sharedWeights = weightsCache ? weightsCache->getSharedStorage() : nullptr;
+    if (!sharedWeights)
+        return;
+
+    // the weights are shared only by the same graphs: the same nodes, implementations and edges. The constants are
+    // hashed only for the weights to be mapped or stored, see sharedWeightsKey.
+    auto hashString = [](const std::string& str, uint64_t seed) {
+        return SharedWeightsStorage::hash(str.data(), str.size(), seed);
+    };
+    uint64_t key = 0;
+    for (const auto& node : graphNodes) {
+        key = hashString(node->getName(), key);
+        key = hashString(node->getTypeStr(), key);
+        key = hashString(node->getPrimitiveDescriptorType(), key);
+    }
+    for (const auto& edge : graphEdges)
+        key = hashString(edge->name(), key);
+
+    std::stringstream stream;
+    stream << std::hex << key;
+    sharedWeightsGraphKey = stream.str();
+}
+
+uint64_t Graph::sharedWeightsConstantsHash(const NodePtr& node) {
+    // the weights computed by the constant node depend on the data of the original constants it is computed from
+    uint64_t result = 0;
+    std::unordered_set<const Node*> visited;
+    std::vector<const Node*> stack{node.get()};
+    while (!stack.empty()) {
+        const auto current = stack.back();
+        stack.pop_back();
+        if (!visited.insert(current).second)
+            continue;
+        if (current->getType() == Type::Input) {
+            auto found = sharedWeightsConstantHashes.find(current);
+            if (found == sharedWeightsConstantHashes.end()) {
+                uint64_t hash = 0;
+                auto memory = static_cast<const node::Input*>(current)->getMemoryPtr();
+                if (memory && memory->GetData())
+                    hash = SharedWeightsStorage::hash(memory->GetData(), memory->GetSize(), 0);
+                found = sharedWeightsConstantHashes.emplace(current, hash).first;
+            }
+            result = SharedWeightsStorage::hash(&found->second, sizeof(found->second), result);
+            continue;
+        }
+        for (size_t i = 0; i < current->getParentEdges().size(); i++)
+            stack.push_back(current->getParentEdgeAt(i)->getParent().get());
+    }
+    return result;
+}
+
+std::string Graph::sharedWeightsKey(const EdgePtr& edge) {
+    const auto& desc = edge->getDesc();
+    std::stringstream stream;
+    stream << edge->name() << ";" << desc.getPrecision().name() << ";" << desc.serializeFormat() << ";"
+           << desc.getShape().toString() << ";" << desc.getCurrentMemSize();
+    const auto str = stream.str();
+    stream.str("");
+    stream << sharedWeightsGraphKey << "_" << std::hex
+           << SharedWeightsStorage::hash(str.data(), str.size(), sharedWeightsConstantsHash(edge->getParent()));
+    return stream.str();
+}
+
+void Graph::StoreSharedWeights() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::StoreSharedWeights");
+    for (const auto& edgeAndKey : sharedWeightsToStore)
+        sharedWeights->store(edgeAndKey.second, *edgeAndKey.first->getMemoryPtr());
+    sharedWeightsToStore.clear();
+}
+
 static bool isReorderAvailable(const MemoryDescPtr& parentDesc, const MemoryDescPtr& childDesc, const dnnl::engine& eng) {
     auto definedParentDesc = parentDesc->isDefined() ? parentDesc : MemoryDescUtils::makeDummyDesc(*parentDesc);
     memory::desc srcMemDesc = MemoryDescUtils::convertToDnnlMemoryDesc(definedParentDesc)->getDnnlDesc();
@@ -719,6 +836,15 @@ void Graph::AllocateWithReuse() {
                 if (edge->getParent()->getType() == Type::Input) {
                     auto constNode = std::static_pointer_cast<node::Input>(edge->getParent());
                     edge->reuse(std::const_pointer_cast<Memory>(constNode->getMemoryPtr()));
+                } else if (sharedWeights && edge->getDesc().isDefined()) {
+                    const auto key = sharedWeightsKey(edge);
+                    if (auto memory = sharedWeights->map(key, edge->getDesc(), getEngine())) {
+                        edge->reuse(memory);
+                        sharedWeightsMapped.insert(memory->GetData());
+                    } else {
+                        edge->externalAllocate(weightsCache);
+                        sharedWeightsToStore.emplace_back(edge, key);
+                    }
                 } else {
                     edge->externalAllocate(weightsCache);
                 }
@@ -792,6 +918,11 @@ void Graph::AllocateWithReuse() {
 
     memWorkspace = std::make_shared<Memory>(eng);
     memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
+    // The memory of dynamic edges is allocated by the stream threads during inference, so it is placed by first touch.
+    // The static workspace is allocated here once and is explicitly placed on the NUMA node of the stream.
+    if (numaNodeId >= 0) {
+        bindToNumaNode(memWorkspace->GetData(), total_size, numaNodeId);
+    }
 
     if (edge_clusters.empty())
         return;
@@ -1075,6 +1206,7 @@ void Graph::InferStatic(InferRequestBase* request) {
     for (const auto& node : executableGraphNodes) {
         VERBOSE(node, config.verbose);
         PERF(node, config.collectPerfCounters);
+        HW_PERF(node, config.collectPerfCounters && config.collectHardwareCounters);
 
         if (request)
             request->ThrowIfCanceled();
@@ -1115,7 +1247,7 @@ void Graph::InferDynamic(InferRequestBase* request) {
             return;
         }
         if (node->isDynamicNode()) {
-            node->updateShapes();
+            symbolicShapes.updateShapes(node_indx);
         }
         if (--waveFrontCount[node_indx] == 0) {
             tg.run([=, &updateDynParams](){ updateDynParams(node_indx, stop_indx); });
@@ -1148,7 +1280,7 @@ void Graph::InferDynamic(InferRequestBase* request) {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = executableGraphNodes[prepareCounter];
             if (node->isDynamicNode()) {
-                node->updateShapes();
+                symbolicShapes.updateShapes(prepareCounter);
                 node->updateDynamicParams();
             }
         }
@@ -1162,6 +1294,7 @@ void Graph::InferDynamic(InferRequestBase* request) {
             auto& node = executableGraphNodes[inferCounter];
             VERBOSE(node, config.verbose);
             PERF(node, config.collectPerfCounters);
+            HW_PERF(node, config.collectPerfCounters && config.collectHardwareCounters);
 
             if (request)
                 request->ThrowIfCanceled();
@@ -1173,6 +1306,9 @@ void Graph::InferDynamic(InferRequestBase* request) {
 inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const {
     DUMP(node, config, infer_count);
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, node->profiling.execute);
+    TraceScope trace;
+    if (Tracer::isEnabled())
+        trace.start(node->getTraceCategory(), node->getTraceName());
 
     if (node->isDynamicNode()) {
         node->executeDynamic(stream);
@@ -1316,6 +1452,15 @@ void Graph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEnginePr
     }
 }
 
+void Graph::GetHardwareCounters(std::map<std::string, std::map<std::string, uint64_t>> &countersMap) const {
+    // fused and merged nodes are executed as a part of the node, so they don't have own counters
+    for (const auto& node : executableGraphNodes) {
+        auto counters = node->HwCounters().average();
+        if (!counters.empty())
+            countersMap[node->getName()] = std::move(counters);
+    }
+}
+
 void Graph::setConfig(const Config &cfg) {
     config = cfg;
 }
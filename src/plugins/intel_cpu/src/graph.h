@@ -12,11 +12,14 @@
 #include "edge.h"
 #include "cache/multi_cache.h"
 #include "dnnl_scratch_pad.h"
+#include "symbolic_shapes.h"
+#include "shared_weights_storage.hpp"
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <unordered_set>
 
 namespace ov {
 namespace intel_cpu {
@@ -48,6 +51,30 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
+    /**
+     * @brief Sets NUMA node the graph memory should be placed on, -1 leaves the placement to the OS
+     */
+    void setNumaNodeId(int numaNodeId) {
+        this->numaNodeId = numaNodeId;
+    }
+
+    int getNumaNodeId() const {
+        return numaNodeId;
+    }
+
+    /**
+     * @brief Time of the graph compilation stages in milliseconds
+     */
+    struct CompilationTimes {
+        double build = 0;
+        double jit = 0;
+        double reorders = 0;
+    };
+
+    const CompilationTimes& getCompilationTimes() const {
+        return compilationTimes;
+    }
+
     template<typename NET>
     void CreateGraph(NET &network,
                      const ExtensionManager::Ptr& extMgr,
@@ -115,6 +142,7 @@ public:
     }
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
+    void GetHardwareCounters(std::map<std::string, std::map<std::string, uint64_t>> &countersMap) const;
 
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
@@ -208,6 +236,10 @@ protected:
         graphEdges.clear();
         _normalizePreprocMap.clear();
         syncNodesInds.clear();
+        symbolicShapes.clear();
+        sharedWeightsMapped.clear();
+        sharedWeightsToStore.clear();
+        sharedWeightsConstantHashes.clear();
     }
     Status status { Status::NotReady };
     Config config;
@@ -219,6 +251,8 @@ protected:
     bool reuse_io_tensors = true;
 
     MemoryPtr memWorkspace;
+    int numaNodeId = -1;
+    CompilationTimes compilationTimes;
 
     std::vector<NodePtr> graphNodes;
     std::vector<EdgePtr> graphEdges;
@@ -244,6 +278,7 @@ protected:
     void ExtractConstantAndExecutableNodes();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
     void ExecuteConstantNodesOnly() const;
+    void StoreSharedWeights();
     void InferStatic(InferRequestBase* request);
     void InferDynamic(InferRequestBase* request);
 
@@ -267,6 +302,20 @@ private:
     std::shared_ptr<std::mutex> sharedMutex = nullptr;
     DnnlScratchPadPtr rtScratchPad;
     std::unordered_map<Node*, size_t> syncNodesInds;
+    // shape functions of the executable dynamic nodes
+    SymbolicShapes symbolicShapes;
+
+    // constant weights shared with the other processes via the files of config.sharedWeightsDir
+    SharedWeightsStorage::Ptr sharedWeights;
+    std::string sharedWeightsGraphKey;
+    std::unordered_set<const void*> sharedWeightsMapped;
+    std::vector<std::pair<EdgePtr, std::string>> sharedWeightsToStore;
+    // hashes of the data of the original constants, computed on demand
+    std::unordered_map<const Node*, uint64_t> sharedWeightsConstantHashes;
+
+    uint64_t sharedWeightsConstantsHash(const NodePtr& node);
+    std::string sharedWeightsKey(const EdgePtr& edge);
+    void initSharedWeights();
 
     void EnforceBF16();
     void setMinSparseRate(float minSparseRate);
@@ -19,6 +19,7 @@
 #include "nodes/interpolate.h"
 #include "nodes/reduce.h"
 #include "nodes/input.h"
+#include "nodes/fullyconnected.h"
 #include "nodes/rnn.h"
 #include "nodes/common/cpu_convert.h"
 
@@ -61,7 +62,11 @@ namespace intel_cpu {
 GraphOptimizer::GraphOptimizer() {}
 
 void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "ApplyCommonGraphOptimizations", "FuseConvolutionAndBias");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "ApplyCommonGraphOptimizations", "FuseFCAndWeightsDecompression");
+    FuseFCAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionMatMulDeconvAndBias(graph);
     graph.RemoveDroppedNodes();
 
@@ -173,6 +178,96 @@ void GraphOptimizer::ApplyImplSpecificGraphOptimizations(Graph &graph) {
     graph.RemoveDroppedEdges();
 }
 
+void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableConvertNode = [](const NodePtr& node) {
+        if (node->getType() != Type::Convert || node->getChildEdges().size() != 1)
+            return false;
+        const auto weights = node->getParentEdgeAt(0)->getParent();
+        return weights->getType() == Type::Input && weights->isConstant() &&
+               one_of(weights->getOriginalOutputPrecisionAtPort(0), Precision::FP16, Precision::BF16, Precision::I8, Precision::U8);
+    };
+
+    // Reads per output channel or per tensor values of the decompression Eltwise: the second constant input or
+    // the attribute of the per tensor EltwisePowerStatic (beta * x + gamma)
+    auto getDecompressionValues = [](const NodePtr& node, Algorithm algorithm, size_t OC, EdgePtr& valuesEdge, std::vector<float>& values) {
+        if (node->getType() != Type::Eltwise || node->getChildEdges().size() != 1 || !node->getFusedWith().empty())
+            return false;
+
+        if (node->getAlgorithm() == Algorithm::EltwisePowerStatic) {
+            const auto eltwiseNode = std::dynamic_pointer_cast<Eltwise>(node);
+            if (eltwiseNode->getAlpha() != 1.f)
+                return false;
+            if (algorithm == Algorithm::EltwiseMultiply && eltwiseNode->getGamma() == 0.f) {
+                values.push_back(eltwiseNode->getBeta());
+                return true;
+            }
+            if (algorithm == Algorithm::EltwiseSubtract && eltwiseNode->getBeta() == 1.f) {
+                values.push_back(-eltwiseNode->getGamma());
+                return true;
+            }
+            return false;
+        }
+
+        if (node->getAlgorithm() != algorithm || node->getParentEdges().size() != 2)
+            return false;
+        valuesEdge = node->getParentEdgesAtPort(1)[0];
+        const auto valuesNode = std::dynamic_pointer_cast<node::Input>(valuesEdge->getParent());
+        if (!valuesNode || !valuesNode->isConstant() || valuesNode->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return false;
+        const auto valuesSize = valuesNode->getOutputShapeAtPort(0).getElementsCount();
+        if (valuesSize != 1 && valuesSize != OC)
+            return false;
+        const auto valuesData = static_cast<const float*>(valuesNode->getMemoryPtr()->GetPtr());
+        values.assign(valuesData, valuesData + valuesSize);
+        return true;
+    };
+
+    for (const auto& node : graphNodes) {
+        const auto fcNode = std::dynamic_pointer_cast<FullyConnected>(node);
+        if (!fcNode || !fcNode->canUseWeightsDecompression())
+            continue;
+
+        // compressed weights (Input) -> Convert -> Subtract zero points (optional) -> Multiply by scales (optional)
+        // -> FullyConnected
+        const auto OC = fcNode->getInputShapeAtPort(1).getStaticDims()[0];
+        std::vector<NodePtr> decompressionNodes;
+        std::vector<EdgePtr> valuesEdges;
+        std::vector<float> scales;
+        std::vector<float> zeroPoints;
+        auto parent = fcNode->getParentEdgesAtPort(1)[0]->getParent();
+        EdgePtr valuesEdge = nullptr;
+        if (getDecompressionValues(parent, Algorithm::EltwiseMultiply, OC, valuesEdge, scales)) {
+            decompressionNodes.push_back(parent);
+            valuesEdges.push_back(valuesEdge);
+            parent = parent->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        valuesEdge = nullptr;
+        if (getDecompressionValues(parent, Algorithm::EltwiseSubtract, OC, valuesEdge, zeroPoints)) {
+            decompressionNodes.push_back(parent);
+            valuesEdges.push_back(valuesEdge);
+            parent = parent->getParentEdgesAtPort(0)[0]->getParent();
+        }
+
+        if (!isSuitableConvertNode(parent))
+            continue;
+
+        const auto convertNode = parent;
+        const auto weightsNode = convertNode->getParentEdgeAt(0)->getParent();
+        fcNode->setWeightsDecompression(scales, zeroPoints);
+        fcNode->setOriginalInputPrecisionAtPort(1, weightsNode->getOriginalOutputPrecisionAtPort(0));
+        fcNode->addOriginalLayer(convertNode->getOriginalLayers());
+        for (size_t i = 0; i < decompressionNodes.size(); i++) {
+            fcNode->addOriginalLayer(decompressionNodes[i]->getOriginalLayers());
+            if (valuesEdges[i])
+                graph.RemoveEdge(valuesEdges[i]);
+            graph.DropNode(decompressionNodes[i]);
+        }
+        graph.DropNode(convertNode);
+    }
+}
+
 void GraphOptimizer::FuseConvolutionMatMulDeconvAndBias(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -22,6 +22,8 @@
 #include <debug.h>
 #include "utils/general_utils.h"
 #include "utils/cpu_utils.hpp"
+#include "utils/numa_utils.hpp"
+#include "utils/tracer.hpp"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
@@ -32,6 +34,9 @@ namespace intel_cpu {
 void InferRequestBase::CreateInferRequest() {
     auto id = (execNetwork->_numRequests)++;
     profilingTask = openvino::itt::handle("INTEL_CPU_INFER_" + execNetwork->_name + "_" + std::to_string(id));
+    if (!execNetwork->_requestsNumaNodes.empty()) {
+        numaNodeId = execNetwork->_requestsNumaNodes[id % execNetwork->_requestsNumaNodes.size()];
+    }
 
     if (execNetwork->_graphs.size() == 0)
         IE_THROW() << "No graph was found";
@@ -65,6 +70,19 @@ InferRequestBase::~InferRequestBase() {
     --(execNetwork->_numRequests);
 }
 
+void InferRequestBase::placeOnNumaNode(const InferenceEngine::Blob::Ptr& blob) const {
+    if (numaNodeId < 0)
+        return;
+    bindToNumaNode(blob->buffer().as<void*>(), blob->byteSize(), numaNodeId);
+}
+
+InferenceEngine::Blob::Ptr InferRequestBase::createBlob(const InferenceEngine::TensorDesc& desc) const {
+    auto blob = execNetwork->_blobAllocator ? make_blob_with_precision(desc, execNetwork->_blobAllocator)
+                                            : make_blob_with_precision(desc);
+    blob->allocate();
+    return blob;
+}
+
 void InferRequestBase::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision inPrec) {
     auto& tensorDesc = inputBlob->getTensorDesc();
     bool needConvert = inPrec != tensorDesc.getPrecision();
@@ -76,8 +94,7 @@ void InferRequestBase::pushInput(const std::string& inputName, InferenceEngine::
 
     InferenceEngine::Blob::Ptr iconv;
     if (needConvert) {
-        iconv = make_blob_with_precision(inPrec, InferenceEngine::TensorDesc(inPrec, tensorDesc.getDims(), tensorDesc.getLayout()));
-        iconv->allocate();
+        iconv = createBlob(InferenceEngine::TensorDesc(inPrec, tensorDesc.getDims(), tensorDesc.getLayout()));
         if (inputBlob->size() != iconv->size())
             IE_THROW() << "Can't copy tensor: input and converted tensors have different number of elements: " << inputBlob->size() << " and "
                                << iconv->size();
@@ -152,33 +169,41 @@ void InferRequestBase::redefineMemoryForInputNodes() {
 void InferRequestBase::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, profilingTask);
+    CPU_TRACE_SCOPE("InferRequest", "InferRequest::Infer");
     auto graphLock = execNetwork->GetGraph();
     graph = &(graphLock._graph);
 
     ThrowIfCanceled();
-    convertBatchedInputBlobs();
+    {
+        CPU_TRACE_SCOPE("InferRequest", "InferRequest::PushInputs");
+        convertBatchedInputBlobs();
 
-    if (graph->hasDynamicInput()) {
-        redefineMemoryForInputNodes();
-    } else if (graph->getProperty().isNewApi && graph->getProperty().batchLimit > 0) {
-        const auto batch = _inputs.begin()->second->getTensorDesc().getDims()[0];
-        SetBatch(batch);
-    }
+        if (graph->hasDynamicInput()) {
+            redefineMemoryForInputNodes();
+        } else if (graph->getProperty().isNewApi && graph->getProperty().batchLimit > 0) {
+            const auto batch = _inputs.begin()->second->getTensorDesc().getDims()[0];
+            SetBatch(batch);
+        }
 
-    execDataPreprocessing(_inputs);
+        execDataPreprocessing(_inputs);
 
-    changeDefaultPtr();
+        changeDefaultPtr();
 
-    ThrowIfCanceled();
+        ThrowIfCanceled();
 
-    PushInputData();
+        PushInputData();
 
-    if (memoryStates.size() != 0) {
-        PushStates();
+        if (memoryStates.size() != 0) {
+            PushStates();
+        }
     }
 
-    graph->Infer(this);
+    {
+        CPU_TRACE_SCOPE("InferRequest", "Graph::Infer");
+        graph->Infer(this);
+    }
 
+    CPU_TRACE_SCOPE("InferRequest", "InferRequest::PullOutputs");
     if (memoryStates.size() != 0) {
         PullStates();
     }
@@ -196,6 +221,14 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> InferRequestB
     return perfMap;
 }
 
+std::map<std::string, std::map<std::string, uint64_t>> InferRequestBase::GetHardwareCounters() const {
+    if (!graph || !graph->IsReady())
+        IE_THROW() << "Graph is not ready!";
+    std::map<std::string, std::map<std::string, uint64_t>> countersMap;
+    graph->GetHardwareCounters(countersMap);
+    return countersMap;
+}
+
 static inline void changeEdgePtr(const EdgePtr &edge, void *newPtr) {
     edge->getMemoryPtr()->setDataHandle(newPtr);
 }
@@ -506,8 +539,8 @@ InferenceEngine::Blob::Ptr LegacyInferRequest::GetBlob(const std::string& name)
                 desc = InferenceEngine::TensorDesc(p, dims, l);
             }
 
-            _inputs[name] = make_blob_with_precision(desc);
-            _inputs[name]->allocate();
+            _inputs[name] = createBlob(desc);
+            placeOnNumaNode(_inputs[name]);
             if (pBlobDesc == desc &&
                 graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
                 externalPtr[name] = _inputs[name]->buffer();
@@ -548,8 +581,8 @@ InferenceEngine::Blob::Ptr LegacyInferRequest::GetBlob(const std::string& name)
                 auto currBlockDesc = InferenceEngine::BlockingDesc(desc.getBlockingDesc().getBlockDims(), desc.getBlockingDesc().getOrder());
                 desc = InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), currBlockDesc);
 
-                data = make_blob_with_precision(desc);
-                data->allocate();
+                data = createBlob(desc);
+                placeOnNumaNode(data);
             } else {
                 const auto& expectedTensorDesc = pBlobDesc;
 
@@ -779,8 +812,8 @@ InferenceEngine::Blob::Ptr InferRequest::GetBlob(const std::string& name) {
                 InferenceEngine::TensorDesc desc(InferenceEngine::details::convertPrecision(inputNode->second->get_output_element_type(0)),
                                                  dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size()));
 
-                _inputs[name] = make_blob_with_precision(desc);
-                _inputs[name]->allocate();
+                _inputs[name] = createBlob(desc);
+                placeOnNumaNode(_inputs[name]);
 
                 if (!isDynamic &&
                     desc == MemoryDescUtils::convertToTensorDesc(graph->getInputNodeByName(name)->getChildEdgesAtPort(0)[0]->getMemory().getDesc()) &&
@@ -814,8 +847,8 @@ InferenceEngine::Blob::Ptr InferRequest::GetBlob(const std::string& name) {
                     InferenceEngine::TensorDesc desc(InferenceEngine::details::convertPrecision(outputNode->second->get_input_element_type(0)),
                                                      dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size()));
 
-                    data = make_blob_with_precision(desc);
-                    data->allocate();
+                    data = createBlob(desc);
+                    placeOnNumaNode(data);
                 } else {
                     const auto& blobDims = data->getTensorDesc().getDims();
                     // in static shape case is enough information that shapes are incompatible to throw exception
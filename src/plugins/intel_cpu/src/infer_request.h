@@ -23,6 +23,7 @@ public:
     void InferImpl() override;
 
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+    std::map<std::string, std::map<std::string, uint64_t>> GetHardwareCounters() const override;
 
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> QueryState() override;
 
@@ -37,6 +38,14 @@ public:
      */
     void ThrowIfCanceled() const;
 
+    /**
+     * @brief NUMA node the request tensors are placed on and whose streams preferably execute the request,
+     *        -1 if the placement is left to the OS
+     */
+    int getNumaNodeId() const {
+        return numaNodeId;
+    }
+
 protected:
     InferRequestBase(InferenceEngine::InputsDataMap networkInputs,
                      InferenceEngine::OutputsDataMap networkOutputs,
@@ -51,12 +60,16 @@ protected:
     void CreateInferRequest();
     InferenceEngine::Precision normToInputSupportedPrec(const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input) const;
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
+    void placeOnNumaNode(const InferenceEngine::Blob::Ptr& blob) const;
+    // allocates the blob from the tensor pool of the network if it is enabled
+    InferenceEngine::Blob::Ptr createBlob(const InferenceEngine::TensorDesc& desc) const;
 
     virtual void initBlobs() = 0;
     virtual void PushInputData() = 0;
 
     Graph* graph = nullptr;
     std::unordered_map<std::string, void*> externalPtr;
+    int numaNodeId = -1;
 
 private:
     void PushStates();
@@ -6,7 +6,9 @@
 #include "op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/or.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 #include <transformations/utils/utils.hpp>
 
 #include "itt.hpp"
@@ -15,7 +17,17 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
     MATCHER_SCOPE(ConvertMatMulToFC);
     auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
     auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
-    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m }, ngraph::pattern::has_static_rank());
+    // compressed weights marked by MarkCompressedWeights:
+    // Constant -> Convert -> Subtract zero points (optional) -> Multiply by scales (optional)
+    auto compressed_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto convert_m = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({ compressed_m }, ngraph::pattern::consumers_count(1));
+    auto zero_points_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto subtract_m = ngraph::pattern::wrap_type<ngraph::opset1::Subtract>({ convert_m, zero_points_m }, ngraph::pattern::consumers_count(1));
+    auto scales_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto subtract_or_convert_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{ convert_m, subtract_m });
+    auto multiply_m = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({ subtract_or_convert_m, scales_m }, ngraph::pattern::consumers_count(1));
+    auto weights_or_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{ weights_m, convert_m, subtract_m, multiply_m });
+    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_or_m }, ngraph::pattern::has_static_rank());
 
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
         const auto& pattern_map = m.get_pattern_value_map();
@@ -28,7 +40,12 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
         // fc_input_a and fc_input_b - are the final inputs that will be set to FullyConnected of GemmIE operations.
         // So in case of adding new operations that takes matmul inputs we need keep update fc_input_a and fc_input_b.
         auto fc_input_a = pattern_map.at(activations_m);
-        auto fc_input_b = pattern_map.at(weights_m);
+        // compressed weights are normalized in the original precision, the decompression is applied afterwards
+        const bool compressed = pattern_map.count(convert_m) != 0;
+        if (compressed && !ov::constant_folding_is_disabled(pattern_map.at(convert_m).get_node_shared_ptr())) {
+            return false;
+        }
+        auto fc_input_b = compressed ? pattern_map.at(compressed_m) : pattern_map.at(weights_m);
 
         auto shape_a = fc_input_a.get_partial_shape();
         auto shape_b = fc_input_b.get_partial_shape();
@@ -131,6 +148,38 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
             throw ngraph::ngraph_error("MatMul " + matmul->get_friendly_name() + " shapes are inconsistent.");
         }
 
+        // Decompression zero points and scales must be per output channel (or per tensor), they are reshaped to [OC, 1]
+        auto get_per_oc_constant = [&](const ngraph::Output<ngraph::Node>& output) -> std::shared_ptr<ngraph::opset1::Constant> {
+            const auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(output.get_node_shared_ptr());
+            const auto& shape = constant->get_shape();
+            const size_t oc_axis = matmul->get_transpose_b() ? rank_b - 2 : rank_b - 1;
+            const size_t OC = shape_b[oc_axis].get_length();
+            if (constant->get_element_type() != ngraph::element::f32 || shape.size() > static_cast<size_t>(rank_b)) {
+                return nullptr;
+            }
+            for (size_t i = 0; i < shape.size(); i++) {
+                const size_t axis = rank_b - shape.size() + i;
+                if (shape[i] != 1 && (axis != oc_axis || shape[i] != OC)) {
+                    return nullptr;
+                }
+            }
+            return std::make_shared<ngraph::opset1::Constant>(*constant, ngraph::Shape{ ngraph::shape_size(shape), 1 });
+        };
+        std::shared_ptr<ngraph::opset1::Constant> zero_points;
+        if (compressed && pattern_map.count(subtract_m)) {
+            zero_points = get_per_oc_constant(pattern_map.at(zero_points_m));
+            if (!zero_points) {
+                return false;
+            }
+        }
+        std::shared_ptr<ngraph::opset1::Constant> scales;
+        if (compressed && pattern_map.count(multiply_m)) {
+            scales = get_per_oc_constant(pattern_map.at(scales_m));
+            if (!scales) {
+                return false;
+            }
+        }
+
         // Transferring from MatMul representation: [B, I, K] * [B, K, O] = [B, I, O]
         // to FullyConnected representation: [I, K] * [K, O] = [I, O]
 
@@ -155,12 +204,30 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
             new_ops.push_back(fc_input_a.get_node_shared_ptr());
         }
 
+        std::shared_ptr<ngraph::Node> convert;
+        if (compressed) {
+            convert = pattern_map.at(convert_m).get_node_shared_ptr()->clone_with_new_inputs({ fc_input_b });
+            fc_input_b = convert;
+            new_ops.push_back(convert);
+            if (zero_points) {
+                fc_input_b = std::make_shared<ngraph::opset1::Subtract>(fc_input_b, zero_points);
+                new_ops.push_back(fc_input_b.get_node_shared_ptr());
+            }
+            if (scales) {
+                fc_input_b = std::make_shared<ngraph::opset1::Multiply>(fc_input_b, scales);
+                new_ops.push_back(fc_input_b.get_node_shared_ptr());
+            }
+        }
+
         auto output_rank = matmul->get_output_partial_shape(0).rank();
         // Create FullyConnected
         auto fc = std::make_shared<ov::intel_cpu::FullyConnectedNode>(fc_input_a, fc_input_b, output_rank, matmul->get_output_element_type(0));
         fc->set_friendly_name(matmul->get_friendly_name());
         new_ops.push_back(fc);
         ngraph::copy_runtime_info(matmul, new_ops);
+        if (convert) {
+            ov::disable_constant_folding(convert);
+        }
         ngraph::replace_node(matmul, fc);
         return true;
     };
@@ -0,0 +1,228 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fuse_preprocessing.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include <openvino/core/rt_info.hpp>
+#include <openvino/op/util/gather_base.hpp>
+#include <openvino/opsets/opset1.hpp>
+#include <transformations/rt_info/preprocessing_attribute.hpp>
+
+#include "itt.hpp"
+#include "op/fused_preprocess.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace {
+struct PreprocessChain {
+    // channel axis in the input coordinates, -1 until a per-channel step is met
+    int64_t channel_axis = -1;
+    size_t channels = 0;
+    std::vector<int64_t> src_channels;
+    std::vector<float> scale{1.f};
+    std::vector<float> shift{0.f};
+    // order[i] is the input axis which is placed to the i-th axis of the current tensor
+    std::vector<int64_t> order;
+    element::Type type;
+};
+
+bool set_channel_axis(PreprocessChain& chain, const PartialShape& input_shape, int64_t axis) {
+    if (chain.channel_axis == -1) {
+        if (input_shape[axis].is_dynamic())
+            return false;
+        chain.channel_axis = axis;
+        chain.channels = static_cast<size_t>(input_shape[axis].get_length());
+    }
+    if (chain.channel_axis != axis)
+        return false;
+
+    if (chain.scale.size() == 1) {
+        chain.scale.resize(chain.channels, chain.scale[0]);
+        chain.shift.resize(chain.channels, chain.shift[0]);
+    }
+    if (chain.src_channels.empty()) {
+        chain.src_channels.resize(chain.channels);
+        std::iota(chain.src_channels.begin(), chain.src_channels.end(), 0);
+    }
+    return true;
+}
+
+bool fuse_convert(PreprocessChain& chain, const std::shared_ptr<opset1::Convert>& convert) {
+    if (convert->get_destination_type() != element::f32)
+        return false;
+    chain.type = element::f32;
+    return true;
+}
+
+bool fuse_transpose(PreprocessChain& chain, const std::shared_ptr<opset1::Transpose>& transpose) {
+    const auto order_const = ov::as_type_ptr<opset1::Constant>(transpose->get_input_node_shared_ptr(1));
+    if (!order_const)
+        return false;
+    const auto order = order_const->cast_vector<int64_t>();
+    if (order.size() != chain.order.size())
+        return false;
+    std::vector<int64_t> new_order(order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        if (order[i] < 0 || static_cast<size_t>(order[i]) >= order.size())
+            return false;
+        new_order[i] = chain.order[order[i]];
+    }
+    chain.order = new_order;
+    return true;
+}
+
+bool fuse_gather(PreprocessChain& chain, const PartialShape& input_shape, const std::shared_ptr<op::util::GatherBase>& gather) {
+    const auto indices_const = ov::as_type_ptr<opset1::Constant>(gather->get_input_node_shared_ptr(1));
+    const auto axis_const = ov::as_type_ptr<opset1::Constant>(gather->get_input_node_shared_ptr(2));
+    if (!indices_const || !axis_const || gather->get_batch_dims() != 0 || indices_const->get_shape().size() != 1)
+        return false;
+    const auto rank = static_cast<int64_t>(chain.order.size());
+    auto axis = axis_const->cast_vector<int64_t>()[0];
+    if (axis < 0)
+        axis += rank;
+    if (axis < 0 || axis >= rank || !set_channel_axis(chain, input_shape, chain.order[axis]))
+        return false;
+
+    auto indices = indices_const->cast_vector<int64_t>();
+    if (indices.size() != chain.channels)
+        return false;
+    auto src_channels = chain.src_channels;
+    auto scale = chain.scale;
+    auto shift = chain.shift;
+    for (size_t c = 0; c < indices.size(); c++) {
+        auto idx = indices[c] < 0 ? indices[c] + static_cast<int64_t>(chain.channels) : indices[c];
+        if (idx < 0 || static_cast<size_t>(idx) >= chain.channels)
+            return false;
+        src_channels[c] = chain.src_channels[idx];
+        scale[c] = chain.scale[idx];
+        shift[c] = chain.shift[idx];
+    }
+    chain.src_channels = src_channels;
+    chain.scale = scale;
+    chain.shift = shift;
+    return true;
+}
+
+bool fuse_eltwise(PreprocessChain& chain, const PartialShape& input_shape, const std::shared_ptr<Node>& eltwise) {
+    if (chain.type != element::f32 || eltwise->get_autob().m_type != op::AutoBroadcastType::NUMPY ||
+        !eltwise->get_output_partial_shape(0).same_scheme(eltwise->get_input_partial_shape(0)))
+        return false;
+    const auto constant = ov::as_type_ptr<opset1::Constant>(eltwise->get_input_node_shared_ptr(1));
+    if (!constant)
+        return false;
+
+    const auto& const_shape = constant->get_shape();
+    const auto rank = chain.order.size();
+    auto values = constant->cast_vector<float>();
+    if (values.empty() || const_shape.size() > rank)
+        return false;
+    if (std::any_of(values.begin(), values.end(), [&](float v) { return v != values[0]; })) {
+        // per-channel constant: the only non-unit dimension must be the channel one
+        int64_t axis = -1;
+        const auto offset = rank - const_shape.size();
+        for (size_t i = 0; i < const_shape.size(); i++) {
+            if (const_shape[i] != 1) {
+                if (axis != -1)
+                    return false;
+                axis = static_cast<int64_t>(offset + i);
+            }
+        }
+        if (!set_channel_axis(chain, input_shape, chain.order[axis]) || values.size() != chain.channels)
+            return false;
+    } else {
+        values.resize(1);
+    }
+
+    for (size_t c = 0; c < chain.scale.size(); c++) {
+        const auto value = values.size() == 1 ? values[0] : values[c];
+        if (ov::is_type<opset1::Subtract>(eltwise)) {
+            chain.shift[c] -= value;
+        } else if (ov::is_type<opset1::Add>(eltwise)) {
+            chain.shift[c] += value;
+        } else if (ov::is_type<opset1::Multiply>(eltwise)) {
+            chain.scale[c] *= value;
+            chain.shift[c] *= value;
+        } else if (ov::is_type<opset1::Divide>(eltwise) && value != 0.f) {
+            chain.scale[c] /= value;
+            chain.shift[c] /= value;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool fuse_step(PreprocessChain& chain, const PartialShape& input_shape, const std::shared_ptr<Node>& node) {
+    if (const auto convert = ov::as_type_ptr<opset1::Convert>(node)) {
+        return fuse_convert(chain, convert);
+    } else if (const auto transpose = ov::as_type_ptr<opset1::Transpose>(node)) {
+        return fuse_transpose(chain, transpose);
+    } else if (const auto gather = ov::as_type_ptr<op::util::GatherBase>(node)) {
+        return fuse_gather(chain, input_shape, gather);
+    } else if (ov::is_type<opset1::Subtract>(node) || ov::is_type<opset1::Add>(node) ||
+               ov::is_type<opset1::Multiply>(node) || ov::is_type<opset1::Divide>(node)) {
+        return fuse_eltwise(chain, input_shape, node);
+    }
+    return false;
+}
+}  // namespace
+
+bool FusePreprocessing::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_MODEL_SCOPE(FusePreprocessing);
+    bool rewritten = false;
+    for (const auto& param : model->get_parameters()) {
+        const auto& input_shape = param->get_output_partial_shape(0);
+        const auto input_type = param->get_output_element_type(0);
+        if (input_shape.rank().is_dynamic() || input_shape.rank().get_length() < 3 ||
+            (input_type != element::u8 && input_type != element::i8 && input_type != element::f32))
+            continue;
+
+        PreprocessChain chain;
+        chain.type = input_type;
+        chain.order.resize(input_shape.rank().get_length());
+        std::iota(chain.order.begin(), chain.order.end(), 0);
+
+        std::shared_ptr<Node> last = param;
+        NodeVector fused_nodes;
+        while (true) {
+            const auto consumers = last->output(0).get_target_inputs();
+            if (consumers.size() != 1 || consumers.begin()->get_index() != 0)
+                break;
+            const auto next = consumers.begin()->get_node()->shared_from_this();
+            // only the steps inserted by ov::preprocess::PrePostProcessor are fused, the same operations of the
+            // model itself are left to the optimized nodes
+            if (!ov::is_preprocesing_node(next))
+                break;
+            auto candidate = chain;
+            if (!fuse_step(candidate, input_shape, next))
+                break;
+            chain = candidate;
+            last = next;
+            fused_nodes.push_back(next);
+        }
+        // a single step is already executed by one node, so there is nothing to gain. Pure f32 eltwise chains
+        // are left to the eltwise fusings
+        const bool moves_data = input_type != element::f32 ||
+                                !std::is_sorted(chain.src_channels.begin(), chain.src_channels.end()) ||
+                                !std::is_sorted(chain.order.begin(), chain.order.end());
+        if (fused_nodes.size() < 2 || chain.type != element::f32 || !moves_data)
+            continue;
+
+        const auto channel_axis = chain.channel_axis == -1 ? 1 : chain.channel_axis;
+        const auto fused = std::make_shared<FusedPreprocessNode>(param, channel_axis, chain.src_channels,
+                                                                 chain.scale, chain.shift, chain.order,
+                                                                 last->get_output_element_type(0));
+        fused->set_friendly_name(last->get_friendly_name());
+        copy_runtime_info(fused_nodes, fused);
+        replace_node(last, fused);
+        rewritten = true;
+    }
+    return rewritten;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/pass/pass.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @interface FusePreprocessing
+ * @brief Collapses the preprocessing chain that starts at a model input (as generated by ov::preprocess::PrePostProcessor)
+ * into a single FusedPreprocessNode, so the CPU plugin reads the user tensor once instead of running a separate node
+ * (and a full memory pass) per step:
+ *
+ *   Parameter [u8/i8/f32] -> Convert [f32] -> Gather (channels reverse) -> Subtract (mean) -> Divide/Multiply (scale)
+ *   -> Transpose (layout)
+ *
+ * Steps may come in any order, every step is optional. Per-channel constants are folded into one scale/shift pair
+ * and the transposes into one output order. Only the operations marked by ov::set_is_preprocessing_node are fused.
+ */
+class FusePreprocessing : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("FusePreprocessing", "0");
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_compressed_weights.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <snippets/pass/collapse_subgraph.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+#include <utils/general_utils.h>
+#include <algorithm>
+
+#include "itt.hpp"
+
+ov::intel_cpu::MarkCompressedWeights::MarkCompressedWeights(const ngraph::element::TypeVector& precisions) {
+    MATCHER_SCOPE(MarkCompressedWeights);
+    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(ngraph::pattern::type_matches_any(precisions));
+    auto convert_m = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({weights_m}, [](const ngraph::Output<ngraph::Node>& output) {
+        return output.get_element_type() == ngraph::element::f32 && output.get_target_inputs().size() == 1;
+    });
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto convert = m.get_pattern_value_map().at(convert_m).get_node_shared_ptr();
+
+        std::shared_ptr<ngraph::Node> subtract;
+        std::shared_ptr<ngraph::Node> multiply;
+        auto consumers = convert->get_output_target_inputs(0);
+        if (ngraph::is_type<ngraph::opset1::Subtract>(consumers.begin()->get_node())) {
+            subtract = consumers.begin()->get_node()->shared_from_this();
+            consumers = subtract->get_output_target_inputs(0);
+            if (consumers.size() != 1)
+                return false;
+        }
+        if (ngraph::is_type<ngraph::opset1::Multiply>(consumers.begin()->get_node())) {
+            multiply = consumers.begin()->get_node()->shared_from_this();
+            consumers = multiply->get_output_target_inputs(0);
+            if (consumers.size() != 1)
+                return false;
+        }
+        const auto& consumer = *consumers.begin();
+        if (!ngraph::is_type<ngraph::opset1::MatMul>(consumer.get_node()) || consumer.get_index() != 1)
+            return false;
+
+        ov::disable_constant_folding(convert);
+        ngraph::snippets::pass::SetSnippetsNodeType(convert, ngraph::snippets::pass::SnippetsNodeType::SkippedByPlugin);
+        if (subtract)
+            ngraph::snippets::pass::SetSnippetsNodeType(subtract, ngraph::snippets::pass::SnippetsNodeType::SkippedByPlugin);
+        if (multiply)
+            ngraph::snippets::pass::SetSnippetsNodeType(multiply, ngraph::snippets::pass::SnippetsNodeType::SkippedByPlugin);
+        return false;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(convert_m, matcher_name);
+    this->register_matcher(m, callback);
+}
+
+bool ov::intel_cpu::isCompressedWeights(const std::shared_ptr<const ngraph::Node>& node) {
+    if (!ngraph::is_type<ngraph::opset1::Constant>(node) ||
+        !one_of(node->get_output_element_type(0), ngraph::element::f16, ngraph::element::bf16))
+        return false;
+
+    const auto consumers = node->get_output_target_inputs(0);
+    return !consumers.empty() && std::all_of(consumers.begin(), consumers.end(), [](const ngraph::Input<ngraph::Node>& input) {
+        return ngraph::is_type<ngraph::opset1::Convert>(input.get_node()) && ov::constant_folding_is_disabled(input.get_node());
+    });
+}
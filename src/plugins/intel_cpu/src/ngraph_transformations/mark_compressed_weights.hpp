@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+/*
+ * Description:
+ *     MarkCompressedWeights detects compressed weights of MatMul operations
+ *
+ *         Constant [f16 / bf16 / i8 / u8]
+ *             |
+ *         Convert [f32]
+ *             |
+ *         Subtract zero points (optional)
+ *             |
+ *         Multiply by scales (optional)
+ *             |
+ *         MatMul (second input)
+ *
+ *     and disables constant folding of the Convert (and the snippets tokenization of the subgraph), so the weights
+ *     are kept in memory in the original precision and FullyConnected decompresses them on the fly.
+ */
+
+namespace ov {
+namespace intel_cpu {
+
+class MarkCompressedWeights: public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MarkCompressedWeights", "0");
+    explicit MarkCompressedWeights(const ngraph::element::TypeVector& precisions);
+};
+
+/*
+ * Returns true for the floating point Constant marked by MarkCompressedWeights.
+ * Used as the ConvertPrecision callback: such a Constant must keep its precision.
+ */
+bool isCompressedWeights(const std::shared_ptr<const ngraph::Node>& node);
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_preprocess.hpp"
+#include "../itt.hpp"
+
+ov::intel_cpu::FusedPreprocessNode::FusedPreprocessNode(const ngraph::Output<ngraph::Node>& data,
+                                                        int64_t channel_axis,
+                                                        std::vector<int64_t> src_channels,
+                                                        std::vector<float> scale,
+                                                        std::vector<float> shift,
+                                                        std::vector<int64_t> order,
+                                                        const ngraph::element::Type output_type)
+    : Op({data}),
+      m_channel_axis(channel_axis),
+      m_src_channels(std::move(src_channels)),
+      m_scale(std::move(scale)),
+      m_shift(std::move(shift)),
+      m_order(std::move(order)),
+      m_output_type(output_type) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> ov::intel_cpu::FusedPreprocessNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(FusedPreprocessNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::FusedPreprocessNode>(new_args.at(0), m_channel_axis, m_src_channels,
+                                                                m_scale, m_shift, m_order, m_output_type);
+}
+
+void ov::intel_cpu::FusedPreprocessNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(FusedPreprocessNode_validate_and_infer_types);
+    const auto& input_pshape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, input_pshape.rank().is_static(), "input rank must be static");
+    const auto rank = input_pshape.rank().get_length();
+    NODE_VALIDATION_CHECK(this, m_channel_axis >= 0 && m_channel_axis < rank, "channel axis is out of range");
+    NODE_VALIDATION_CHECK(this, m_scale.size() == m_shift.size() && !m_scale.empty(),
+                          "scale and shift must have the same non-zero size");
+    const auto& channels = input_pshape[m_channel_axis];
+    if (m_scale.size() != 1 || !m_src_channels.empty()) {
+        NODE_VALIDATION_CHECK(this, channels.is_static(), "channel dimension must be static for per-channel parameters");
+        const auto channels_num = static_cast<size_t>(channels.get_length());
+        NODE_VALIDATION_CHECK(this, m_scale.size() == 1 || m_scale.size() == channels_num,
+                              "scale and shift size must be equal to 1 or to the channels number");
+        NODE_VALIDATION_CHECK(this, m_src_channels.empty() || m_src_channels.size() == channels_num,
+                              "source channels mapping size must be equal to the channels number");
+        for (const auto c : m_src_channels) {
+            NODE_VALIDATION_CHECK(this, c >= 0 && static_cast<size_t>(c) < channels_num, "source channel index is out of range");
+        }
+    }
+
+    ov::PartialShape output_pshape = input_pshape;
+    if (!m_order.empty()) {
+        NODE_VALIDATION_CHECK(this, m_order.size() == static_cast<size_t>(rank), "order size must be equal to the input rank");
+        for (size_t i = 0; i < m_order.size(); i++) {
+            NODE_VALIDATION_CHECK(this, m_order[i] >= 0 && m_order[i] < rank, "order value is out of range");
+            output_pshape[i] = input_pshape[m_order[i]];
+        }
+    }
+    set_output_type(0, m_output_type == ngraph::element::undefined ? ngraph::element::f32 : m_output_type, output_pshape);
+}
+
+bool ov::intel_cpu::FusedPreprocessNode::visit_attributes(ngraph::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(FusedPreprocessNode_visit_attributes);
+    visitor.on_attribute("channel_axis", m_channel_axis);
+    visitor.on_attribute("src_channels", m_src_channels);
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("shift", m_shift);
+    visitor.on_attribute("order", m_order);
+    visitor.on_attribute("out-type", m_output_type);
+    return true;
+}
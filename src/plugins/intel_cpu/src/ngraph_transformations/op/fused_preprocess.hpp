@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Channel-wise preprocessing chain collapsed into a single operation:
+ *   dst[order(idx)] = scale[c] * src[idx with channel c replaced by src_channels[c]] + shift[c]
+ * The operation covers the Convert / ReverseChannels (Gather) / mean (Subtract) / scale (Divide, Multiply) /
+ * convert_layout (Transpose) steps inserted by ov::preprocess::PrePostProcessor.
+ * Empty src_channels means identity channels mapping, scale and shift of size 1 are applied to all channels.
+ */
+class FusedPreprocessNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("FusedPreprocess", "cpu_plugin_opset");
+
+    FusedPreprocessNode() = default;
+
+    FusedPreprocessNode(const ngraph::Output<ngraph::Node>& data,
+                        int64_t channel_axis,
+                        std::vector<int64_t> src_channels,
+                        std::vector<float> scale,
+                        std::vector<float> shift,
+                        std::vector<int64_t> order,
+                        const ngraph::element::Type output_type);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override;
+
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+    int64_t get_channel_axis() const { return m_channel_axis; }
+    const std::vector<int64_t>& get_src_channels() const { return m_src_channels; }
+    const std::vector<float>& get_scale() const { return m_scale; }
+    const std::vector<float>& get_shift() const { return m_shift; }
+    const std::vector<int64_t>& get_order() const { return m_order; }
+    ngraph::element::Type get_output_type() const { return m_output_type; }
+
+private:
+    int64_t m_channel_axis = 1;
+    std::vector<int64_t> m_src_channels;
+    std::vector<float> m_scale;
+    std::vector<float> m_shift;
+    std::vector<int64_t> m_order;
+    ngraph::element::Type m_output_type;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -57,6 +57,7 @@
 #include "utils/general_utils.h"
 #include "utils/cpu_utils.hpp"
 #include "utils/verbose.h"
+#include "utils/tracer.hpp"
 #include "nodes/common/cpu_convert.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
@@ -380,6 +381,18 @@ MemoryDescPtr Node::getBaseMemDescAtOutputPort(size_t portNum) const {
     IE_THROW() << "Can't get output memory desc, primitive descriptor is not selected";
 }
 
+const char* Node::getTraceName() {
+    if (!traceName)
+        traceName = Tracer::intern(getName());
+    return traceName;
+}
+
+const char* Node::getTraceCategory() {
+    if (!traceCategory)
+        traceCategory = Tracer::intern(getTypeStr());
+    return traceCategory;
+}
+
 std::string Node::getPrimitiveDescriptorType() {
     auto selectedPrimitiveDesc = getSelectedPrimitiveDescriptor();
 
@@ -803,7 +816,10 @@ void Node::prepareMemory(const std::vector<DnnlMemoryDescPtr>& intDescs) {
                                             + "_" + std::to_string(internalBlob->byteSize())
                                             + "_" + std::to_string(data_hash);
 
-            ptr = *weightCache->findOrCreate(string_hash, create);
+            // the key does not depend on the addresses, so it is shared with the other processes as is
+            ptr = *weightCache->findOrCreate(string_hash, create, *intDescs[i], engine, [&] () {
+                return string_hash;
+            });
         } else {
             ptr = create();
         }
@@ -1490,11 +1506,12 @@ std::vector<VectorDims> Node::shapeInferGeneric(const std::vector<Shape>& shapes
         for (size_t i = 0; i < shapes.size(); i++)
             input_shapes.emplace_back(std::ref(shapes[i].getStaticDims()));
 
-        std::unordered_map<size_t, MemoryPtr> input_values;
+        std::vector<const Memory*> input_values;
         if (input_value_port_mask) {
+            input_values.resize(inputShapes.size(), nullptr);
             for (size_t port = 0; port < inputShapes.size(); ++port) {
                 if (input_value_port_mask & (1 << port)) {
-                    input_values[port] = getParentEdgesAtPort(port)[0]->getMemoryPtr();
+                    input_values[port] = &getParentMemoryAtPort(port);
                 }
             }
         }
@@ -1508,29 +1525,44 @@ std::vector<VectorDims> Node::shapeInferGeneric(const std::vector<Shape>& shapes
 
 std::vector<VectorDims> Node::shapeInfer() const {
     try {
-        std::vector<std::reference_wrapper<const VectorDims>> input_shapes;
+        // the containers keep their capacity, so the inputs are passed to the shape inference without allocations
         auto input_value_port_mask = shapeInference->get_port_mask();
 
-        input_shapes.reserve(inputShapes.size());
-        for (size_t port = 0; port < inputShapes.size(); ++port)
-            input_shapes.emplace_back(std::ref(getParentEdgesAtPort(port)[0]->getMemory().getStaticDims()));
-
-        std::unordered_map<size_t, MemoryPtr> input_values;
-        if (input_value_port_mask) {
-            for (size_t port = 0; port < inputShapes.size(); ++port) {
-                if (input_value_port_mask & (1 << port)) {
-                    input_values[port] = getParentEdgesAtPort(port)[0]->getMemoryPtr();
-                }
-            }
+        shapeInferInputShapes.clear();
+        shapeInferInputValues.clear();
+        for (size_t port = 0; port < inputShapes.size(); ++port) {
+            const auto& mem = getParentMemoryAtPort(port);
+            shapeInferInputShapes.emplace_back(std::ref(mem.getStaticDims()));
+            shapeInferInputValues.push_back(input_value_port_mask & (1 << port) ? &mem : nullptr);
         }
 
-        return shapeInference->infer(input_shapes, input_values);
+        return shapeInference->infer(shapeInferInputShapes, shapeInferInputValues);
     }
     catch (const std::runtime_error& exp) {
         IE_THROW() << "Shape inference of " << getTypeStr()  << " node with name " << getName() << " failed: " << exp.what();
     }
 }
 
+bool Node::shapeInferSymbolic(const std::vector<std::reference_wrapper<const SymbolicDims>>& inShapes,
+                              std::vector<SymbolicDims>& outShapes) const {
+    if (!shapeInference || !shapeInference->inferSymbolic(inShapes, outShapes))
+        return false;
+    // nodes like Output do not have output ports, so their shapes are never redefined
+    return !outShapes.empty() && outShapes.size() == outputShapes.size();
+}
+
+const Memory& Node::getParentMemoryAtPort(size_t port) const {
+    // the same as getParentEdgesAtPort(port)[0]->getMemory(), but without the vector allocation
+    for (auto& edge_w : parentEdges) {
+        auto edge = edge_w.lock();
+        if (!edge)
+            IE_THROW() << "Node " << getName() << " contains dead weak ptr";
+        if (edge->getOutputNum() == static_cast<int>(port))
+            return edge->getMemory();
+    }
+    IE_THROW() << "Node " << getName() << " has no parent edge at port " << port;
+}
+
 void Node::updateLastInputDims() {
     if (lastInputDims.size() != getParentEdges().size()) {
         if (!lastInputDims.empty())
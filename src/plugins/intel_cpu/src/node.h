@@ -35,6 +35,7 @@
 
 #include <utils/shape_inference/shape_inference_cpu.hpp>
 #include "utils/debug_capabilities.h"
+#include "utils/hardware_counters.hpp"
 
 #include "dnnl_postops_composer.h"
 
@@ -329,6 +330,11 @@ public:
     std::string getPrimitiveDescriptorType();
 
     PerfCount &PerfCounter() { return perfCounter; }
+    HardwareCountersStat &HwCounters() { return hwCounters; }
+
+    // name and type of the node in the runtime trace, interned on the first traced execution
+    const char* getTraceName();
+    const char* getTraceCategory();
 
     virtual void setDynamicBatchLim(int lim);
 
@@ -336,6 +342,14 @@ public:
 
     virtual void execute(dnnl::stream strm);
     void updateShapes();
+    /**
+     * @brief Expresses the output shapes of the node over the symbols of the graph
+     * @param inShapes symbolic shapes of the input ports
+     * @param outShapes symbolic shapes of the output ports
+     * @return false if the output shapes can't be expressed symbolically, so shapeInfer() has to be called
+     */
+    bool shapeInferSymbolic(const std::vector<std::reference_wrapper<const SymbolicDims>>& inShapes,
+                            std::vector<SymbolicDims>& outShapes) const;
     void updateDynamicParams();
     void executeDynamic(dnnl::stream strm);
     virtual void redefineOutputMemory(const std::vector<VectorDims> &newShapes);
@@ -736,9 +750,15 @@ protected:
     std::shared_ptr<std::mutex> sharedMutex = nullptr;
 
 private:
+    const Memory& getParentMemoryAtPort(size_t port) const;
+
     std::vector<EdgeWeakPtr> parentEdges;
     std::vector<EdgeWeakPtr> childEdges;
 
+    // inputs of shapeInfer() reused between the calls
+    mutable std::vector<std::reference_wrapper<const VectorDims>> shapeInferInputShapes;
+    mutable std::vector<const Memory*> shapeInferInputValues;
+
     std::vector<InferenceEngine::Precision> originalInputPrecisions;
     std::vector<InferenceEngine::Precision> originalOutputPrecisions;
 
@@ -754,7 +774,10 @@ private:
     std::string typeToStr(Type type);
 
     PerfCount perfCounter;
+    HardwareCountersStat hwCounters;
     PerfCounters profiling;
+    const char* traceName = nullptr;
+    const char* traceCategory = nullptr;
 
     MultiCachePtr rtParamsCache;
     DnnlScratchPadPtr rtScratchPad;
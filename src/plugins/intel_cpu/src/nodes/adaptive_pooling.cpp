@@ -34,7 +34,7 @@ public:
     explicit AdaptivePoolingShapeInfer(size_t outputs_count) : m_outputs_count(outputs_count) {}
     std::vector<VectorDims> infer(
         const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
-        const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
+        const std::vector<const Memory*>& data_dependency) override {
         const auto& inputDims = input_shapes[0].get();
         const auto& spatialDims = input_shapes[1].get();
         const auto inputRank = inputDims.size();
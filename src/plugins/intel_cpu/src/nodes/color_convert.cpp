@@ -975,7 +975,7 @@ class ColorConvertShapeInfer : public ShapeInferEmptyPads {
 public:
     ColorConvertShapeInfer(bool singlePlain) : m_singlePlain(singlePlain) {}
     std::vector<VectorDims> infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
-                                  const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
+                                  const std::vector<const Memory*>& data_dependency) override {
         const auto& dims = input_shapes.front().get();
         if (dims.size() != 4)
             IE_THROW() <<"NV12Converter node has incorrect input dimensions";
@@ -555,8 +555,9 @@ bool Deconvolution::needShapeInfer() const {
 
 VectorDims Deconvolution::shapeInferInternal(const VectorDims &inDims, std::vector<int32_t> outSpDims) const {
     std::vector<std::reference_wrapper<const VectorDims>> inputShapesRefs{std::ref(inDims), std::ref(getWeightDims())};
-    std::unordered_map<size_t, MemoryPtr> inputValues;
+    std::vector<const Memory*> inputValues(inputShapes.size(), nullptr);
     VectorDims outSpDimsVecShape;
+    MemoryPtr outSpDimsMem;
 
     auto port_mask = shapeInference->get_port_mask();
     if (port_mask) {
@@ -569,9 +570,9 @@ VectorDims Deconvolution::shapeInferInternal(const VectorDims &inDims, std::vect
                 outSpDimsVecShape = {outSpDims.size()};
                 inputShapesRefs.push_back(std::cref(outSpDimsVecShape));
                 CpuBlockedMemoryDesc desc(Precision::I32, Shape(outSpDimsVecShape));
-                auto mem = std::make_shared<Memory>(getEngine());
-                mem->Create(desc, outSpDims.data());
-                inputValues[i] = mem;
+                outSpDimsMem = std::make_shared<Memory>(getEngine());
+                outSpDimsMem->Create(desc, outSpDims.data());
+                inputValues[i] = outSpDimsMem.get();
                 break;
             }
         }
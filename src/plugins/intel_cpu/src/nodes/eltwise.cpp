@@ -103,7 +103,7 @@ class EltwiseShapeInfer : public ShapeInferEmptyPads {
 public:
     std::vector<VectorDims> infer(
         const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
-        const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
+        const std::vector<const Memory*>& data_dependency) override {
         size_t max_rank = 0;
         size_t max_rank_idx = 0;
         for (size_t i = 0; i < input_shapes.size(); ++i) {
@@ -136,6 +136,45 @@ public:
         }
         return { output_shape };
     }
+    bool inferSymbolic(
+        const std::vector<std::reference_wrapper<const SymbolicDims>>& input_shapes,
+        std::vector<SymbolicDims>& output_shapes) const override {
+        if (input_shapes.empty())
+            return false;
+        size_t max_rank = 0;
+        size_t max_rank_idx = 0;
+        for (size_t i = 0; i < input_shapes.size(); ++i) {
+            auto item_rank = input_shapes[i].get().size();
+            if (item_rank > max_rank) {
+                max_rank = item_rank;
+                max_rank_idx = i;
+            }
+        }
+        auto output_shape = input_shapes[max_rank_idx].get();
+        const auto one = SymbolicDim::constant(1);
+        // the same NUMPY broadcast rule, but the dims which may be broadcasted only depending on the symbols values
+        // can't be expressed symbolically
+        for (size_t i = 0; i < input_shapes.size(); i++) {
+            if (i == max_rank_idx)
+                continue;
+
+            auto& input_shape = input_shapes[i].get();
+            if (input_shape.size() > output_shape.size())
+                return false;
+            size_t offset = output_shape.size() - input_shape.size();
+            for (size_t j = 0; j < input_shape.size(); ++j) {
+                if (input_shape[j] != output_shape[offset + j]) {
+                    if (output_shape[offset + j] == one) {
+                        output_shape[offset + j] = input_shape[j];
+                    } else if (input_shape[j] != one) {
+                        return false;
+                    }
+                }
+            }
+        }
+        output_shapes = { output_shape };
+        return true;
+    }
     port_mask_t get_port_mask() const override {
         return EMPTY_PORT_MASK;
     }
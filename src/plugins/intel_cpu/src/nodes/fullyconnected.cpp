@@ -24,6 +24,9 @@
 #include <common/primitive_desc_iface.hpp>
 #include "onednn/dnnl.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include "kernels/fc_decompression_kernel.hpp"
+#include "common/cpu_convert.h"
+#include <ie_parallel.hpp>
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -83,6 +86,48 @@ bool FCKey::operator==(const FCKey &rhs) const {
     return retVal;
 }
 
+struct FCDecompressionKey {
+    jit_fc_decompression_config_params jcp;
+    dnnl::primitive_attr attr;
+
+    size_t hash() const;
+    bool operator==(const FCDecompressionKey& rhs) const;
+};
+
+size_t FCDecompressionKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    seed = hash_combine(seed, jcp.weights_prc.getPrecVal());
+    seed = hash_combine(seed, jcp.rows);
+    seed = hash_combine(seed, jcp.K);
+    seed = hash_combine(seed, jcp.src_stride);
+    seed = hash_combine(seed, jcp.with_zero_points);
+    seed = hash_combine(seed, jcp.with_bias);
+    seed = hash_combine(seed, get_attr_hash(*attr.get()));
+    return seed;
+}
+
+bool FCDecompressionKey::operator==(const FCDecompressionKey& rhs) const {
+    return jcp.weights_prc == rhs.jcp.weights_prc && jcp.rows == rhs.jcp.rows && jcp.K == rhs.jcp.K &&
+           jcp.src_stride == rhs.jcp.src_stride && jcp.with_zero_points == rhs.jcp.with_zero_points &&
+           jcp.with_bias == rhs.jcp.with_bias && *attr.get() == *rhs.attr.get();
+}
+
+// [N, K] weights are packed to [N / simd][K][simd] blocks, so the kernel reads simd output channels of one k
+// by a single load; N is padded with zeros
+template <typename T>
+void packDecompressionWeights(const T* src, T* dst, size_t N, size_t K, size_t simd) {
+    parallel_for2d(div_up(N, simd), K, [&](size_t nb, size_t k) {
+        T* out = dst + (nb * K + k) * simd;
+        for (size_t n = 0; n < simd; n++) {
+            const size_t oc = nb * simd + n;
+            out[n] = oc < N ? src[oc * K + k] : T(0);
+        }
+    });
+}
+
 } // namespace
 
 bool FullyConnected::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
@@ -233,6 +278,11 @@ void FullyConnected::prepareParams() {
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
 
+    if (useWeightsDecompression && prepareWeightsDecompressionKernel(srcMemPtr, dstMemPtr)) {
+        selected_pd->setImplementationType(impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core) ? jit_avx512 : jit_avx2);
+        return;
+    }
+
     AttrPtr attr = std::make_shared<dnnl::primitive_attr>();
     setPostOps(*attr, dstMemPtr->getStaticDims());
     (*attr).set_scratchpad_mode(dnnl::scratchpad_mode::user);
@@ -391,6 +441,10 @@ void FullyConnected::prepareParams() {
 }
 
 void FullyConnected::setDynamicBatchLim(int lim) {
+    if (decompressionKernel) {
+        Node::setDynamicBatchLim(lim);
+        return;
+    }
     if (!execPtr) {
         IE_THROW() << "Can't set dynamic batch for FullyConnected node with name: " << getName() << ", because executor is not compiled";
     }
@@ -422,6 +476,10 @@ void FullyConnected::setDynamicBatchLim(int lim) {
 }
 
 void FullyConnected::execute(dnnl::stream strm) {
+    if (decompressionKernel) {
+        executeWeightsDecompression();
+        return;
+    }
     if (!execPtr) {
         IE_THROW() << "Can't execute FullyConnected node with name: " << getName() << ", because executor is not compiled";
     }
@@ -454,6 +512,206 @@ bool FullyConnected::canFuse(const NodePtr& node) const {
     return canFuseSimpleOperation(node);
 }
 
+bool FullyConnected::canUseWeightsDecompression() const {
+    return getOriginalInputPrecisionAtPort(DATA_ID) == Precision::FP32 && one_of(getInputShapeAtPort(DATA_ID).getRank(), 2, 3) &&
+           getInputShapeAtPort(WEIGHTS_ID).getRank() == 2 && getInputShapeAtPort(WEIGHTS_ID).isStatic();
+}
+
+void FullyConnected::setWeightsDecompression(const std::vector<float>& scales, const std::vector<float>& zeroPoints) {
+    useWeightsDecompression = true;
+    decompressionScales = scales;
+    decompressionZeroPoints = zeroPoints;
+}
+
+bool FullyConnected::prepareWeightsDecompressionKernel(const MemoryPtr& srcMemPtr, const MemoryPtr& dstMemPtr) {
+    using namespace dnnl::impl::cpu::x64;
+
+    decompressionKernel = nullptr;
+
+    const auto isa = mayiuse(avx512_core) ? avx512_core : avx2;
+    const auto weightsPrc = getOriginalInputPrecisionAtPort(WEIGHTS_ID);
+    if (!jit_uni_fc_decompression_kernel::isSupported(isa, weightsPrc))
+        return false;
+
+    // the input rows are flattened, so they must be dense rows of the plain layout
+    const auto srcDesc = srcMemPtr->GetDescWithType<BlockedMemoryDesc>();
+    const auto dstDesc = dstMemPtr->GetDescWithType<BlockedMemoryDesc>();
+    if (!srcDesc->hasLayoutType(LayoutType::ncsp) || !dstDesc->hasLayoutType(LayoutType::ncsp))
+        return false;
+    const auto& srcDims = srcDesc->getShape().getStaticDims();
+    const auto& srcStrides = srcDesc->getStrides();
+    const auto& dstStrides = dstDesc->getStrides();
+    const size_t rank = srcDims.size();
+    if (rank == 3 && (srcStrides[0] != srcStrides[1] * srcDims[1] || dstStrides[0] != dstStrides[1] * srcDims[1]))
+        return false;
+
+    // larger inputs are bound by the computations rather than by the weights reading
+    const size_t M = rank == 3 ? srcDims[0] * srcDims[1] : srcDims[0];
+    if (M > jit_uni_fc_decompression_kernel::maxRows(isa))
+        return false;
+
+    const auto& weightsDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const size_t N = weightsDims[0];
+    const size_t K = weightsDims[1];
+    const size_t simd = jit_uni_fc_decompression_kernel::simd(isa);
+
+    FCDecompressionKey key = {{weightsPrc, M, K, srcStrides[rank - 2], !decompressionZeroPoints.empty(), withBiases},
+                              dnnl::primitive_attr()};
+    setDecompressionPostOps(key.attr, dstMemPtr->getStaticDims());
+
+    auto builder = [isa](const FCDecompressionKey& key) -> std::shared_ptr<jit_uni_fc_decompression_kernel> {
+        std::shared_ptr<jit_uni_fc_decompression_kernel> kernel;
+        if (isa == avx512_core) {
+            kernel.reset(new jit_uni_fc_decompression_kernel_f32<avx512_core>(key.jcp, key.attr));
+        } else {
+            kernel.reset(new jit_uni_fc_decompression_kernel_f32<avx2>(key.jcp, key.attr));
+        }
+        kernel->create_ker();
+        return kernel;
+    };
+
+    auto cache = getRuntimeCache();
+    auto result = cache->getOrCreate(key, builder);
+    decompressionKernel = result.first;
+    decompressionDstStride = dstStrides[rank - 2];
+
+    if (!decompressionWeights) {
+        auto weights = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+        const CpuBlockedMemoryDesc packedDesc(weightsPrc, Shape(VectorDims{div_up(N, simd) * K * simd}));
+        auto create = [&] () {
+            MemoryPtr _ptr = std::make_shared<Memory>(getEngine());
+            _ptr->Create(packedDesc);
+            if (weightsPrc.size() == 1) {
+                packDecompressionWeights(reinterpret_cast<const uint8_t*>(weights->GetPtr()),
+                                         reinterpret_cast<uint8_t*>(_ptr->GetPtr()), N, K, simd);
+            } else {
+                packDecompressionWeights(reinterpret_cast<const uint16_t*>(weights->GetPtr()),
+                                         reinterpret_cast<uint16_t*>(_ptr->GetPtr()), N, K, simd);
+            }
+            return _ptr;
+        };
+
+        if (weightCache != nullptr) {
+            const std::string string_hash = getName() + "_decompression_" + std::to_string(simd)
+                                            + "_" + std::to_string(weights->GetSize())
+                                            + "_" + std::to_string(reinterpret_cast<uint64_t>(weights->GetData()));
+            auto shared_hash = [&] () {
+                return getName() + "_decompression_" + std::to_string(simd) + "_" + std::to_string(weights->GetSize()) +
+                       "_" + std::to_string(SharedWeightsStorage::hash(weights->GetData(), weights->GetSize(), 0));
+            };
+
+            decompressionWeights = *weightCache->findOrCreate(string_hash, create, packedDesc, getEngine(), shared_hash);
+        } else {
+            decompressionWeights = create();
+        }
+
+        const size_t paddedN = rnd_up(N, simd);
+        auto pad = [&](const std::vector<float>& values, float defaultValue) {
+            std::vector<float> padded(paddedN, values.size() == 1 ? values[0] : defaultValue);
+            if (values.size() > 1)
+                std::copy(values.begin(), values.end(), padded.begin());
+            return padded;
+        };
+        paddedScales = pad(decompressionScales, 1.f);
+        paddedZeroPoints = pad(decompressionZeroPoints, 0.f);
+        if (withBiases) {
+            const auto bias = reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemoryPtr()->GetPtr());
+            paddedBias = pad(std::vector<float>(bias, bias + N), 0.f);
+        }
+    }
+
+    return true;
+}
+
+void FullyConnected::setDecompressionPostOps(dnnl::primitive_attr& attr, const VectorDims& dims) {
+    dnnl::post_ops ops;
+
+    // the same flattening to 2D as for oneDNN inner product, see setPostOps
+    const VectorDims dims2D = dims.size() == 3 ? VectorDims{dims[0] * dims[1], dims[2]} : dims;
+
+    postOpsDataPtrs.clear();
+    for (auto &node : fusedWith) {
+        auto* fakeQuantizeNode = dynamic_cast<FakeQuantize *>(node.get());
+        if (fakeQuantizeNode) {
+            fakeQuantizeNode->appendPostOps(ops, {}, postOpsDataPtrs);
+            continue;
+        }
+
+        auto* eltwiseNode = dynamic_cast<Eltwise *>(node.get());
+        if (eltwiseNode) {
+            eltwiseNode->appendPostOps(ops, dims2D, postOpsDataPtrs);
+            continue;
+        }
+
+        IE_THROW() << "Fusing of " << NameFromType(node->getType()) << " operation to " << NameFromType(this->getType())
+                   << " node is not implemented";
+    }
+
+    attr.set_post_ops(ops);
+}
+
+void FullyConnected::decompressWeights(const MemoryPtr& weights, float* dst) {
+    const auto& weightsDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const size_t N = weightsDims[0];
+    const size_t K = weightsDims[1];
+
+    cpu_convert(weights->GetPtr(), dst, getOriginalInputPrecisionAtPort(WEIGHTS_ID), Precision::FP32, N * K);
+    if (decompressionScales.empty() && decompressionZeroPoints.empty())
+        return;
+
+    parallel_for(N, [&](size_t n) {
+        const float scale = decompressionScales.empty() ? 1.f : decompressionScales[decompressionScales.size() == 1 ? 0 : n];
+        const float zeroPoint = decompressionZeroPoints.empty() ? 0.f :
+                                decompressionZeroPoints[decompressionZeroPoints.size() == 1 ? 0 : n];
+        float* w = dst + n * K;
+        for (size_t k = 0; k < K; k++)
+            w[k] = (w[k] - zeroPoint) * scale;
+    });
+}
+
+void FullyConnected::executeWeightsDecompression() {
+    using namespace dnnl::impl::cpu::x64;
+
+    const auto& weightsDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const size_t N = weightsDims[0];
+    const size_t K = weightsDims[1];
+    const size_t rows = decompressionKernel->jcp_.rows;
+    const size_t simd = jit_uni_fc_decompression_kernel::simd(mayiuse(avx512_core) ? avx512_core : avx2);
+
+    const auto src = reinterpret_cast<const float*>(getParentEdgeAt(DATA_ID)->getMemoryPtr()->GetPtr());
+    const auto weights = reinterpret_cast<const uint8_t*>(decompressionWeights->GetPtr());
+    const auto dst = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+    const size_t weightsBlockSize = K * simd * getOriginalInputPrecisionAtPort(WEIGHTS_ID).size();
+
+    parallel_for(div_up(N, simd), [&](size_t nb) {
+        const size_t n0 = nb * simd;
+
+        auto args = jit_fc_decompression_call_args();
+        args.src = src;
+        args.weights = weights + nb * weightsBlockSize;
+        args.scales = paddedScales.data() + n0;
+        args.zero_points = paddedZeroPoints.data() + n0;
+        args.bias = withBiases ? paddedBias.data() + n0 : nullptr;
+        args.oc_off = n0 * sizeof(float);
+        args.post_op_data = postOpsDataPtrs.data();
+
+        if (n0 + simd <= N) {
+            args.dst = dst + n0;
+            args.dst_stride = decompressionDstStride * sizeof(float);
+            (*decompressionKernel)(&args);
+            return;
+        }
+
+        // the last block of the output channels is computed to the temporary buffer
+        std::vector<float> tail(rows * simd);
+        args.dst = tail.data();
+        args.dst_stride = simd * sizeof(float);
+        (*decompressionKernel)(&args);
+        for (size_t m = 0; m < rows; m++)
+            std::copy_n(tail.data() + m * simd, N - n0, dst + m * decompressionDstStride + n0);
+    });
+}
+
 void FullyConnected::setPostOps(dnnl::primitive_attr& attr, const VectorDims& dims_ext, bool initWeights) {
     dnnl::post_ops ops;
 
@@ -478,8 +736,9 @@ void FullyConnected::setPostOps(dnnl::primitive_attr& attr, const VectorDims& di
         IE_THROW() << "Unexpected rank(" << dims_ext.size() << ") for output tensor of node: " << getName();
     }
 
-    bool isINT8 = getOriginalInputPrecisionAtPort(WEIGHTS_ID) == Precision::U8 ||
-                  getOriginalInputPrecisionAtPort(WEIGHTS_ID) == Precision::I8;
+    // compressed INT8 weights are decompressed to FP32
+    bool isINT8 = !useWeightsDecompression && (getOriginalInputPrecisionAtPort(WEIGHTS_ID) == Precision::U8 ||
+                                               getOriginalInputPrecisionAtPort(WEIGHTS_ID) == Precision::I8);
 
     DnnlPostOpsComposer dnnlpoc(getEngine(), attr, ops, postOpsArgs, dims, dims.size() - 1, isINT8);
 
@@ -853,7 +1112,12 @@ MemoryPtr FullyConnected::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
         auto newSrcDesc = DnnlExtensionUtils::makeDescriptor(weightSrcDesc);
 
         Memory srcMemory{ getEngine() };
-        srcMemory.Create(newSrcDesc, blob->GetData());
+        if (useWeightsDecompression) {
+            srcMemory.Create(newSrcDesc->cloneWithNewPrecision(Precision::FP32));
+            decompressWeights(blob, reinterpret_cast<float*>(srcMemory.GetPtr()));
+        } else {
+            srcMemory.Create(newSrcDesc, blob->GetData());
+        }
 
         MemoryPtr _ptr = std::make_shared<Memory>(getEngine());
         _ptr->Create(weightDesc);
@@ -872,8 +1136,17 @@ MemoryPtr FullyConnected::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
             const std::string string_hash = getName() + "_" + format
                                             + "_" + std::to_string(blob->GetSize())
                                             + "_" + std::to_string(reinterpret_cast<uint64_t>(blob->GetData()));
+            auto shared_hash = [&] () {
+                // the decompressed weights also depend on the decompression scales and zero points
+                auto data_hash = SharedWeightsStorage::hash(blob->GetData(), blob->GetSize(), 0);
+                data_hash = SharedWeightsStorage::hash(decompressionScales.data(),
+                                                       decompressionScales.size() * sizeof(float), data_hash);
+                data_hash = SharedWeightsStorage::hash(decompressionZeroPoints.data(),
+                                                       decompressionZeroPoints.size() * sizeof(float), data_hash);
+                return getName() + "_" + format + "_" + std::to_string(blob->GetSize()) + "_" + std::to_string(data_hash);
+            };
 
-            ptr = *weightCache->findOrCreate(string_hash, create);
+            ptr = *weightCache->findOrCreate(string_hash, create, *weightDesc, getEngine(), shared_hash);
         } else {
             ptr = create();
         }
@@ -13,6 +13,9 @@
 
 namespace ov {
 namespace intel_cpu {
+
+struct jit_uni_fc_decompression_kernel;
+
 namespace node {
 
 class FullyConnected : public Node {
@@ -61,6 +64,9 @@ public:
 
     void setMinSparseRate(float sparseRate) { minSparseRate = sparseRate; }
 
+    bool canUseWeightsDecompression() const;
+    void setWeightsDecompression(const std::vector<float>& scales, const std::vector<float>& zeroPoints);
+
 private:
     void createDescriptorInternal(const dnnl::memory::desc &inputDesc,
                                   const dnnl::memory::desc &outputDesc);
@@ -116,6 +122,25 @@ private:
     float minSparseRate = 1.f;
     float weiSparseRate = 0.f;
     bool useSparseWeightsDecompression();
+
+    // compressed (FP16, BF16, INT8) weights with optional per output channel zero points and scales:
+    // small inputs are executed by the JIT kernel which decompresses the weights in registers,
+    // the larger ones by oneDNN with the weights decompressed once in prepareWeightMemory
+    bool useWeightsDecompression = false;
+    std::vector<float> decompressionScales;
+    std::vector<float> decompressionZeroPoints;
+    std::shared_ptr<jit_uni_fc_decompression_kernel> decompressionKernel = nullptr;
+    MemoryPtr decompressionWeights;
+    // padded to the output channels block of the kernel
+    std::vector<float> paddedScales;
+    std::vector<float> paddedZeroPoints;
+    std::vector<float> paddedBias;
+    size_t decompressionDstStride = 0;
+    std::vector<const void*> postOpsDataPtrs;
+    bool prepareWeightsDecompressionKernel(const MemoryPtr& srcMemPtr, const MemoryPtr& dstMemPtr);
+    void setDecompressionPostOps(dnnl::primitive_attr& attr, const VectorDims& dims);
+    void decompressWeights(const MemoryPtr& weights, float* dst);
+    void executeWeightsDecompression();
 };
 
 }   // namespace node
@@ -0,0 +1,188 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_preprocess.h"
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <ie_parallel.hpp>
+#include <utils/bfloat16.hpp>
+#include "ngraph_transformations/op/fused_preprocess.hpp"
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+bool FusedPreprocess::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!std::dynamic_pointer_cast<const FusedPreprocessNode>(op)) {
+            errorMessage = "Only FusedPreprocess operation is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+FusedPreprocess::FusedPreprocess(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache)
+        : Node(op, eng, cache, NgraphShapeInferFactory(op, EMPTY_PORT_MASK)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+    errorPrefix = "FusedPreprocess node with name '" + getName() + "'";
+    const auto preprocess = std::dynamic_pointer_cast<const FusedPreprocessNode>(op);
+    channelAxis = static_cast<size_t>(preprocess->get_channel_axis());
+    srcChannels.assign(preprocess->get_src_channels().begin(), preprocess->get_src_channels().end());
+    scales = preprocess->get_scale();
+    shifts = preprocess->get_shift();
+    order.assign(preprocess->get_order().begin(), preprocess->get_order().end());
+    if (order.empty()) {
+        order.resize(getInputShapeAtPort(0).getRank());
+        std::iota(order.begin(), order.end(), 0);
+    }
+}
+
+void FusedPreprocess::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    srcPrecision = getOriginalInputPrecisionAtPort(0);
+    if (!one_of(srcPrecision, Precision::U8, Precision::I8, Precision::FP32))
+        srcPrecision = Precision::FP32;
+    // the first layer may run in bf16, then normalized data is stored in bf16 right away
+    dstPrecision = getOriginalOutputPrecisionAtPort(0) == Precision::BF16 ? Precision::BF16 : Precision::FP32;
+
+    addSupportedPrimDesc({{LayoutType::ncsp, srcPrecision}},
+                         {{LayoutType::ncsp, dstPrecision}},
+                         impl_desc_type::ref_any);
+}
+
+void FusedPreprocess::prepareParams() {
+    const auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+    const auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!srcMemPtr || !srcMemPtr->isAllocated())
+        IE_THROW() << errorPrefix << " has not allocated input memory";
+    if (!dstMemPtr || !dstMemPtr->isAllocated())
+        IE_THROW() << errorPrefix << " has not allocated output memory";
+
+    srcDims = srcMemPtr->getStaticDims();
+    const size_t rank = srcDims.size();
+    srcStrides.assign(rank, 1);
+    for (int i = static_cast<int>(rank) - 2; i >= 0; i--)
+        srcStrides[i] = srcStrides[i + 1] * srcDims[i + 1];
+
+    VectorDims dstDims(rank);
+    for (size_t i = 0; i < rank; i++)
+        dstDims[i] = srcDims[order[i]];
+    VectorDims denseDstStrides(rank, 1);
+    for (int i = static_cast<int>(rank) - 2; i >= 0; i--)
+        denseDstStrides[i] = denseDstStrides[i + 1] * dstDims[i + 1];
+    dstStrides.assign(rank, 0);
+    for (size_t i = 0; i < rank; i++)
+        dstStrides[order[i]] = denseDstStrides[i];
+
+    // writes along the innermost output axis are contiguous, so it is iterated by the inner loop
+    innerAxis = order.back();
+    outerWork = 1;
+    for (size_t i = 0; i < rank; i++) {
+        if (srcDims[i] == 0)
+            outerWork = 0;
+        else if (i != innerAxis)
+            outerWork *= srcDims[i];
+    }
+}
+
+template <typename src_t, typename dst_t>
+void FusedPreprocess::executeImpl() {
+    const auto* src = reinterpret_cast<const src_t*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    auto* dst = reinterpret_cast<dst_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const int rank = static_cast<int>(srcDims.size());
+    const size_t innerSize = srcDims[innerAxis];
+    const size_t srcInnerStride = srcStrides[innerAxis];
+    const size_t dstInnerStride = dstStrides[innerAxis];
+    const bool uniform = scales.size() == 1;
+
+    // every work item is one row of the output: input axes except the inner one are unravelled from the work index,
+    // the fastest one is the last input axis, so for interleaved (NHWC) input neighbouring items read the same lines
+    parallel_for(outerWork, [&](size_t work) {
+        size_t srcOffset = 0;
+        size_t dstOffset = 0;
+        size_t channel = 0;
+        for (int axis = rank - 1; axis >= 0; axis--) {
+            if (static_cast<size_t>(axis) == innerAxis)
+                continue;
+            const size_t idx = work % srcDims[axis];
+            work /= srcDims[axis];
+            if (static_cast<size_t>(axis) == channelAxis)
+                channel = idx;
+            else
+                srcOffset += idx * srcStrides[axis];
+            dstOffset += idx * dstStrides[axis];
+        }
+
+        const src_t* s = src + srcOffset;
+        dst_t* d = dst + dstOffset;
+        if (innerAxis == channelAxis) {
+            for (size_t c = 0; c < innerSize; c++) {
+                const size_t srcC = srcChannels.empty() ? c : srcChannels[c];
+                const float scale = uniform ? scales[0] : scales[c];
+                const float shift = uniform ? shifts[0] : shifts[c];
+                d[c * dstInnerStride] = static_cast<dst_t>(scale * static_cast<float>(s[srcC * srcInnerStride]) + shift);
+            }
+            return;
+        }
+
+        s += (srcChannels.empty() ? channel : srcChannels[channel]) * srcStrides[channelAxis];
+        const float scale = uniform ? scales[0] : scales[channel];
+        const float shift = uniform ? shifts[0] : shifts[channel];
+        if (srcInnerStride == 1 && dstInnerStride == 1) {
+            for (size_t i = 0; i < innerSize; i++)
+                d[i] = static_cast<dst_t>(scale * static_cast<float>(s[i]) + shift);
+        } else {
+            for (size_t i = 0; i < innerSize; i++)
+                d[i * dstInnerStride] = static_cast<dst_t>(scale * static_cast<float>(s[i * srcInnerStride]) + shift);
+        }
+    });
+}
+
+template <typename dst_t>
+void FusedPreprocess::executeBySrcPrecision() {
+    switch (srcPrecision) {
+    case Precision::U8:
+        executeImpl<uint8_t, dst_t>();
+        break;
+    case Precision::I8:
+        executeImpl<int8_t, dst_t>();
+        break;
+    case Precision::FP32:
+        executeImpl<float, dst_t>();
+        break;
+    default:
+        IE_THROW() << errorPrefix << " has unsupported input precision: " << srcPrecision;
+    }
+}
+
+void FusedPreprocess::execute(dnnl::stream strm) {
+    if (outerWork == 0)
+        return;
+    if (dstPrecision == Precision::BF16)
+        executeBySrcPrecision<bfloat16_t>();
+    else
+        executeBySrcPrecision<float>();
+}
+
+bool FusedPreprocess::created() const {
+    return getType() == Type::FusedPreprocess;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <node.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+/**
+ * @brief Executes the whole model input preprocessing (element type conversion, channels reordering, mean/scale
+ * normalization and layout conversion) in one pass over the user tensor. See FusedPreprocessNode for the semantic.
+ */
+class FusedPreprocess : public Node {
+public:
+    FusedPreprocess(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    bool created() const override;
+    void prepareParams() override;
+    void executeDynamicImpl(dnnl::stream strm) override { execute(strm); }
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    template <typename dst_t>
+    void executeBySrcPrecision();
+    template <typename src_t, typename dst_t>
+    void executeImpl();
+
+    size_t channelAxis = 1;
+    std::vector<size_t> srcChannels;
+    std::vector<float> scales;
+    std::vector<float> shifts;
+    std::vector<size_t> order;
+
+    // runtime parameters, computed in prepareParams()
+    VectorDims srcDims;
+    VectorDims srcStrides;
+    // stride of each input axis inside the output tensor
+    VectorDims dstStrides;
+    // input axis iterated by the innermost loop: the one which is the innermost in the output
+    size_t innerAxis = 0;
+    size_t outerWork = 0;
+
+    InferenceEngine::Precision srcPrecision;
+    InferenceEngine::Precision dstPrecision;
+    std::string errorPrefix;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -351,7 +351,9 @@ void Input::cloneBlobIfRequired() {
                 + "_" + ptr;
     };
 
-    if (weightCache) {
+    // when the weights are shared between the processes, the original constants are referenced instead of being
+    // copied to the NUMA nodes of the streams, as the copies would not be shared
+    if (weightCache && !weightCache->getSharedStorage()) {
         MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
         memoryPtr = std::const_pointer_cast<const Memory>(ptr);
     } else if (isBlobAligned() && !hasSubnormals() && !isWA()) {
@@ -0,0 +1,223 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_decompression_kernel.hpp"
+#include <ie_common.h>
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+
+#define GET_OFF(field) offsetof(jit_fc_decompression_call_args, field)
+
+bool jit_uni_fc_decompression_kernel::isSupported(cpu_isa_t isa, Precision weightsPrc) {
+    if (!mayiuse(isa))
+        return false;
+    switch (weightsPrc) {
+    case Precision::FP16:
+        return cpu().has(Xbyak::util::Cpu::tF16C);
+    case Precision::BF16:
+    case Precision::I8:
+    case Precision::U8:
+        return true;
+    default:
+        return false;
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_fc_decompression_kernel_f32<isa>::generate() {
+    const auto &p = attr_.get()->post_ops_;
+    for (int i = 0; i < p.len(); i++) {
+        auto &post_op = p.entry_[i];
+        if (post_op.is_eltwise()) {
+            eltwise_injectors.push_back(std::make_shared<jit_uni_eltwise_injector_f32<isa>>(
+                    this, post_op.eltwise.alg, post_op.eltwise.alpha, post_op.eltwise.beta, post_op.eltwise.scale));
+        } else if (post_op.is_depthwise()) {
+            depthwise_injectors.push_back(std::make_shared<jit_uni_depthwise_injector_f32<isa>>(
+                    this, post_op));
+        } else if (post_op.is_quantization()) {
+            quantization_injectors.push_back(std::make_shared<jit_uni_quantization_injector_f32<isa>>(
+                    this, post_op, vmm_d_weights, vmm_d_bias, reg_d_weights, reg_d_bias));
+        }
+    }
+
+    const size_t simd = jit_uni_fc_decompression_kernel::simd(isa);
+    const size_t weights_step = simd * jcp_.weights_prc.size();
+    const size_t src_row_size = jcp_.src_stride * sizeof(float);
+    const size_t k_unroll = 4;
+
+    this->preamble();
+
+    mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+    mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+    mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+    mov(reg_dst_stride, ptr[reg_params + GET_OFF(dst_stride)]);
+    if (p.len() != 0) {
+        mov(reg_post_ops_data, ptr[reg_params + GET_OFF(post_op_data)]);
+        mov(reg_oc_off, ptr[reg_params + GET_OFF(oc_off)]);
+    }
+
+    for (size_t r = 0; r < jcp_.rows; r++)
+        uni_vpxor(vmm_acc(r), vmm_acc(r), vmm_acc(r));
+    if (jcp_.with_zero_points) {
+        mov(reg_aux, ptr[reg_params + GET_OFF(zero_points)]);
+        uni_vmovups(vmm_zero_points, ptr[reg_aux]);
+    }
+
+    // acc[r] += src[r][k] * (weights[k] - zero_points)
+    auto accumulate = [&](size_t k) {
+        load_weights(vmm_weights, ptr[reg_weights + k * weights_step]);
+        if (jcp_.with_zero_points)
+            uni_vsubps(vmm_weights, vmm_weights, vmm_zero_points);
+        for (size_t r = 0; r < jcp_.rows; r++) {
+            uni_vbroadcastss(vmm_src, ptr[reg_src + r * src_row_size + k * sizeof(float)]);
+            uni_vfmadd231ps(vmm_acc(r), vmm_weights, vmm_src);
+        }
+    };
+
+    Xbyak::Label main_loop_label;
+    Xbyak::Label main_loop_end_label;
+    Xbyak::Label tail_loop_label;
+    Xbyak::Label tail_loop_end_label;
+
+    mov(reg_work_amount, jcp_.K);
+    L(main_loop_label);
+    {
+        cmp(reg_work_amount, k_unroll);
+        jl(main_loop_end_label, T_NEAR);
+
+        for (size_t k = 0; k < k_unroll; k++)
+            accumulate(k);
+
+        add(reg_weights, k_unroll * weights_step);
+        add(reg_src, k_unroll * sizeof(float));
+        sub(reg_work_amount, k_unroll);
+        jmp(main_loop_label, T_NEAR);
+    }
+    L(main_loop_end_label);
+
+    L(tail_loop_label);
+    {
+        cmp(reg_work_amount, 0);
+        jle(tail_loop_end_label, T_NEAR);
+
+        accumulate(0);
+
+        add(reg_weights, weights_step);
+        add(reg_src, sizeof(float));
+        sub(reg_work_amount, 1);
+        jmp(tail_loop_label, T_NEAR);
+    }
+    L(tail_loop_end_label);
+
+    // dst[r] = acc[r] * scales + bias
+    mov(reg_aux, ptr[reg_params + GET_OFF(scales)]);
+    uni_vmovups(vmm_weights, ptr[reg_aux]);
+    if (jcp_.with_bias) {
+        mov(reg_aux, ptr[reg_params + GET_OFF(bias)]);
+        uni_vmovups(vmm_src, ptr[reg_aux]);
+    }
+    mov(reg_aux, reg_dst);
+    for (size_t r = 0; r < jcp_.rows; r++) {
+        if (jcp_.with_bias)
+            uni_vfmadd213ps(vmm_acc(r), vmm_weights, vmm_src);
+        else
+            uni_vmulps(vmm_acc(r), vmm_acc(r), vmm_weights);
+        uni_vmovups(ptr[reg_aux], vmm_acc(r));
+        add(reg_aux, reg_dst_stride);
+    }
+
+    // the post ops are applied to one row at a time, so the injectors are free to use all the other registers
+    if (p.len() != 0) {
+        mov(reg_aux, reg_dst);
+        for (size_t r = 0; r < jcp_.rows; r++) {
+            uni_vmovups(vmm_dst, ptr[reg_aux]);
+            apply_post_ops();
+            uni_vmovups(ptr[reg_aux], vmm_dst);
+            add(reg_aux, reg_dst_stride);
+        }
+    }
+
+    this->postamble();
+
+    for (auto& inj : eltwise_injectors)
+        inj->prepare_table();
+}
+
+template <cpu_isa_t isa>
+void jit_uni_fc_decompression_kernel_f32<isa>::load_weights(const Vmm& vmm, const Xbyak::Address& op) {
+    switch (jcp_.weights_prc) {
+        case Precision::FP16:
+            vcvtph2ps(vmm, op);
+            break;
+        case Precision::BF16:
+            uni_vpmovzxwd(vmm, op);
+            uni_vpslld(vmm, vmm, 16);
+            break;
+        case Precision::I8:
+            uni_vpmovsxbd(vmm, op);
+            uni_vcvtdq2ps(vmm, vmm);
+            break;
+        case Precision::U8:
+            uni_vpmovzxbd(vmm, op);
+            uni_vcvtdq2ps(vmm, vmm);
+            break;
+        default:
+            IE_THROW() << "Unsupported compressed weights precision " << jcp_.weights_prc;
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_fc_decompression_kernel_f32<isa>::apply_post_ops() {
+    const auto &p = attr_.get()->post_ops_;
+    int eltwise_inj_idx = 0;
+    int depthwise_inj_idx = 0;
+    int quantization_inj_idx = 0;
+    int post_ops_data_offset = 0;
+    for (int i = 0; i < p.len(); i++) {
+        auto& post_op = p.entry_[i];
+        if (post_op.is_eltwise()) {
+            eltwise_injectors[eltwise_inj_idx]->compute_vector_range(vmm_dst.getIdx(), vmm_dst.getIdx() + 1);
+            eltwise_inj_idx++;
+        } else if (post_op.is_depthwise()) {
+            mov(reg_d_weights, ptr[reg_post_ops_data + post_ops_data_offset]);
+            add(reg_d_weights, reg_oc_off);
+
+            depthwise_injectors[depthwise_inj_idx]->compute_vector_range(
+                    vmm_dst.getIdx(), vmm_dst.getIdx() + 1, reg_d_weights, reg_d_weights);
+
+            post_ops_data_offset += depthwise_injectors[depthwise_inj_idx]->memoryStep();
+            depthwise_inj_idx++;
+        } else if (post_op.is_quantization()) {
+            // the output is FP32, so the values are always rounded
+            bool do_dequantization = post_op.quantization.alg == alg_kind::quantization_quantize_dequantize;
+            int s_idx = vmm_dst.getIdx();
+
+            const Xbyak::RegExp quant_arg_base = reg_post_ops_data + post_ops_data_offset;
+            quantization_injectors[quantization_inj_idx]->init_crop_ptrs(quant_arg_base, reg_oc_off);
+            quantization_injectors[quantization_inj_idx]->compute_crop(s_idx, s_idx + 1, 0, 0, false);
+
+            quantization_injectors[quantization_inj_idx]->init_input_scale_shift_ptrs(quant_arg_base, reg_oc_off);
+            quantization_injectors[quantization_inj_idx]->compute_input_scale_shift(s_idx, s_idx + 1, 0, true, 0, false);
+
+            if (do_dequantization) {
+                quantization_injectors[quantization_inj_idx]->init_output_scale_shift_ptrs(quant_arg_base, reg_oc_off);
+                quantization_injectors[quantization_inj_idx]->compute_output_scale_shift(s_idx, s_idx + 1, 0, 0, false);
+            }
+
+            post_ops_data_offset += quantization_injectors[quantization_inj_idx]->memoryStep();
+            quantization_inj_idx++;
+        }
+    }
+}
+
+template struct jit_uni_fc_decompression_kernel_f32<cpu::x64::avx2>;
+template struct jit_uni_fc_decompression_kernel_f32<cpu::x64::avx512_core>;
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,116 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu/x64/jit_generator.hpp"
+#include <cpu/x64/injectors/jit_uni_eltwise_injector.hpp>
+#include <cpu/x64/injectors/jit_uni_depthwise_injector.hpp>
+#include <cpu/x64/injectors/jit_uni_quantization_injector.hpp>
+#include <ie_precision.hpp>
+#include <onednn/dnnl.h>
+
+namespace ov {
+namespace intel_cpu {
+
+struct jit_fc_decompression_config_params {
+    InferenceEngine::Precision weights_prc;
+    size_t rows;        // all the rows of the input are accumulated in registers
+    size_t K;
+    size_t src_stride;  // in elements
+    bool with_zero_points;
+    bool with_bias;
+};
+
+struct jit_fc_decompression_call_args {
+    const float* src;
+    const void* weights;        // [K][simd] block of the packed compressed weights
+    const float* scales;
+    const float* zero_points;
+    const float* bias;
+    float* dst;
+    size_t dst_stride;          // in bytes
+    size_t oc_off;              // in bytes
+    const void** post_op_data;
+};
+
+// Computes simd output channels of all the rows: the compressed weights are converted to FP32 in registers right
+// before they are multiplied, so only the compressed weights are read from memory.
+struct jit_uni_fc_decompression_kernel {
+    void (*ker_)(const jit_fc_decompression_call_args*);
+
+    void operator()(const jit_fc_decompression_call_args* args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    jit_uni_fc_decompression_kernel(const jit_fc_decompression_config_params& jcp, const dnnl::primitive_attr& attr)
+        : ker_(nullptr), jcp_(jcp), attr_(attr) {}
+    virtual ~jit_uni_fc_decompression_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    // output channels computed by one call, the packed weights, scales, zero points and bias are padded to it
+    static size_t simd(dnnl::impl::cpu::x64::cpu_isa_t isa) {
+        return isa == dnnl::impl::cpu::x64::avx512_core ? 16 : 8;
+    }
+    // larger inputs are compute bound and are executed by oneDNN with the decompressed weights
+    static size_t maxRows(dnnl::impl::cpu::x64::cpu_isa_t isa) {
+        return isa == dnnl::impl::cpu::x64::avx512_core ? 16 : 8;
+    }
+    static bool isSupported(dnnl::impl::cpu::x64::cpu_isa_t isa, InferenceEngine::Precision weightsPrc);
+
+    jit_fc_decompression_config_params jcp_;
+    dnnl::primitive_attr attr_;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_uni_fc_decompression_kernel_f32 : public jit_uni_fc_decompression_kernel, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_fc_decompression_kernel_f32)
+
+    jit_uni_fc_decompression_kernel_f32(const jit_fc_decompression_config_params& jcp, const dnnl::primitive_attr& attr)
+        : jit_uni_fc_decompression_kernel(jcp, attr), jit_generator(jit_name()) {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override;
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    void load_weights(const Vmm& vmm, const Xbyak::Address& op);
+    void apply_post_ops();
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_weights = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_dst_stride = r11;
+    Xbyak::Reg64 reg_work_amount = r12;
+    Xbyak::Reg64 reg_aux = r13;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Reg64 reg_oc_off = rax;
+    Xbyak::Reg64 reg_post_ops_data = rbx;
+    Xbyak::Reg64 reg_d_weights = r14;
+    Xbyak::Reg64 reg_d_bias = rdx;
+
+    Vmm vmm_dst = Vmm(0);
+    Vmm vmm_d_weights = Vmm(1);
+    Vmm vmm_d_bias = Vmm(2);
+    Vmm vmm_weights = Vmm(3);
+    Vmm vmm_src = Vmm(4);
+    Vmm vmm_zero_points = Vmm(5);
+    // accumulators of the rows
+    Vmm vmm_acc(size_t row) const { return Vmm(6 + row); }
+
+    std::vector<std::shared_ptr<dnnl::impl::cpu::x64::jit_uni_eltwise_injector_f32<isa>>> eltwise_injectors;
+    std::vector<std::shared_ptr<dnnl::impl::cpu::x64::jit_uni_depthwise_injector_f32<isa>>> depthwise_injectors;
+    std::vector<std::shared_ptr<dnnl::impl::cpu::x64::jit_uni_quantization_injector_f32<isa>>> quantization_injectors;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -32,7 +32,7 @@ public:
     explicit OneHotShapeInfer(int64_t axis) : m_axis(axis) {}
     std::vector<VectorDims> infer(
         const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
-        const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
+        const std::vector<const Memory*>& data_dependency) override {
         auto depth = reinterpret_cast<int32_t *>(data_dependency.at(1)->GetPtr())[0];
 
         auto result = input_shapes.front().get();
@@ -31,7 +31,7 @@ public:
     explicit PriorBoxClusteredShapeInfer(size_t number_of_priors) : m_number_of_priors(number_of_priors) {}
     std::vector<VectorDims> infer(
         const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
-        const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
+        const std::vector<const Memory*>& data_dependency) override {
         const int* in_data = reinterpret_cast<const int*>(data_dependency.at(0)->GetPtr());
         const int H = in_data[0];
         const int W = in_data[1];
@@ -316,7 +316,7 @@ public:
 
     std::vector<VectorDims> infer(
         const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
-        const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
+        const std::vector<const Memory*>& data_dependency) override {
         auto originOutputShapes = NgraphShapeInfer::infer(input_shapes, data_dependency);
 
         // Graph optimizer makes the same optimization. So this is required to make shapes compatible.
@@ -23,7 +23,7 @@ public:
     ShapeOfShapeInfer() = default;
     std::vector<VectorDims> infer(
         const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
-        const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
+        const std::vector<const Memory*>& data_dependency) override {
         IE_ASSERT(!input_shapes.empty());
         return {VectorDims{input_shapes.front().get().size()}};
     }
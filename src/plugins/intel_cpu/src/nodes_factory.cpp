@@ -91,6 +91,7 @@
 #include "nodes/eye.h"
 #include "nodes/interaction.h"
 #include "nodes/mha.h"
+#include "nodes/fused_preprocess.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -194,6 +195,7 @@ Node::NodesFactory::NodesFactory()
     INTEL_CPU_NODE(Eye, Type::Eye);
     INTEL_CPU_NODE(Interaction, Type::Interaction);
     INTEL_CPU_NODE(MHA, Type::MHA);
+    INTEL_CPU_NODE(FusedPreprocess, Type::FusedPreprocess);
 }
 
 #undef INTEL_CPU_NODE
@@ -9,8 +9,10 @@
 #include "extension.h"
 #include "itt.h"
 #include "serialize.h"
+#include "utils/pool_blob_allocator.hpp"
 
 #include <threading/ie_executor_manager.hpp>
+#include <chrono>
 #include <memory>
 #include <ie_plugin_config.hpp>
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
@@ -96,6 +98,8 @@
 #include "ngraph_transformations/convert_fq_rnn_to_quantized_rnn.hpp"
 #include "ngraph_transformations/move_eltwise_up_data_movement.hpp"
 #include "ngraph_transformations/swap_convert_transpose.hpp"
+#include "ngraph_transformations/mark_compressed_weights.hpp"
+#include "ngraph_transformations/fuse_preprocessing.hpp"
 
 #include <snippets/pass/collapse_subgraph.hpp>
 #include <snippets/pass/common_optimizations.hpp>
@@ -135,6 +139,7 @@
 #include "nodes/normalize.h"
 #include "nodes/mha.h"
 #include "utils/denormals.hpp"
+#include "utils/tracer.hpp"
 #include "transformations/common_optimizations/augru_cell_fusion.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
@@ -286,7 +291,8 @@ static bool fuse_type_to_convert(const std::shared_ptr<ngraph::Node>& node, ov::
 }
 
 static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function> nGraphFunc, const bool _enableLPT, const bool _enableBF16,
-                                               const bool _enableSnippets, const bool isLegacyApi) {
+                                               const bool _enableSnippets, const bool isLegacyApi,
+                                               const bool _enableWeightsDecompression) {
     ngraph::pass::Manager manager;
     manager.set_per_pass_validation(false);
     manager.register_pass<ngraph::pass::InitNodeInfo>();
@@ -307,6 +313,13 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
         }
         manager.register_pass<ov::pass::MarkDequantizationSubgraph>(defaultPrecisions);
     }
+    if (_enableWeightsDecompression) {
+        // INT8 weights of quantized models are handled by LPT
+        auto compressedPrecisions = useLpt ? ngraph::element::TypeVector{ngraph::element::f16, ngraph::element::bf16}
+                                           : ngraph::element::TypeVector{ngraph::element::f16, ngraph::element::bf16,
+                                                                         ngraph::element::i8, ngraph::element::u8};
+        manager.register_pass<MarkCompressedWeights>(compressedPrecisions);
+    }
     auto get_convert_precisions = []() {
         precisions_array array = {
             {ngraph::element::i64,     ngraph::element::i32},
@@ -496,6 +509,11 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
 
     // Allow FP16 Converts to be folded and FP16 constants to be upgraded to FP32 data type
     pass_config->disable<ov::pass::DisableDecompressionConvertConstantFolding>();
+    // except the compressed weights which are decompressed by FullyConnected on the fly
+    pass_config->set_callback<ngraph::pass::ConvertPrecision>(
+            [](const_node_ptr &node) -> bool {
+                return isCompressedWeights(node);
+            });
     pass_config->disable<ov::pass::ConvertCompressedOnlyToLegacy>();
     pass_config->disable<ov::pass::EyeDecomposition>();
 
@@ -636,6 +654,11 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
 
     postLPTPassManager.register_pass<ngraph::pass::ConstantFolding>();
 
+    // u8 input followed by Convert->Subtract->Multiply is a dequantization subgraph for LPT, so the preprocessing
+    // chain is only collapsed for non-quantized models
+    if (!useLpt)
+        postLPTPassManager.register_pass<FusePreprocessing>();
+
     // Snippets may brake MHA patterns so the fusion has to performed before
     postLPTPassManager.register_pass<MHAFusion>();
     postLPTPassManager.register_pass<FuseFQtoInteraction>();
@@ -896,11 +919,17 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     const bool enableDynamicBatch = (dynamicBatchProp != config.end() && dynamicBatchProp->second == PluginConfigParams::YES)
             || engConfig.enableDynamicBatch;
     const bool enableSnippets = !enableDynamicBatch;
+    const auto& weightsDecompressionProp = config.find(ov::intel_cpu::weights_decompression.name());
+    const bool enableWeightsDecompression = weightsDecompressionProp != config.end()
+            ? weightsDecompressionProp->second == PluginConfigParams::YES
+            : engConfig.fcWeightsDecompression;
     auto nGraphFunc = clonedNetwork.getFunction();
 
     DEBUG_LOG(PrintableModel(*nGraphFunc, "org_"));
 
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableBF16, enableSnippets, isLegacyAPI());
+    const auto transformationsBegin = std::chrono::steady_clock::now();
+
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableBF16, enableSnippets, isLegacyAPI(), enableWeightsDecompression);
 
     // need to check that all outputs have static shapes
     // checking that all inputs have static shapes is performed in the common part
@@ -915,6 +944,8 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     ApplyPerformanceHints(config, nGraphFunc);
 
     ConvertToCPUSpecificOpset(nGraphFunc);
+    const std::chrono::duration<double, std::milli> transformationsTime =
+        std::chrono::steady_clock::now() - transformationsBegin;
 
     DEBUG_LOG(PrintableModel(*nGraphFunc, "cpu_"));
 
@@ -939,13 +970,33 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         }
     }
 
-    return std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this());
+    auto execNetwork = std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this());
+    if (conf.tensorPool)
+        execNetwork->setTensorPool(tensorPool);
+    execNetwork->setTransformationsTime(transformationsTime.count());
+    return execNetwork;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     streamsExplicitlySetForEngine = streamsSet(config);
 
-    engConfig.readProperties(config);
+    // the tracer is process wide, so the property is applied immediately instead of being stored in the config
+    auto engineConfig = config;
+    auto tracing = engineConfig.find(ov::intel_cpu::runtime_tracing.name());
+    bool enableTracing = false;
+    const bool setTracing = tracing != engineConfig.end();
+    if (setTracing) {
+        if (tracing->second == PluginConfigParams::YES) enableTracing = true;
+        else if (tracing->second == PluginConfigParams::NO) enableTracing = false;
+        else
+            IE_THROW() << "Wrong value for property key " << ov::intel_cpu::runtime_tracing.name()
+                               << ". Expected only YES/NO";
+        engineConfig.erase(tracing);
+    }
+
+    engConfig.readProperties(engineConfig);
+    if (setTracing)
+        Tracer::enable(enableTracing);
 }
 
 bool Engine::isLegacyAPI() const {
@@ -1002,6 +1053,22 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = engConfig.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
+    } else if (name == ov::intel_cpu::elastic_streams) {
+        const bool elastic = engConfig.elasticStreams;
+        return decltype(ov::intel_cpu::elastic_streams)::value_type(elastic);
+    } else if (name == ov::intel_cpu::weights_decompression) {
+        const bool weightsDecompression = engConfig.fcWeightsDecompression;
+        return decltype(ov::intel_cpu::weights_decompression)::value_type(weightsDecompression);
+    } else if (name == ov::intel_cpu::tensor_pool) {
+        const bool tensorPool = engConfig.tensorPool;
+        return decltype(ov::intel_cpu::tensor_pool)::value_type(tensorPool);
+    } else if (name == ov::intel_cpu::shared_weights_dir) {
+        return decltype(ov::intel_cpu::shared_weights_dir)::value_type(engConfig.sharedWeightsDir);
+    } else if (name == ov::intel_cpu::hardware_counters) {
+        const bool hardwareCounters = engConfig.collectHardwareCounters;
+        return decltype(ov::intel_cpu::hardware_counters)::value_type(hardwareCounters);
+    } else if (name == ov::intel_cpu::runtime_tracing) {
+        return decltype(ov::intel_cpu::runtime_tracing)::value_type(Tracer::isEnabled());
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -1074,6 +1141,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RO_property(ov::device::full_name.name()),
                                                     RO_property(ov::device::capabilities.name()),
                                                     RO_property(ov::caching_properties.name()),
+                                                    RO_property(ov::intel_cpu::runtime_trace.name()),
+                                                    RO_property(ov::intel_cpu::tensor_pool_statistics.name()),
                                                     RO_property(ov::cache_dir.name())   // WA Can be removed after implementing snippet serialization.
         };
         // the whole config is RW before network is loaded.
@@ -1084,6 +1153,12 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RW_property(ov::hint::inference_precision.name()),
                                                     RW_property(ov::hint::performance_mode.name()),
                                                     RW_property(ov::hint::num_requests.name()),
+                                                    RW_property(ov::intel_cpu::elastic_streams.name()),
+                                                    RW_property(ov::intel_cpu::weights_decompression.name()),
+                                                    RW_property(ov::intel_cpu::hardware_counters.name()),
+                                                    RW_property(ov::intel_cpu::tensor_pool.name()),
+                                                    RW_property(ov::intel_cpu::shared_weights_dir.name()),
+                                                    RW_property(ov::intel_cpu::runtime_tracing.name()),
         };
 
         std::vector<ov::PropertyName> supportedProperties;
@@ -1115,6 +1190,10 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == ov::range_for_streams) {
         const std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         return decltype(ov::range_for_streams)::value_type(range);
+    } else if (name == ov::intel_cpu::runtime_trace) {
+        return decltype(ov::intel_cpu::runtime_trace)::value_type(Tracer::exportChromeTrace());
+    } else if (name == ov::intel_cpu::tensor_pool_statistics) {
+        return decltype(ov::intel_cpu::tensor_pool_statistics)::value_type(poolStatisticsToMap(tensorPool->get_statistics()));
     } else if (name == ov::caching_properties) {
         std::vector<ov::PropertyName> cachingProperties;
         return decltype(ov::caching_properties)::value_type(cachingProperties);
@@ -1153,7 +1232,8 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
 
     auto supported = GetSupportedNodes(model,
     [&](std::shared_ptr<ov::Model>& model) {
-            TransformationUpToCPUSpecificOpSet(model, enableLPT, conf.enforceBF16, enableSnippets, isLegacyAPI());
+            TransformationUpToCPUSpecificOpSet(model, enableLPT, conf.enforceBF16, enableSnippets, isLegacyAPI(),
+                                               conf.fcWeightsDecompression);
             ConvertToCPUSpecificOpset(model);
         },
     [&](const std::shared_ptr<ngraph::Node>& op) {
@@ -1209,6 +1289,8 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
     }
 
     auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this());
+    if (conf.tensorPool)
+        execNetwork->setTensorPool(tensorPool);
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
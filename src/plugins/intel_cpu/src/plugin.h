@@ -6,6 +6,7 @@
 
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
 #include "exec_network.h"
+#include <openvino/runtime/pool_allocator.hpp>
 
 #include <string>
 #include <map>
@@ -58,6 +59,8 @@ private:
     const std::string deviceFullName;
 
     std::shared_ptr<void> specialSetup;
+    // shared by the compiled models which allocate the tensors of the infer requests from the pool
+    std::shared_ptr<ov::PoolAllocator> tensorPool = std::make_shared<ov::PoolAllocator>();
 };
 
 }   // namespace intel_cpu
@@ -0,0 +1,119 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_weights_storage.hpp"
+
+#include <openvino/core/version.hpp>
+#include <openvino/util/file_util.hpp>
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+SharedWeightsStorage::SharedWeightsStorage(const std::string& directory) : directory(directory) {
+#ifndef _WIN32
+    ov::util::create_directory_recursive(directory);
+#endif
+    const std::string buildNumber = ov::get_openvino_version().buildNumber;
+    std::stringstream stream;
+    stream << std::hex << hash(buildNumber.data(), buildNumber.size(), 0);
+    buildKey = stream.str();
+}
+
+std::string SharedWeightsStorage::filePath(const std::string& key) const {
+    return directory + "/" + buildKey + "_" + key + ".bin";
+}
+
+MemoryPtr SharedWeightsStorage::map(const std::string& key, const MemoryDesc& desc, const dnnl::engine& eng) const {
+#ifndef _WIN32
+    const auto size = desc.getCurrentMemSize();
+    if (size == 0 || size == MemoryDesc::UNDEFINED_SIZE)
+        return nullptr;
+
+    const int fd = ::open(filePath(key).c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1)
+        return nullptr;
+    struct stat info;
+    void* data = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) == size) {
+        // the weights are constant, so a write to them is a bug and faults instead of silently copying the page
+        data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+    if (data == MAP_FAILED)
+        return nullptr;
+
+    std::shared_ptr<void> mapping(data, [size](void* ptr) {
+        munmap(ptr, size);
+    });
+    std::unique_ptr<Memory> memory(new Memory(eng));
+    memory->Create(desc, data, false);
+    return MemoryPtr(memory.release(), [mapping](Memory* memory) {
+        delete memory;
+    });
+#else
+    (void)key;
+    (void)desc;
+    (void)eng;
+    return nullptr;
+#endif
+}
+
+void SharedWeightsStorage::store(const std::string& key, const Memory& memory) const {
+#ifndef _WIN32
+    const auto path = filePath(key);
+    if (ov::util::file_exists(path))
+        return;
+
+    // other processes see either no file or the complete one
+    static std::atomic<uint64_t> counter{0};
+    const auto tmpPath = path + "." + std::to_string(getpid()) + "_" + std::to_string(counter++) + ".tmp";
+    {
+        std::ofstream out(tmpPath, std::ios::binary);
+        out.write(static_cast<const char*>(memory.GetData()), memory.GetSize());
+        if (!out) {
+            out.close();
+            std::remove(tmpPath.c_str());
+            return;
+        }
+    }
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0)
+        std::remove(tmpPath.c_str());
+#else
+    (void)key;
+    (void)memory;
+#endif
+}
+
+uint64_t SharedWeightsStorage::hash(const void* data, size_t size, uint64_t seed) {
+    // FNV-1a over the 64-bit words, the words are mixed to make the high bits affect the low ones
+    const uint64_t prime = 0x100000001b3;
+    uint64_t result = (seed ^ 0xcbf29ce484222325) * prime ^ size;
+    const auto bytes = static_cast<const uint8_t*>(data);
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        result = (result ^ word) * prime;
+        result ^= result >> 29;
+    }
+    for (; i < size; i++)
+        result = (result ^ bytes[i]) * prime;
+    return result;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,52 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * File backed storage of the constant weights shared by the processes which compile the same model.
+ *
+ * The first process stores the weights computed by the constant nodes (reorders, conversions) and prepared by the nodes
+ * (e.g. the reordered weights of FullyConnected) into the files of the directory, the other processes map the files
+ * instead of computing the weights. The files are mapped read-only, so the pages are shared by all the processes via
+ * page cache. On tmpfs (e.g. /dev/shm) the files are kept in the shared memory. The files of the different OpenVINO
+ * builds do not clash. Is not supported on Windows: nothing is stored or mapped.
+ */
+class SharedWeightsStorage {
+public:
+    typedef std::shared_ptr<SharedWeightsStorage> Ptr;
+
+    explicit SharedWeightsStorage(const std::string& directory);
+
+    /**
+     * @brief Maps the stored weights, returns nullptr if the weights with the key and the size of desc are not stored
+     */
+    MemoryPtr map(const std::string& key, const MemoryDesc& desc, const dnnl::engine& eng) const;
+
+    /**
+     * @brief Stores the weights if they are not stored yet. Failures are ignored: the weights are just not shared.
+     */
+    void store(const std::string& key, const Memory& memory) const;
+
+    static uint64_t hash(const void* data, size_t size, uint64_t seed);
+
+private:
+    std::string filePath(const std::string& key) const;
+
+    std::string directory;
+    // the weights computed by the different builds are not shared
+    std::string buildKey;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
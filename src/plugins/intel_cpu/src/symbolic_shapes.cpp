@@ -0,0 +1,143 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "symbolic_shapes.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace ov {
+namespace intel_cpu {
+
+void SymbolicShapes::init(const std::vector<NodePtr>& nodes) {
+    clear();
+
+    // symbolic output shapes of the dynamic nodes, an empty shape means that the output can't be used symbolically
+    std::unordered_map<const Node*, std::vector<SymbolicDims>> nodesOutputs;
+
+    functions.resize(nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        const auto& node = nodes[i];
+        auto& function = functions[i];
+        function.node = node;
+        if (!node->isDynamicNode())
+            continue;
+
+        std::vector<SymbolicDims> inputs(node->getParentEdges().size());
+        bool inputsKnown = true;
+        for (size_t port = 0; port < inputs.size() && inputsKnown; port++) {
+            const auto edge = node->getParentEdgesAtPort(port)[0];
+            const auto parent = edge->getParent();
+            const auto& shape = parent->getOutputShapeAtPort(edge->getInputNum());
+            auto& dims = inputs[port];
+            if (shape.getRank() == 0) {
+                // scalars are represented as {1} by the nodes, so 0D shapes are not expected here
+            } else if (shape.isStatic()) {
+                for (auto dim : shape.getStaticDims())
+                    dims.push_back(SymbolicDim::constant(dim));
+            } else {
+                auto parentOutputs = nodesOutputs.find(parent.get());
+                if (parentOutputs != nodesOutputs.end())
+                    dims = parentOutputs->second[edge->getInputNum()];
+            }
+            for (const auto& dim : dims) {
+                if (!dim.isConstant() && !symbols[dim.id].edge)
+                    symbols[dim.id].edge = edge;
+            }
+            inputsKnown = !dims.empty();
+        }
+
+        std::vector<SymbolicDims> outputs;
+        if (inputsKnown) {
+            std::vector<std::reference_wrapper<const SymbolicDims>> inputsRefs(inputs.begin(), inputs.end());
+            function.compiled = node->shapeInferSymbolic(inputsRefs, outputs);
+        }
+        for (size_t port = 0; port < outputs.size() && function.compiled; port++) {
+            const auto& dims = node->getOutputShapeAtPort(port).getDims();
+            auto& symbolicDims = outputs[port];
+            if (symbolicDims.size() != dims.size() || dims.empty()) {
+                function.compiled = false;
+                break;
+            }
+            // the dims known at compile time must be constants
+            for (size_t j = 0; j < dims.size(); j++) {
+                if (dims[j] == Shape::UNDEFINED_DIM)
+                    continue;
+                if (symbolicDims[j].isConstant() && symbolicDims[j].value != dims[j]) {
+                    function.compiled = false;
+                    break;
+                }
+                symbolicDims[j] = SymbolicDim::constant(dims[j]);
+            }
+        }
+
+        if (function.compiled) {
+            function.outputShapes = outputs;
+            function.lastShapes.resize(outputs.size());
+            for (size_t port = 0; port < outputs.size(); port++)
+                function.lastShapes[port].resize(outputs[port].size());
+        } else {
+            // the outputs are computed by the node itself, so their undefined dims become new symbols
+            outputs.clear();
+            for (size_t port = 0; port < node->getOriginalOutputsNumber(); port++) {
+                const auto& dims = node->getOutputShapeAtPort(port).getDims();
+                SymbolicDims symbolicDims;
+                for (size_t j = 0; j < dims.size(); j++) {
+                    if (dims[j] == Shape::UNDEFINED_DIM) {
+                        symbolicDims.push_back(SymbolicDim::symbol(symbols.size()));
+                        symbols.push_back({nullptr, j});
+                    } else {
+                        symbolicDims.push_back(SymbolicDim::constant(dims[j]));
+                    }
+                }
+                outputs.push_back(std::move(symbolicDims));
+            }
+        }
+        nodesOutputs[node.get()] = std::move(outputs);
+    }
+}
+
+void SymbolicShapes::clear() {
+    symbols.clear();
+    functions.clear();
+}
+
+void SymbolicShapes::updateShapes(size_t nodeIdx) {
+    auto& function = functions[nodeIdx];
+    if (!function.compiled) {
+        function.node->updateShapes();
+        return;
+    }
+
+    bool modified = false;
+    for (size_t port = 0; port < function.outputShapes.size(); port++) {
+        const auto& symbolicDims = function.outputShapes[port];
+        auto& dims = function.lastShapes[port];
+        for (size_t i = 0; i < symbolicDims.size(); i++) {
+            const auto& dim = symbolicDims[i];
+            if (dim.isConstant()) {
+                dims[i] = dim.value;
+            } else {
+                const auto& symbol = symbols[dim.id];
+                const auto value = symbol.edge->getMemory().getStaticDims()[symbol.dim];
+                modified = modified || dims[i] != value;
+                dims[i] = value;
+            }
+        }
+    }
+    // the constant dims are set on the first call, so the nodes with fully determined shapes are redefined only once
+    if (modified || !function.initialized) {
+        function.node->redefineOutputMemory(function.lastShapes);
+        function.initialized = true;
+    }
+}
+
+size_t SymbolicShapes::compiledNodesCount() const {
+    return std::count_if(functions.begin(), functions.end(), [](const ShapeFunction& function) {
+        return function.compiled;
+    });
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
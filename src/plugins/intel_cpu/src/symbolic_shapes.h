@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "node.h"
+#include "edge.h"
+
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Precompiled shape functions of a dynamic graph.
+ * At the graph initialization the dimensions are propagated symbolically through the dynamic nodes: the dynamic
+ * dimensions of the graph inputs and the outputs of the nodes which shapes can't be expressed symbolically (e.g. data
+ * dependent ones like NonZero or NMS) become symbols, and the output shapes of the other nodes are recorded as the
+ * constants and references to these symbols. At runtime such nodes get their output shapes by reading the current
+ * symbols values instead of calling the shape inference, the rest of the nodes fall back to Node::updateShapes().
+ */
+class SymbolicShapes {
+public:
+    /**
+     * @brief Builds the shape functions
+     * @param nodes topologically sorted executable nodes of the graph, the shapes are updated by the index in this vector
+     */
+    void init(const std::vector<NodePtr>& nodes);
+    void clear();
+
+    /**
+     * @brief Updates the output shapes of the node with the given index, must be called in the execution order
+     */
+    void updateShapes(size_t nodeIdx);
+
+    size_t compiledNodesCount() const;
+
+private:
+    struct Symbol {
+        EdgePtr edge;  // the edge to read the symbol value from
+        size_t dim;
+    };
+
+    struct ShapeFunction {
+        NodePtr node;
+        bool compiled = false;
+        bool initialized = false;
+        std::vector<SymbolicDims> outputShapes;
+        std::vector<VectorDims> lastShapes;
+    };
+
+    std::vector<Symbol> symbols;
+    std::vector<ShapeFunction> functions;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,135 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hardware_counters.hpp"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+const char* const counterNames[HardwareCounters::Count] = {
+    "cycles",
+    "instructions",
+    "llc_references",
+    "llc_misses",
+};
+
+#ifdef __linux__
+const uint64_t counterConfigs[HardwareCounters::Count] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_REFERENCES,
+    PERF_COUNT_HW_CACHE_MISSES,
+};
+
+int openEvent(uint64_t config, int groupFd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = groupFd == -1 ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+#endif
+
+}   // namespace
+
+const char* HardwareCounters::name(size_t counter) {
+    return counter < Count ? counterNames[counter] : "";
+}
+
+HardwareCounters& HardwareCounters::threadCounters() {
+    thread_local HardwareCounters counters;
+    return counters;
+}
+
+HardwareCounters::HardwareCounters() {
+    fds.fill(-1);
+    positions.fill(0);
+#ifdef __linux__
+    size_t position = 0;
+    for (size_t i = 0; i < Count; i++) {
+        // the events which can't be opened are skipped: the first opened one leads the group
+        const int fd = openEvent(counterConfigs[i], groupFd);
+        if (fd == -1)
+            continue;
+        if (groupFd == -1)
+            groupFd = fd;
+        fds[i] = fd;
+        positions[i] = position++;
+        availableMask |= 1u << i;
+    }
+    if (groupFd != -1 && ioctl(groupFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) == -1)
+        availableMask = 0;
+#endif
+}
+
+HardwareCounters::~HardwareCounters() {
+#ifdef __linux__
+    for (const auto fd : fds) {
+        if (fd != -1)
+            close(fd);
+    }
+#endif
+}
+
+bool HardwareCounters::read(Sample& sample) const {
+#ifdef __linux__
+    // nr, time_enabled, time_running, values
+    uint64_t data[3 + Count];
+    const auto size = ::read(groupFd, data, sizeof(data));
+    if (size < static_cast<ssize_t>(3 * sizeof(uint64_t)))
+        return false;
+    sample.timeEnabled = data[1];
+    sample.timeRunning = data[2];
+    for (size_t i = 0; i < Count; i++)
+        sample.values[i] = (availableMask & (1u << i)) && positions[i] < data[0] ? data[3 + positions[i]] : 0;
+    return true;
+#else
+    (void)sample;
+    return false;
+#endif
+}
+
+void HardwareCountersStat::add(const HardwareCounters::Sample& begin, const HardwareCounters::Sample& end, uint32_t mask) {
+    const auto enabled = end.timeEnabled - begin.timeEnabled;
+    const auto running = end.timeRunning - begin.timeRunning;
+    if (running == 0)
+        return;
+    const double scale = static_cast<double>(enabled) / running;
+    for (size_t i = 0; i < HardwareCounters::Count; i++) {
+        if (mask & (1u << i))
+            total[i] += static_cast<double>(end.values[i] - begin.values[i]) * scale;
+    }
+    this->mask = mask;
+    num++;
+}
+
+std::map<std::string, uint64_t> HardwareCountersStat::average() const {
+    std::map<std::string, uint64_t> result;
+    if (num == 0)
+        return result;
+    for (size_t i = 0; i < HardwareCounters::Count; i++) {
+        if (mask & (1u << i))
+            result[HardwareCounters::name(i)] = static_cast<uint64_t>(total[i] / num);
+    }
+    return result;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,101 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Hardware performance counters of the calling thread (Linux perf_event_open, user space only).
+ *
+ * The counters are opened on the first use in the thread. The counters which can't be opened (perf events are not
+ * supported by the kernel or hidden by a container, the permissions are insufficient, the event is not supported
+ * by the CPU) are just not reported. On other OSes no counters are available.
+ */
+class HardwareCounters {
+public:
+    enum Counter : size_t {
+        Cycles,
+        Instructions,
+        LlcReferences,
+        LlcMisses,
+        Count
+    };
+
+    struct Sample {
+        std::array<uint64_t, Count> values;
+        uint64_t timeEnabled;
+        uint64_t timeRunning;
+    };
+
+    static const char* name(size_t counter);
+
+    static HardwareCounters& threadCounters();
+
+    ~HardwareCounters();
+
+    // bit per available Counter
+    uint32_t mask() const {
+        return availableMask;
+    }
+
+    bool read(Sample& sample) const;
+
+private:
+    HardwareCounters();
+
+    int groupFd = -1;
+    std::array<int, Count> fds;
+    std::array<size_t, Count> positions;
+    uint32_t availableMask = 0;
+};
+
+/**
+ * @brief Hardware counters of the node accumulated over its executions.
+ */
+class HardwareCountersStat {
+public:
+    // multiplexed counters are scaled by the share of the time they were actually counting
+    void add(const HardwareCounters::Sample& begin, const HardwareCounters::Sample& end, uint32_t mask);
+
+    std::map<std::string, uint64_t> average() const;
+
+private:
+    std::array<double, HardwareCounters::Count> total = {};
+    uint32_t mask = 0;
+    uint32_t num = 0;
+};
+
+class HardwareCountersHelper {
+public:
+    explicit HardwareCountersHelper(HardwareCountersStat& stat)
+        : stat(stat), counters(HardwareCounters::threadCounters()) {
+        started = counters.mask() != 0 && counters.read(begin);
+    }
+
+    ~HardwareCountersHelper() {
+        HardwareCounters::Sample end;
+        if (started && counters.read(end))
+            stat.add(begin, end, counters.mask());
+    }
+
+private:
+    HardwareCountersStat& stat;
+    const HardwareCounters& counters;
+    HardwareCounters::Sample begin;
+    bool started = false;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
+
+#define HW_PERF(_node, _need) auto hwpc = _need ? std::unique_ptr<HardwareCountersHelper>( \
+    new HardwareCountersHelper(_node->HwCounters())) : nullptr;
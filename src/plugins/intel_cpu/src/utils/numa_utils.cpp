@@ -0,0 +1,50 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_utils.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+#if defined(__linux__) && defined(SYS_mbind)
+// the values are taken from <numaif.h> to avoid the dependency on libnuma
+namespace {
+constexpr int MPOL_PREFERRED = 1;
+constexpr unsigned MPOL_MF_MOVE = 1u << 1;
+}  // namespace
+
+bool bindToNumaNode(void* ptr, size_t size, int numaNodeId) {
+    if (ptr == nullptr || size == 0 || numaNodeId < 0)
+        return false;
+
+    const auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = (reinterpret_cast<uintptr_t>(ptr) + pageSize - 1) / pageSize * pageSize;
+    const auto end = (reinterpret_cast<uintptr_t>(ptr) + size) / pageSize * pageSize;
+    if (begin >= end)
+        return false;
+
+    constexpr size_t bitsPerWord = sizeof(unsigned long) * 8;
+    std::vector<unsigned long> nodeMask(numaNodeId / bitsPerWord + 1, 0);
+    nodeMask[numaNodeId / bitsPerWord] |= 1ul << (numaNodeId % bitsPerWord);
+    // the kernel expects the number of bits in the mask plus one
+    const unsigned long maxNode = nodeMask.size() * bitsPerWord + 1;
+
+    return 0 == syscall(SYS_mbind, begin, end - begin, MPOL_PREFERRED, nodeMask.data(), maxNode, MPOL_MF_MOVE);
+}
+#else
+bool bindToNumaNode(void*, size_t, int) {
+    return false;
+}
+#endif
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,20 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Sets the preferred NUMA node for the pages of the memory range and migrates the pages that are already
+ *        placed on other nodes. Only the pages fully covered by the range are affected.
+ * @return true if the memory policy was applied, false if NUMA placement is not supported by the OS
+ */
+bool bindToNumaNode(void* ptr, size_t size, int numaNodeId);
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,62 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_allocator.hpp>
+#include <openvino/runtime/pool_allocator.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Allocates the memory of the blobs from the ov::PoolAllocator
+ */
+class PoolBlobAllocator : public InferenceEngine::IAllocator {
+public:
+    explicit PoolBlobAllocator(std::shared_ptr<ov::PoolAllocator> pool) : pool(std::move(pool)) {}
+
+    void* lock(void* handle, InferenceEngine::LockOp) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(const size_t size) noexcept override {
+        try {
+            return pool->allocate(size, 64);
+        } catch (...) {
+            return nullptr;
+        }
+    }
+
+    bool free(void* handle) noexcept override {
+        try {
+            // the pool takes the size from the block
+            pool->deallocate(handle, 0, 64);
+            return true;
+        } catch (...) {
+            return false;
+        }
+    }
+
+private:
+    std::shared_ptr<ov::PoolAllocator> pool;
+};
+
+// reported by ov::intel_cpu::tensor_pool_statistics
+inline std::map<std::string, uint64_t> poolStatisticsToMap(const ov::PoolAllocatorStatistics& statistics) {
+    return {{"live_bytes", statistics.live_bytes},
+            {"high_water_mark", statistics.high_water_mark},
+            {"cached_bytes", statistics.cached_bytes},
+            {"allocations", statistics.allocations},
+            {"pool_hits", statistics.pool_hits}};
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -7,9 +7,41 @@
 #include <cpu_shape.h>
 #include <cpu_memory.h>
 #include <openvino/core/node.hpp>
+#include <limits>
 
 namespace ov {
 namespace intel_cpu {
+/**
+ * Dimension expressed over the symbols of a dynamic graph. The symbols are the dimensions which values are known only
+ * at runtime, e.g. the dynamic dimensions of the graph inputs. The dimension is either a constant or equal to a symbol.
+ * 
+ */
+struct SymbolicDim {
+    static constexpr size_t NO_SYMBOL = std::numeric_limits<size_t>::max();
+
+    static SymbolicDim constant(Dim value) {
+        return {NO_SYMBOL, value};
+    }
+    static SymbolicDim symbol(size_t id) {
+        return {id, 0};
+    }
+
+    bool isConstant() const {
+        return id == NO_SYMBOL;
+    }
+    bool operator==(const SymbolicDim& rhs) const {
+        return id == rhs.id && value == rhs.value;
+    }
+    bool operator!=(const SymbolicDim& rhs) const {
+        return !(*this == rhs);
+    }
+
+    size_t id;
+    Dim value;
+};
+
+using SymbolicDims = std::vector<SymbolicDim>;
+
 /**
  * This is CPU plugin specific shape inference interface.
  * 
@@ -25,13 +57,29 @@ public:
      * @brief This method actually performs all the necessary shape inference computations
      * 
      * @param input_shapes are the input tensors shapes
-     * @param data_dependency are the input tensors data, which are required by the shape inference algorithm. To define
-     * which inputs data are actually required, get_port_mask() is used
+     * @param data_dependency are the input tensors data indexed by the input port number, which are required by the shape
+     * inference algorithm. To define which inputs data are actually required, get_port_mask() is used, the other ports
+     * hold nullptr. Both containers are owned by the caller and may be reused between the calls, so that the shape
+     * inference does not allocate memory to pass the inputs
      * @return std::vector<VectorDims> resulting array of calculated shapes (per each output port)
      */
     virtual std::vector<VectorDims> infer(
         const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
-        const std::unordered_map<size_t, MemoryPtr>& data_dependency) = 0;
+        const std::vector<const Memory*>& data_dependency) = 0;
+
+    /**
+     * @brief Symbolic counterpart of infer(), which allows the graph to precompute the output shapes of dynamic nodes
+     * as functions of the graph symbols instead of calling infer() on each inference.
+     * 
+     * @param input_shapes are the input tensors shapes expressed over the graph symbols
+     * @param output_shapes resulting output shapes expressed over the same symbols
+     * @return false if the output shapes can't be expressed this way, e.g. they depend on the input data
+     */
+    virtual bool inferSymbolic(
+        const std::vector<std::reference_wrapper<const SymbolicDims>>& input_shapes,
+        std::vector<SymbolicDims>& output_shapes) const {
+        return false;
+    }
 
     /**
      * @brief Shape inference implementation may generate padding as by-product, these APIs is designed to retrieve them back.
@@ -19,7 +19,7 @@ public:
     InternalDynShapeInfer() = default;
     std::vector<VectorDims> infer(
         const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
-        const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
+        const std::vector<const Memory*>& data_dependency) override {
         IE_THROW(Unexpected) << "InternalDynShapeInfer infer method unexpected call";
         return {};
     }
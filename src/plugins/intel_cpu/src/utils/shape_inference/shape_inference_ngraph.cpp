@@ -8,38 +8,40 @@ using namespace ov::intel_cpu;
 
 std::vector<VectorDims> NgraphShapeInfer::infer(
         const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
-        const std::unordered_map<size_t, MemoryPtr>& data_dependency) {
+        const std::vector<const Memory*>& data_dependency) {
     const auto& iranks = m_shape_infer->get_input_ranks();
     IE_ASSERT(iranks.size() <= input_shapes.size()) << "Too few input shapes passed to Shape infer.";
-    std::vector<StaticShape> input_static_shapes;
-    std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>> input_values;
 
-    input_static_shapes.reserve(input_shapes.size());
+    m_input_static_shapes.resize(iranks.size());
     for (size_t port = 0; port < iranks.size(); port++) {
+        auto& static_shape = m_input_static_shapes[port];
         if (iranks[port] == 0) {
-            input_static_shapes.emplace_back();
+            static_shape.clear();
         } else {
-            input_static_shapes.emplace_back(input_shapes[port].get());
+            const auto& dims = input_shapes[port].get();
+            static_shape.resize(dims.size());
+            for (size_t i = 0; i < dims.size(); i++) {
+                static_shape[i] = dims[i];
+            }
         }
-        auto itr = data_dependency.find(port);
-        if (itr != data_dependency.end()) {
-            const auto& memPtr = itr->second;
-
-            ov::Shape shape;
-
+        const auto memPtr = port < data_dependency.size() ? data_dependency[port] : nullptr;
+        if (memPtr) {
             // use scalar shape {} instead of {1} if required by shapeInference
-            if (iranks[port] != 0) {
-                shape = ov::Shape(memPtr->getStaticDims());
+            static const VectorDims scalar_dims;
+            const auto& dims = iranks[port] != 0 ? memPtr->getStaticDims() : scalar_dims;
+            const auto type = InferenceEngine::details::convertPrecision(memPtr->getDesc().getPrecision());
+
+            auto& value = m_input_values[port];
+            if (!value || value->get_data_ptr() != memPtr->GetPtr() || value->get_element_type() != type ||
+                static_cast<const VectorDims&>(value->get_shape()) != dims) {
+                value = std::make_shared<ngraph::runtime::HostTensor>(type, ov::Shape(dims), memPtr->GetPtr());
             }
-
-            input_values[port] = std::make_shared<ngraph::runtime::HostTensor>(
-                InferenceEngine::details::convertPrecision(memPtr->getDesc().getPrecision()),
-                shape,
-                memPtr->GetPtr());
+        } else {
+            m_input_values.erase(port);
         }
     }
     // call shape inference API
-    std::vector<StaticShape> output_shapes = m_shape_infer->infer(input_static_shapes, input_values);
+    std::vector<StaticShape> output_shapes = m_shape_infer->infer(m_input_static_shapes, m_input_values);
 
     std::vector<VectorDims> result;
     result.reserve(output_shapes.size());
@@ -48,4 +50,4 @@ std::vector<VectorDims> NgraphShapeInfer::infer(
     }
 
     return result;
-}
\ No newline at end of file
+}
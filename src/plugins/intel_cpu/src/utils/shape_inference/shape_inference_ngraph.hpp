@@ -22,7 +22,7 @@ public:
 
     std::vector<VectorDims> infer(
         const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
-        const std::unordered_map<size_t, MemoryPtr>& data_dependency) override;
+        const std::vector<const Memory*>& data_dependency) override;
 
     // infer may generate padding as by-product, these APIs is designed to retrieve them back
     const ov::CoordinateDiff& get_pads_begin() override {
@@ -37,6 +37,9 @@ public:
 private:
     std::shared_ptr<IShapeInferCommon> m_shape_infer;
     IShapeInfer::port_mask_t m_port_mask;
+    // reused between the calls, so the input shapes and values are allocated only when their ranks or data change
+    std::vector<StaticShape> m_input_static_shapes;
+    std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>> m_input_values;
 };
 
 } // namespace intel_cpu
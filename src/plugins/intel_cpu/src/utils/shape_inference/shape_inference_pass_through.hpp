@@ -19,10 +19,18 @@ public:
     ShapeInferPassThrough() = default;
     std::vector<VectorDims> infer(
         const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
-        const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
+        const std::vector<const Memory*>& data_dependency) override {
         IE_ASSERT(!input_shapes.empty());
         return {input_shapes.front()};
     }
+    bool inferSymbolic(
+        const std::vector<std::reference_wrapper<const SymbolicDims>>& input_shapes,
+        std::vector<SymbolicDims>& output_shapes) const override {
+        if (input_shapes.empty())
+            return false;
+        output_shapes = {input_shapes.front()};
+        return true;
+    }
     port_mask_t get_port_mask() const override {
         return EMPTY_PORT_MASK;
     }
@@ -0,0 +1,191 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "tracer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_set>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+struct TraceEvent {
+    const char* category;
+    const char* name;
+    uint64_t begin;
+    uint64_t end;
+};
+
+// Atomic stores compile to plain stores on x86, atomics just make the concurrent export well defined.
+struct TraceEventSlot {
+    std::atomic<const char*> category;
+    std::atomic<const char*> name;
+    std::atomic<uint64_t> begin;
+    std::atomic<uint64_t> end;
+};
+
+// Written by the owner thread only. The reader copies the events and drops the ones which could be overwritten
+// while they were copied, so no locking is needed on both sides.
+struct ThreadBuffer {
+    static constexpr uint64_t capacity = 1 << 14;
+
+    explicit ThreadBuffer(uint32_t tid) : events(capacity), tid(tid) {}
+
+    std::vector<TraceEventSlot> events;
+    std::atomic<uint64_t> head{0};
+    std::atomic<bool> retired{false};
+    const uint32_t tid;
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    uint32_t nextTid = 1;
+    std::atomic<uint64_t> startTime{0};
+
+    std::unordered_set<std::string> strings;
+    std::mutex stringsMutex;
+};
+
+Registry& registry() {
+    // never destroyed: the threads of the static executors can record events while the static objects are destroyed
+    static Registry* instance = new Registry();
+    return *instance;
+}
+
+// Marks the buffer as retired on thread exit, the events stay available until the tracer is enabled again.
+struct ThreadBufferHolder {
+    ~ThreadBufferHolder() {
+        if (buffer)
+            buffer->retired.store(true);
+    }
+    std::shared_ptr<ThreadBuffer> buffer;
+};
+
+ThreadBuffer& threadBuffer() {
+    thread_local ThreadBufferHolder holder;
+    if (!holder.buffer) {
+        auto& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        holder.buffer = std::make_shared<ThreadBuffer>(reg.nextTid++);
+        reg.buffers.push_back(holder.buffer);
+    }
+    return *holder.buffer;
+}
+
+void writeEscaped(std::ostream& out, const char* str) {
+    for (; *str; ++str) {
+        const char c = *str;
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char code[8];
+            snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(c));
+            out << code;
+        } else {
+            out << c;
+        }
+    }
+}
+
+}   // namespace
+
+std::atomic<bool> Tracer::enabled{false};
+
+void Tracer::enable(bool enable) {
+    auto& reg = registry();
+    if (enable) {
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        if (!enabled.load()) {
+            reg.buffers.erase(std::remove_if(reg.buffers.begin(), reg.buffers.end(),
+                                             [](const std::shared_ptr<ThreadBuffer>& buffer) {
+                                                 return buffer->retired.load();
+                                             }),
+                              reg.buffers.end());
+            reg.startTime.store(now());
+        }
+    }
+    enabled.store(enable);
+}
+
+uint64_t Tracer::now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Tracer::record(const char* category, const char* name, uint64_t begin, uint64_t end) {
+    auto& buffer = threadBuffer();
+    const auto head = buffer.head.load(std::memory_order_relaxed);
+    auto& slot = buffer.events[head % ThreadBuffer::capacity];
+    slot.category.store(category, std::memory_order_release);
+    slot.name.store(name, std::memory_order_release);
+    slot.begin.store(begin, std::memory_order_release);
+    slot.end.store(end, std::memory_order_release);
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+const char* Tracer::intern(const std::string& str) {
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.stringsMutex);
+    return reg.strings.insert(str).first->c_str();
+}
+
+std::string Tracer::exportChromeTrace() {
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    auto& reg = registry();
+    {
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        buffers = reg.buffers;
+    }
+    const auto startTime = reg.startTime.load();
+
+    std::ostringstream out;
+    out.precision(3);
+    out << std::fixed << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    std::vector<TraceEvent> events;
+    for (const auto& buffer : buffers) {
+        const auto head = buffer->head.load(std::memory_order_acquire);
+        const auto tail = head > ThreadBuffer::capacity ? head - ThreadBuffer::capacity : 0;
+        events.clear();
+        for (auto i = tail; i < head; i++) {
+            const auto& slot = buffer->events[i % ThreadBuffer::capacity];
+            events.push_back({slot.category.load(std::memory_order_relaxed),
+                              slot.name.load(std::memory_order_relaxed),
+                              slot.begin.load(std::memory_order_relaxed),
+                              slot.end.load(std::memory_order_relaxed)});
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // the events which were overwritten during the copy are dropped, including the one being written now
+        const auto newHead = buffer->head.load(std::memory_order_acquire) + 1;
+        const auto overwritten = newHead > ThreadBuffer::capacity + tail ? newHead - ThreadBuffer::capacity - tail : 0;
+
+        for (size_t i = std::min<size_t>(overwritten, events.size()); i < events.size(); i++) {
+            const auto& event = events[i];
+            if (event.begin < startTime)
+                continue;
+            out << (first ? "" : ",") << "{\"name\":\"";
+            writeEscaped(out, event.name);
+            out << "\",\"cat\":\"";
+            writeEscaped(out, event.category);
+            out << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->tid
+                << ",\"ts\":" << static_cast<double>(event.begin - startTime) / 1000.0
+                << ",\"dur\":" << static_cast<double>(event.end - event.begin) / 1000.0 << "}";
+            first = false;
+        }
+    }
+    out << "]}";
+    return out.str();
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,83 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Process wide runtime tracer of the CPU plugin.
+ *
+ * Every thread records the begin / end timestamps of the traced scopes into its own fixed size ring buffer without
+ * any synchronization, the oldest events are overwritten when the buffer is full. When the tracer is disabled,
+ * tracing of a scope costs a single branch. Event names must outlive the tracer: use string literals or intern().
+ */
+class Tracer {
+public:
+    static bool isEnabled() {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Enables or disables recording. Enabling drops the events recorded before.
+     */
+    static void enable(bool enable);
+
+    static uint64_t now();
+
+    static void record(const char* category, const char* name, uint64_t begin, uint64_t end);
+
+    /**
+     * @brief Returns the pointer to the copy of the string which is valid until the process exits
+     */
+    static const char* intern(const std::string& str);
+
+    /**
+     * @brief Returns the recorded events in Chrome trace event format (chrome://tracing, https://ui.perfetto.dev)
+     */
+    static std::string exportChromeTrace();
+
+private:
+    static std::atomic<bool> enabled;
+};
+
+class TraceScope {
+public:
+    TraceScope() = default;
+    TraceScope(const char* category, const char* name) {
+        if (Tracer::isEnabled())
+            start(category, name);
+    }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    ~TraceScope() {
+        if (name)
+            Tracer::record(category, name, begin, Tracer::now());
+    }
+
+    void start(const char* category, const char* name) {
+        this->category = category;
+        this->name = name;
+        begin = Tracer::now();
+    }
+
+private:
+    const char* category = nullptr;
+    const char* name = nullptr;
+    uint64_t begin = 0;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
+
+#define CPU_TRACE_CONCAT_IMPL(x, y) x##y
+#define CPU_TRACE_CONCAT(x, y) CPU_TRACE_CONCAT_IMPL(x, y)
+#define CPU_TRACE_SCOPE(category, name) \
+    ov::intel_cpu::TraceScope CPU_TRACE_CONCAT(traceScope, __LINE__)(category, name)
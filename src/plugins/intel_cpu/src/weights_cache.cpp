@@ -6,6 +6,7 @@
 
 #include <ie_system_conf.h>
 #include <memory>
+#include <sstream>
 
 namespace ov {
 namespace intel_cpu {
@@ -39,22 +40,69 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
                             bool valid) {
     MemoryInfo::Ptr ptr;
     MemoryPtr newPtr;
-    {
+    for (;;) {
         std::unique_lock<std::mutex> lock(guard);
         auto found = sharedWeights.find(key);
+        if (found != sharedWeights.end() && (ptr = found->second)) {
+            if ((newPtr = ptr->sharedMemory.lock()))
+                break;
+            if (ptr->pending) {
+                // wait for the thread creating the memory and look up again, it may have failed
+                lock.unlock();
+                std::lock_guard<std::mutex> creation(ptr->guard);
+                continue;
+            }
+        }
 
-        if (found == sharedWeights.end()
-            || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
+        ptr = std::make_shared<MemoryInfo>(nullptr, valid);
+        ptr->pending = true;
+        std::unique_lock<std::mutex> creation(ptr->guard);
+        sharedWeights[key] = ptr;
+        lock.unlock();
+
+        try {
             newPtr = create();
-            ptr = std::make_shared<MemoryInfo>(newPtr, valid);
-            sharedWeights[key] = ptr;
+        } catch (...) {
+            lock.lock();
+            ptr->pending = false;
+            throw;
         }
+
+        lock.lock();
+        ptr->sharedMemory = newPtr;
+        ptr->pending = false;
+        break;
     }
     return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
                                                 ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
+                            const std::string& key,
+                            std::function<MemoryPtr(void)> create,
+                            const MemoryDesc& desc,
+                            const dnnl::engine& eng,
+                            std::function<std::string(void)> sharedKey) {
+    if (!sharedStorage)
+        return findOrCreate(key, create);
+
+    auto storage = sharedStorage;
+    auto createShared = [&] () {
+        // the shared key may contain any characters, the file name is made of its hash
+        const auto str = sharedKey();
+        std::stringstream stream;
+        stream << "node_" << std::hex << SharedWeightsStorage::hash(str.data(), str.size(), 0);
+        const auto fileKey = stream.str();
+        if (auto memory = storage->map(fileKey, desc, eng))
+            return memory;
+        auto memory = create();
+        storage->store(fileKey, *memory);
+        return memory;
+    };
+    return findOrCreate(key, createShared);
+}
+
 WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) const {
     MemoryInfo::Ptr ptr;
     MemoryPtr newPtr;
@@ -83,6 +131,11 @@ WeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
     return found->second;
 }
 
+void NumaNodesWeights::setSharedStorage(const SharedWeightsStorage::Ptr& storage) {
+    for (auto& cache : _cache_map)
+        cache.second->setSharedStorage(storage);
+}
+
 const WeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const {
     auto found = _cache_map.find(numa_id);
     if (found == _cache_map.end())
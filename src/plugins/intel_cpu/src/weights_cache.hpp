@@ -5,6 +5,7 @@
 #pragma once
 
 #include "cpu_memory.h"
+#include "shared_weights_storage.hpp"
 
 #include <unordered_map>
 #include <functional>
@@ -51,7 +52,10 @@ protected:
  * Caching store of Memory objects
  * Will return a cached object or create new one
  *
- * Is a thread safe
+ * Is a thread safe. The objects are created outside of the store lock, so the streams do not wait for each other
+ * unless they need the same object: then it is created once and the others wait for it.
+ *
+ * If the shared storage is set, the weights prepared by the nodes are also shared with the other processes.
  */
 class WeightsSharing {
     struct MemoryInfo {
@@ -65,6 +69,8 @@ class WeightsSharing {
         std::mutex guard;
         std::weak_ptr<Memory> sharedMemory;
         std::atomic<bool> valid;
+        // the memory is being created by another thread which holds the guard, protected by WeightsSharing::guard
+        bool pending = false;
     };
 
 public:
@@ -92,13 +98,29 @@ public:
                                    std::function<MemoryPtr(void)> create,
                                    bool valid = true);
 
+    /**
+     * @brief Same as above for the memory of desc fully computed by create(). If the shared storage is set, the memory
+     * stored by another process under the shared key is mapped instead of being created, the created memory is stored.
+     * The shared key is called only then: it must identify the content across the processes (e.g. hash the source
+     * data instead of using its address).
+     */
+    SharedMemory::Ptr findOrCreate(const std::string& key,
+                                   std::function<MemoryPtr(void)> create,
+                                   const MemoryDesc& desc,
+                                   const dnnl::engine& eng,
+                                   std::function<std::string(void)> sharedKey);
+
     SharedMemory::Ptr get(const std::string& key) const;
 
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
+    void setSharedStorage(const SharedWeightsStorage::Ptr& storage) { sharedStorage = storage; }
+    const SharedWeightsStorage::Ptr& getSharedStorage() const { return sharedStorage; }
+
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    SharedWeightsStorage::Ptr sharedStorage;
     static const SimpleDataHash simpleCRC;
 };
 
@@ -114,6 +136,8 @@ public:
     WeightsSharing::Ptr& operator[](int i);
     const WeightsSharing::Ptr& operator[](int i) const;
 
+    void setSharedStorage(const SharedWeightsStorage::Ptr& storage);
+
 private:
     std::map<int, WeightsSharing::Ptr> _cache_map;
 };
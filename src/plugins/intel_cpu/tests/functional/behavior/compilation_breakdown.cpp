@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+namespace {
+
+TEST(CompilationBreakdownTest, AllStreamsAreCompiled) {
+    ov::Core core;
+    const int streams = 4;
+    auto compiled_model = core.compile_model(ngraph::builder::subgraph::makeConvRelu(), "CPU", ov::num_streams(streams));
+
+    const auto breakdown = compiled_model.get_property(ov::intel_cpu::compilation_breakdown);
+    for (const auto& stage : {"transformations", "graph_build", "jit", "reorders", "total"}) {
+        ASSERT_EQ(breakdown.count(stage), 1) << stage;
+        EXPECT_GE(breakdown.at(stage), 0) << stage;
+    }
+    EXPECT_GT(breakdown.at("total"), 0);
+    EXPECT_LE(breakdown.at("graph_build"), breakdown.at("total"));
+
+    // the graphs of all the streams are compiled together with the model, not on the first inference
+    EXPECT_EQ(compiled_model.get_property(ov::intel_cpu::streams_numa_nodes).size(), static_cast<size_t>(streams));
+    for (int i = 0; i < streams; i++) {
+        const auto stream = "stream_" + std::to_string(i);
+        ASSERT_EQ(breakdown.count(stream), 1) << stream;
+        EXPECT_GT(breakdown.at(stream), 0) << stream;
+    }
+}
+
+}  // namespace
@@ -0,0 +1,126 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "ngraph_functions/builders.hpp"
+
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset9.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <thread>
+
+namespace {
+
+// Convolution followed by Gather: both nodes keep per thread data prepared for the number of threads
+std::shared_ptr<ov::Model> MakeConvGatherModel() {
+    const ov::element::Type precision = ov::element::f32;
+    auto params = ngraph::builder::makeParams(precision, {{1, 16, 32, 32}});
+    auto conv = ngraph::builder::makeConvolution(params[0], precision, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                 ov::op::PadType::EXPLICIT, 32);
+    std::vector<int32_t> indices(24);
+    for (size_t i = 0; i < indices.size(); i++)
+        indices[i] = static_cast<int32_t>((i * 7) % 32);
+    auto gather = std::make_shared<ov::opset9::Gather>(conv,
+                                                       ov::opset9::Constant::create(ov::element::i32, {24}, indices),
+                                                       ov::opset9::Constant::create(ov::element::i32, {}, {1}));
+    auto relu = std::make_shared<ov::opset9::Relu>(gather);
+    return std::make_shared<ov::Model>(ngraph::NodeVector{relu}, params, "ConvGatherModel");
+}
+
+// the pattern fused into a single MHA node, the node keeps per thread buffers
+std::shared_ptr<ov::Model> MakeMHAModel() {
+    const ov::element::Type precision = ov::element::f32;
+    auto params = ngraph::builder::makeParams(precision, {{1, 128, 12, 64}, {1, 128, 12, 64}, {1, 12, 128, 128},
+                                                          {1, 128, 12, 64}});
+    auto order = [](std::vector<int64_t> values) {
+        return ov::opset9::Constant::create(ov::element::i64, {values.size()}, values);
+    };
+    auto transpose0 = std::make_shared<ov::opset9::Transpose>(params[0], order({0, 2, 1, 3}));
+    auto transpose1 = std::make_shared<ov::opset9::Transpose>(params[1], order({0, 2, 3, 1}));
+    auto mul = std::make_shared<ov::opset9::Multiply>(transpose1,
+                                                      ov::opset9::Constant::create(precision, {1, 12, 1, 1}, {0.125f}));
+    auto matMul0 = std::make_shared<ov::opset9::MatMul>(transpose0, mul);
+    auto add = std::make_shared<ov::opset9::Add>(matMul0, params[2]);
+    auto reshape0 = std::make_shared<ov::opset9::Reshape>(add, order({12 * 128, -1}), true);
+    auto softMax = std::make_shared<ov::opset1::Softmax>(reshape0, 1);
+    auto reshape1 = std::make_shared<ov::opset9::Reshape>(softMax, order({1, 12, 128, 128}), true);
+    auto transpose2 = std::make_shared<ov::opset9::Transpose>(params[3], order({0, 2, 1, 3}));
+    auto matMul1 = std::make_shared<ov::opset9::MatMul>(reshape1, transpose2);
+    auto transpose3 = std::make_shared<ov::opset9::Transpose>(matMul1, order({0, 2, 1, 3}));
+    return std::make_shared<ov::Model>(ngraph::NodeVector{transpose3}, params, "MHAModel");
+}
+
+void FillInputs(ov::InferRequest& request) {
+    for (auto&& input : request.get_compiled_model().inputs()) {
+        auto tensor = request.get_tensor(input);
+        auto data = tensor.data<float>();
+        for (size_t i = 0; i < tensor.get_size(); i++)
+            data[i] = static_cast<float>(i % 13) / 13.f - 0.5f;
+    }
+}
+
+std::vector<float> GetOutput(ov::InferRequest& request) {
+    auto output = request.get_output_tensor();
+    return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+}
+
+void ExpectNear(const std::vector<float>& actual, const std::vector<float>& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); i++)
+        ASSERT_NEAR(actual[i], expected[i], 1e-4f * std::max(1.f, std::abs(expected[i]))) << "at " << i;
+}
+
+class ElasticStreamsTest : public CommonTestUtils::TestsCommon,
+                           public ::testing::WithParamInterface<std::function<std::shared_ptr<ov::Model>()>> {};
+
+// A single request runs in the arena spanning all the idle streams, the requests in flight load all the streams.
+// There are more threads than cores, so the TBB market can not give the idle workers to every arena at once.
+TEST_P(ElasticStreamsTest, ResultsDoNotDependOnLoad) {
+    ov::Core core;
+    auto model = GetParam()();
+    auto reference_model = core.compile_model(model, "CPU", ov::num_streams(1));
+    auto reference_request = reference_model.create_infer_request();
+    FillInputs(reference_request);
+    reference_request.infer();
+    const auto reference = GetOutput(reference_request);
+
+    const int streams = 4;
+    const int threads = 2 * std::max(streams, static_cast<int>(std::thread::hardware_concurrency()));
+    auto compiled_model = core.compile_model(model, "CPU",
+                                             ov::num_streams(streams),
+                                             ov::inference_num_threads(threads),
+                                             ov::intel_cpu::elastic_streams(true));
+    ASSERT_TRUE(compiled_model.get_property(ov::intel_cpu::elastic_streams));
+
+    std::vector<ov::InferRequest> requests;
+    for (int i = 0; i < 2 * streams; i++) {
+        requests.push_back(compiled_model.create_infer_request());
+        FillInputs(requests.back());
+    }
+    for (int iteration = 0; iteration < 3; iteration++) {
+        requests.front().infer();
+        ExpectNear(GetOutput(requests.front()), reference);
+
+        for (auto&& request : requests)
+            request.start_async();
+        for (auto&& request : requests) {
+            request.wait();
+            ExpectNear(GetOutput(request), reference);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ElasticStreams, ElasticStreamsTest,
+                         ::testing::Values(MakeConvGatherModel, MakeMHAModel),
+                         [](const ::testing::TestParamInfo<ElasticStreamsTest::ParamType>& info) {
+                             return info.index == 0 ? std::string("ConvGather") : std::string("MHA");
+                         });
+
+}  // namespace
@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+namespace {
+
+TEST(HardwareCountersTest, CountersAreReportedInProfilingInfo) {
+    ov::Core core;
+    auto compiled_model = core.compile_model(ngraph::builder::subgraph::makeConvRelu(), "CPU",
+                                             ov::enable_profiling(true), ov::intel_cpu::hardware_counters(true));
+    EXPECT_TRUE(compiled_model.get_property(ov::intel_cpu::hardware_counters));
+
+    auto request = compiled_model.create_infer_request();
+    for (size_t i = 0; i < 3; i++) {
+        request.infer();
+    }
+
+    // perf events may be unavailable in the environment, then the counters are just not reported
+    bool convolutionFound = false;
+    for (const auto& info : request.get_profiling_info()) {
+        if (info.node_name == "Convolution") {
+            convolutionFound = true;
+            const auto cycles = info.counters.find("cycles");
+            if (cycles != info.counters.end()) {
+                EXPECT_GT(cycles->second, 0);
+            }
+        }
+        if (info.status != ov::ProfilingInfo::Status::EXECUTED) {
+            EXPECT_TRUE(info.counters.empty()) << info.node_name;
+        }
+    }
+    EXPECT_TRUE(convolutionFound);
+}
+
+TEST(HardwareCountersTest, CountersRequireProfiling) {
+    ov::Core core;
+    auto compiled_model = core.compile_model(ngraph::builder::subgraph::makeConvRelu(), "CPU",
+                                             ov::enable_profiling(false), ov::intel_cpu::hardware_counters(true));
+    auto request = compiled_model.create_infer_request();
+    request.infer();
+    for (const auto& info : request.get_profiling_info()) {
+        EXPECT_TRUE(info.counters.empty()) << info.node_name;
+    }
+}
+
+}  // namespace
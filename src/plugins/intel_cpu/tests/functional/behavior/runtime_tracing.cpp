@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+namespace {
+
+class RuntimeTracingTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        core.set_property("CPU", ov::intel_cpu::runtime_tracing(false));
+    }
+
+    ov::Core core;
+};
+
+TEST_F(RuntimeTracingTest, TraceContainsRequestStagesAndNodes) {
+    core.set_property("CPU", ov::intel_cpu::runtime_tracing(true));
+    EXPECT_TRUE(core.get_property("CPU", ov::intel_cpu::runtime_tracing));
+    auto compiled_model = core.compile_model(ngraph::builder::subgraph::makeConvRelu(), "CPU");
+
+    auto request = compiled_model.create_infer_request();
+    for (size_t i = 0; i < 3; i++) {
+        request.start_async();
+        request.wait();
+    }
+
+    const auto trace = compiled_model.get_property(ov::intel_cpu::runtime_trace);
+    EXPECT_EQ(trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["), 0);
+    for (const auto& event : {"InferRequest::Infer", "InferRequest::PushInputs", "InferRequest::PullOutputs",
+                              "AsyncInferRequest::Queued", "{\"name\":\"Convolution\"", "\"ph\":\"X\""}) {
+        EXPECT_NE(trace.find(event), std::string::npos) << event;
+    }
+}
+
+TEST_F(RuntimeTracingTest, EnablingDropsPreviousEvents) {
+    auto compiled_model = core.compile_model(ngraph::builder::subgraph::makeConvRelu(), "CPU");
+    auto request = compiled_model.create_infer_request();
+
+    core.set_property("CPU", ov::intel_cpu::runtime_tracing(true));
+    request.infer();
+    core.set_property("CPU", ov::intel_cpu::runtime_tracing(false));
+    EXPECT_NE(core.get_property("CPU", ov::intel_cpu::runtime_trace).find("InferRequest::Infer"), std::string::npos);
+
+    // events are not recorded while the tracer is disabled
+    request.infer();
+    core.set_property("CPU", ov::intel_cpu::runtime_tracing(true));
+    EXPECT_EQ(core.get_property("CPU", ov::intel_cpu::runtime_trace).find("InferRequest::Infer"), std::string::npos);
+}
+
+TEST_F(RuntimeTracingTest, CanNotEnableForCompiledModel) {
+    // the tracer is process wide, so compiling a model must not switch it for the other models
+    EXPECT_THROW(core.compile_model(ngraph::builder::subgraph::makeConvRelu(), "CPU",
+                                    ov::intel_cpu::runtime_tracing(true)),
+                 ov::Exception);
+    EXPECT_FALSE(core.get_property("CPU", ov::intel_cpu::runtime_tracing));
+}
+
+}  // namespace
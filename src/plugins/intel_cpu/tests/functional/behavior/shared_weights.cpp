@@ -0,0 +1,115 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+#include <algorithm>
+#include <fstream>
+
+namespace {
+
+std::vector<float> Infer(ov::CompiledModel& compiled_model) {
+    auto request = compiled_model.create_infer_request();
+    auto input = request.get_input_tensor();
+    auto data = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); i++)
+        data[i] = static_cast<float>(i % 17) / 17.f - 0.5f;
+    request.infer();
+    auto output = request.get_output_tensor();
+    return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+}
+
+class SharedWeightsTest : public CommonTestUtils::TestsCommon {
+protected:
+    void SetUp() override {
+        directory = std::string("shared_weights_") + ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(directory, "bin");
+        CommonTestUtils::removeDir(directory);
+    }
+
+    std::string directory;
+};
+
+TEST_F(SharedWeightsTest, WeightsAreStoredAndMapped) {
+    ov::Core core;
+    auto model = ngraph::builder::subgraph::makeConvRelu();
+    auto reference_model = core.compile_model(model, "CPU");
+    const auto reference = Infer(reference_model);
+
+    auto storing_model = core.compile_model(model, "CPU", ov::intel_cpu::shared_weights_dir(directory));
+    EXPECT_EQ(storing_model.get_property(ov::intel_cpu::shared_weights_dir), directory);
+    EXPECT_EQ(Infer(storing_model), reference);
+#ifndef _WIN32
+    auto files = CommonTestUtils::listFilesWithExt(directory, "bin");
+    std::sort(files.begin(), files.end());
+    EXPECT_FALSE(files.empty());
+#endif
+
+    // the same model compiled by another core maps the stored weights. Both cores live in the test process,
+    // the other processes map the files in the same way, as the weights are found by the file names only.
+    {
+        ov::Core other_core;
+        auto mapping_model = other_core.compile_model(model, "CPU", ov::intel_cpu::shared_weights_dir(directory));
+        EXPECT_EQ(Infer(mapping_model), reference);
+    }
+#ifndef _WIN32
+    auto mapped_files = CommonTestUtils::listFilesWithExt(directory, "bin");
+    std::sort(mapped_files.begin(), mapped_files.end());
+    EXPECT_EQ(mapped_files, files);
+
+    // the weights are taken from the files rather than computed again: the model compiled over the rewritten files
+    // gives the different results. The files are rewritten in place when they are not mapped anymore.
+    for (const auto& file : files) {
+        const auto size = CommonTestUtils::fileSize(file);
+        std::fstream out(file, std::ios::binary | std::ios::in | std::ios::out);
+        const std::vector<char> zeros(static_cast<size_t>(size), 0);
+        out.write(zeros.data(), zeros.size());
+        ASSERT_TRUE(out.good()) << file;
+    }
+    ov::Core rewritten_core;
+    auto rewritten_model = rewritten_core.compile_model(model, "CPU", ov::intel_cpu::shared_weights_dir(directory));
+    EXPECT_NE(Infer(rewritten_model), reference);
+#endif
+}
+
+TEST_F(SharedWeightsTest, FullyConnectedWeightsAreStoredAndMapped) {
+    ov::Core core;
+    auto model = ngraph::builder::subgraph::makeMatMulBias();
+    auto reference_model = core.compile_model(model, "CPU");
+    const auto reference = Infer(reference_model);
+
+    // the weights reordered by the node are shared also by the single stream
+    auto storing_model = core.compile_model(model, "CPU", ov::intel_cpu::shared_weights_dir(directory),
+                                            ov::num_streams(1));
+    EXPECT_EQ(Infer(storing_model), reference);
+#ifndef _WIN32
+    auto files = CommonTestUtils::listFilesWithExt(directory, "bin");
+    const auto nodeFiles = std::count_if(files.begin(), files.end(), [](const std::string& file) {
+        return file.find("_node_") != std::string::npos;
+    });
+    EXPECT_GT(nodeFiles, 0);
+
+    for (const auto& file : files) {
+        const auto size = CommonTestUtils::fileSize(file);
+        std::fstream out(file, std::ios::binary | std::ios::in | std::ios::out);
+        const std::vector<char> zeros(static_cast<size_t>(size), 0);
+        out.write(zeros.data(), zeros.size());
+        ASSERT_TRUE(out.good()) << file;
+    }
+    ov::Core rewritten_core;
+    auto rewritten_model = rewritten_core.compile_model(model, "CPU", ov::intel_cpu::shared_weights_dir(directory),
+                                                        ov::num_streams(1));
+    EXPECT_NE(Infer(rewritten_model), reference);
+#endif
+}
+
+}  // namespace
@@ -0,0 +1,46 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+namespace {
+
+TEST(TensorPoolTest, RequestTensorsAreReused) {
+    ov::Core core;
+    auto compiled_model = core.compile_model(ngraph::builder::subgraph::makeConvRelu(), "CPU",
+                                             ov::intel_cpu::tensor_pool(true));
+    EXPECT_TRUE(compiled_model.get_property(ov::intel_cpu::tensor_pool));
+
+    {
+        auto request = compiled_model.create_infer_request();
+        request.infer();
+        const auto statistics = compiled_model.get_property(ov::intel_cpu::tensor_pool_statistics);
+        EXPECT_GE(statistics.at("live_bytes"), (16 + 32) * 32 * 32 * sizeof(float));
+        EXPECT_GE(statistics.at("allocations"), 2u);
+    }
+    EXPECT_EQ(compiled_model.get_property(ov::intel_cpu::tensor_pool_statistics).at("live_bytes"), 0u);
+
+    auto request = compiled_model.create_infer_request();
+    request.infer();
+    const auto statistics = compiled_model.get_property(ov::intel_cpu::tensor_pool_statistics);
+    EXPECT_GE(statistics.at("pool_hits"), 2u);
+    EXPECT_GE(statistics.at("high_water_mark"), statistics.at("live_bytes"));
+    // the pool is shared by the compiled models of the core
+    EXPECT_EQ(core.get_property("CPU", ov::intel_cpu::tensor_pool_statistics), statistics);
+}
+
+TEST(TensorPoolTest, PoolIsNotUsedByDefault) {
+    ov::Core core;
+    auto compiled_model = core.compile_model(ngraph::builder::subgraph::makeConvRelu(), "CPU");
+    EXPECT_FALSE(compiled_model.get_property(ov::intel_cpu::tensor_pool));
+    auto request = compiled_model.create_infer_request();
+    request.infer();
+    EXPECT_TRUE(compiled_model.get_property(ov::intel_cpu::tensor_pool_statistics).empty());
+}
+
+}  // namespace
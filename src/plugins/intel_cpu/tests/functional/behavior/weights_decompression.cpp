@@ -0,0 +1,135 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "common_test_utils/test_common.hpp"
+
+#include <exec_graph_info.hpp>
+#include <openvino/opsets/opset9.hpp>
+
+namespace {
+
+constexpr size_t inputChannels = 300;
+constexpr size_t outputChannels = 40;
+
+struct DecompressionParams {
+    ov::element::Type weightsPrecision;
+    bool withZeroPoints;
+    bool withScales;
+    bool withRelu;
+    // small batches are executed by the decompression kernel, the large ones by oneDNN
+    size_t batch;
+};
+
+std::shared_ptr<ov::Model> MakeCompressedMatMulModel(const DecompressionParams& params) {
+    auto data = std::make_shared<ov::opset9::Parameter>(ov::element::f32, ov::Shape{params.batch, inputChannels});
+
+    std::vector<float> weightsValues(outputChannels * inputChannels);
+    const int weightsShift = params.weightsPrecision == ov::element::u8 ? 0 : 6;
+    for (size_t i = 0; i < weightsValues.size(); i++)
+        weightsValues[i] = static_cast<float>(static_cast<int>(i % 13) - weightsShift);
+    auto weights = ov::opset9::Constant::create(params.weightsPrecision, {outputChannels, inputChannels}, weightsValues);
+    std::shared_ptr<ov::Node> decompressed = std::make_shared<ov::opset9::Convert>(weights, ov::element::f32);
+    if (params.withZeroPoints) {
+        std::vector<float> zeroPointsValues(outputChannels);
+        for (size_t i = 0; i < zeroPointsValues.size(); i++)
+            zeroPointsValues[i] = static_cast<float>(static_cast<int>(i % 5) - 2);
+        auto zeroPoints = ov::opset9::Constant::create(ov::element::f32, {outputChannels, 1}, zeroPointsValues);
+        decompressed = std::make_shared<ov::opset9::Subtract>(decompressed, zeroPoints);
+    }
+    if (params.withScales) {
+        std::vector<float> scalesValues(outputChannels);
+        for (size_t i = 0; i < scalesValues.size(); i++)
+            scalesValues[i] = 0.01f * static_cast<float>(i + 1);
+        auto scales = ov::opset9::Constant::create(ov::element::f32, {outputChannels, 1}, scalesValues);
+        decompressed = std::make_shared<ov::opset9::Multiply>(decompressed, scales);
+    }
+
+    std::shared_ptr<ov::Node> result = std::make_shared<ov::opset9::MatMul>(data, decompressed, false, true);
+    if (params.withRelu)
+        result = std::make_shared<ov::opset9::Relu>(result);
+    return std::make_shared<ov::Model>(ov::NodeVector{result}, ov::ParameterVector{data}, "CompressedMatMul");
+}
+
+// the weights are fused into FullyConnected in their original precision, there is no Convert left in the graph,
+// the activation is fused into FullyConnected as well
+void CheckWeightsAreCompressed(const ov::CompiledModel& compiledModel, const DecompressionParams& params) {
+    size_t fullyConnectedCount = 0;
+    for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        const auto layerType = rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>();
+        ASSERT_TRUE(layerType == "Input" || layerType == "Output" || layerType == "FullyConnected")
+            << layerType << " " << node->get_friendly_name();
+        if (layerType != "FullyConnected")
+            continue;
+        fullyConnectedCount++;
+        ASSERT_GE(node->get_input_size(), 2u);
+        EXPECT_EQ(node->get_input_element_type(1), params.weightsPrecision);
+        const auto implType = rtInfo.at(ExecGraphInfoSerialization::IMPL_TYPE).as<std::string>();
+        EXPECT_EQ(implType.find("ref"), std::string::npos) << implType;
+    }
+    EXPECT_EQ(fullyConnectedCount, 1u);
+}
+
+void CompareWithAndWithoutDecompression(const DecompressionParams& params) {
+    ov::Core core;
+    auto model = MakeCompressedMatMulModel(params);
+    // the weights are decompressed only for FP32 activations
+    auto reference = core.compile_model(model, "CPU", ov::hint::inference_precision(ov::element::f32));
+    auto compressed = core.compile_model(model, "CPU", ov::hint::inference_precision(ov::element::f32),
+                                         ov::intel_cpu::weights_decompression(true));
+    EXPECT_FALSE(reference.get_property(ov::intel_cpu::weights_decompression));
+    EXPECT_TRUE(compressed.get_property(ov::intel_cpu::weights_decompression));
+    CheckWeightsAreCompressed(compressed, params);
+
+    ov::Tensor input(ov::element::f32, {params.batch, inputChannels});
+    auto inputData = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); i++)
+        inputData[i] = static_cast<float>(i % 7) * 0.25f - 0.75f;
+
+    auto referenceRequest = reference.create_infer_request();
+    referenceRequest.set_input_tensor(input);
+    referenceRequest.infer();
+    auto compressedRequest = compressed.create_infer_request();
+    compressedRequest.set_input_tensor(input);
+    compressedRequest.infer();
+
+    const auto expected = referenceRequest.get_output_tensor();
+    const auto actual = compressedRequest.get_output_tensor();
+    ASSERT_EQ(expected.get_shape(), actual.get_shape());
+    for (size_t i = 0; i < expected.get_size(); i++)
+        EXPECT_NEAR(expected.data<float>()[i], actual.data<float>()[i], 1e-3f) << i;
+}
+
+TEST(WeightsDecompressionTest, FP16Weights) {
+    CompareWithAndWithoutDecompression({ov::element::f16, false, false, false, 3});
+}
+
+TEST(WeightsDecompressionTest, FP16WeightsWithScales) {
+    CompareWithAndWithoutDecompression({ov::element::f16, false, true, false, 3});
+}
+
+TEST(WeightsDecompressionTest, BF16WeightsWithScalesAndRelu) {
+    CompareWithAndWithoutDecompression({ov::element::bf16, false, true, true, 3});
+}
+
+TEST(WeightsDecompressionTest, I8WeightsWithScales) {
+    CompareWithAndWithoutDecompression({ov::element::i8, false, true, false, 3});
+}
+
+TEST(WeightsDecompressionTest, U8WeightsWithZeroPointsScalesAndRelu) {
+    CompareWithAndWithoutDecompression({ov::element::u8, true, true, true, 3});
+}
+
+TEST(WeightsDecompressionTest, FP16WeightsWithScalesAndReluLargeBatch) {
+    CompareWithAndWithoutDecompression({ov::element::f16, false, true, true, 64});
+}
+
+TEST(WeightsDecompressionTest, U8WeightsWithZeroPointsScalesLargeBatch) {
+    CompareWithAndWithoutDecompression({ov::element::u8, true, true, false, 64});
+}
+
+}  // namespace
@@ -4,6 +4,7 @@
 
 #include "behavior/ov_plugin/properties_tests.hpp"
 #include <openvino/runtime/auto/properties.hpp>
+#include <openvino/runtime/intel_cpu/properties.hpp>
 
 using namespace ov::test::behavior;
 using namespace InferenceEngine::PluginConfigParams;
@@ -14,6 +15,11 @@ const std::vector<ov::AnyMap> cpu_properties = {
         {ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY)},
         {ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT)},
         {ov::hint::performance_mode(ov::hint::PerformanceMode::UNDEFINED)},
+        {ov::intel_cpu::elastic_streams(true)},
+        {ov::intel_cpu::weights_decompression(true)},
+        {ov::intel_cpu::hardware_counters(true)},
+        {ov::intel_cpu::tensor_pool(true)},
+        {ov::intel_cpu::shared_weights_dir("shared_weights")},
 };
 
 INSTANTIATE_TEST_SUITE_P(smoke_BehaviorTests, OVPropertiesTests,
@@ -22,13 +28,44 @@ INSTANTIATE_TEST_SUITE_P(smoke_BehaviorTests, OVPropertiesTests,
                 ::testing::ValuesIn(cpu_properties)),
         OVPropertiesTests::getTestCaseName);
 
+const std::vector<ov::AnyMap> cpu_default_properties = {
+        {ov::intel_cpu::elastic_streams(false)},
+        {ov::intel_cpu::weights_decompression(false)},
+        {ov::intel_cpu::runtime_tracing(false)},
+        {ov::intel_cpu::hardware_counters(false)},
+        {ov::intel_cpu::tensor_pool(false)},
+        {ov::intel_cpu::shared_weights_dir("")},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_BehaviorTests, OVPropertiesDefaultTests,
+        ::testing::Combine(
+                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                ::testing::ValuesIn(cpu_default_properties)),
+        OVPropertiesDefaultTests::getTestCaseName);
+
+const std::vector<ov::AnyMap> cpu_incorrect_properties = {
+        {{ov::intel_cpu::elastic_streams.name(), "MAYBE"}},
+        {{ov::intel_cpu::weights_decompression.name(), "MAYBE"}},
+        {{ov::intel_cpu::runtime_tracing.name(), "MAYBE"}},
+        {{ov::intel_cpu::hardware_counters.name(), "MAYBE"}},
+        {{ov::intel_cpu::tensor_pool.name(), "MAYBE"}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_BehaviorTests, OVPropertiesIncorrectTests,
+        ::testing::Combine(
+                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                ::testing::ValuesIn(cpu_incorrect_properties)),
+        OVPropertiesIncorrectTests::getTestCaseName);
+
 const std::vector<ov::AnyMap> multi_Auto_properties = {
         {ov::device::priorities(CommonTestUtils::DEVICE_CPU), ov::hint::performance_mode(ov::hint::PerformanceMode::UNDEFINED)},
         {ov::device::priorities(CommonTestUtils::DEVICE_CPU), ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT)},
         {ov::device::priorities(CommonTestUtils::DEVICE_CPU), ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY)},
         {ov::device::priorities(CommonTestUtils::DEVICE_CPU), ov::hint::performance_mode(ov::hint::PerformanceMode::CUMULATIVE_THROUGHPUT)},
         {ov::device::priorities(CommonTestUtils::DEVICE_CPU), ov::intel_auto::device_bind_buffer("YES")},
-        {ov::device::priorities(CommonTestUtils::DEVICE_CPU), ov::intel_auto::device_bind_buffer("NO")}
+        {ov::device::priorities(CommonTestUtils::DEVICE_CPU), ov::intel_auto::device_bind_buffer("NO")},
+        {ov::device::priorities(CommonTestUtils::DEVICE_CPU),
+         ov::intel_auto::schedule_policy(ov::intel_auto::SchedulePolicy::EARLIEST_COMPLETION)}
 };
 
 INSTANTIATE_TEST_SUITE_P(smoke_AutoMultiBehaviorTests, OVPropertiesTests,
@@ -81,6 +118,7 @@ const std::vector<ov::AnyMap> default_properties = {
         {ov::hint::allow_auto_batching(true)},
         {ov::auto_batch_timeout("1000")},
         {ov::intel_auto::device_bind_buffer(false)},
+        {ov::intel_auto::schedule_policy(ov::intel_auto::SchedulePolicy::DEVICE_PRIORITY)},
         {ov::device::priorities("")}
 };
 INSTANTIATE_TEST_SUITE_P(smoke_AutoBehaviorTests, OVPropertiesDefaultTests,
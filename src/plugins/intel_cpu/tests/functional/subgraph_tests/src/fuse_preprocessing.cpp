@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <openvino/core/preprocess/pre_post_process.hpp>
+
+using namespace ov::test;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+   Parameter [u8, NHWC] -> Convert -> ReverseChannels -> Subtract (mean) -> Divide (scale) -> Transpose (NCHW) -> Relu
+   The chain inserted by PrePostProcessor is executed by a single FusedPreprocess node, the same chain built
+   as a part of the model is executed by the regular nodes.
+*/
+class FusePreprocessingTest : public testing::WithParamInterface<bool>, public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<bool>& obj) {
+        return obj.param ? "PrePostProcessor" : "ModelOperations";
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        const bool usePrePostProcessor = GetParam();
+
+        if (usePrePostProcessor) {
+            auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 3, 16, 16});
+            auto relu = std::make_shared<ov::opset8::Relu>(param);
+            auto model = std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{param}, "FusePreprocessing");
+
+            auto ppp = ov::preprocess::PrePostProcessor(model);
+            ppp.input().tensor().set_element_type(ov::element::u8).set_layout("NHWC");
+            ppp.input().preprocess()
+                .convert_element_type(ov::element::f32)
+                .reverse_channels()
+                .mean({123.675f, 116.28f, 103.53f})
+                .scale({58.395f, 57.12f, 57.375f});
+            ppp.input().model().set_layout("NCHW");
+            function = ppp.build();
+        } else {
+            auto param = std::make_shared<ov::opset8::Parameter>(ov::element::u8, ov::Shape{1, 16, 16, 3});
+            auto convert = std::make_shared<ov::opset8::Convert>(param, ov::element::f32);
+            auto gather = std::make_shared<ov::opset8::Gather>(convert,
+                                                               ov::opset8::Constant::create(ov::element::i32, {3}, {2, 1, 0}),
+                                                               ov::opset8::Constant::create(ov::element::i32, {}, {3}));
+            auto mean = ov::opset8::Constant::create(ov::element::f32, {1, 1, 1, 3}, {123.675f, 116.28f, 103.53f});
+            auto subtract = std::make_shared<ov::opset8::Subtract>(gather, mean);
+            auto scale = ov::opset8::Constant::create(ov::element::f32, {1, 1, 1, 3}, {58.395f, 57.12f, 57.375f});
+            auto divide = std::make_shared<ov::opset8::Divide>(subtract, scale);
+            auto transpose = std::make_shared<ov::opset8::Transpose>(divide,
+                                                                     ov::opset8::Constant::create(ov::element::i64, {4}, {0, 3, 1, 2}));
+            auto relu = std::make_shared<ov::opset8::Relu>(transpose);
+            function = std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{param}, "FusePreprocessing");
+        }
+        init_input_shapes({InputShape{{}, {{1, 16, 16, 3}}}});
+    }
+};
+
+TEST_P(FusePreprocessingTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "FusedPreprocess", GetParam() ? 1 : 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_FusePreprocessing, FusePreprocessingTest, ::testing::Bool(),
+                         FusePreprocessingTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
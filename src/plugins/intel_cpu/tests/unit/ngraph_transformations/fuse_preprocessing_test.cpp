@@ -0,0 +1,144 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <openvino/core/model.hpp>
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <ngraph_transformations/fuse_preprocessing.hpp>
+#include <ngraph_transformations/op/fused_preprocess.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/rt_info/preprocessing_attribute.hpp>
+#include <openvino/pass/manager.hpp>
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+TEST(TransformationTests, FusePreprocessingConvertMeanScaleTranspose) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::Shape{ 1, 224, 224, 3 });
+        auto convert = std::make_shared<ov::opset1::Convert>(input, ov::element::f32);
+        auto mean = ov::opset1::Constant::create(ov::element::f32, ov::Shape{ 1, 1, 1, 3 }, { 1.f, 2.f, 3.f });
+        auto subtract = std::make_shared<ov::opset1::Subtract>(convert, mean);
+        auto scale = ov::opset1::Constant::create(ov::element::f32, ov::Shape{ 1, 1, 1, 3 }, { 2.f, 4.f, 8.f });
+        auto divide = std::make_shared<ov::opset1::Divide>(subtract, scale);
+        auto order = ov::opset1::Constant::create(ov::element::i64, ov::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto transpose = std::make_shared<ov::opset1::Transpose>(divide, order);
+        auto relu = std::make_shared<ov::opset1::Relu>(transpose);
+        for (const auto& node : ov::NodeVector{ convert, subtract, divide, transpose })
+            ov::set_is_preprocessing_node(node);
+
+        f = std::make_shared<ov::Model>(ov::NodeVector{ relu }, ov::ParameterVector{ input });
+        ov::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<FusePreprocessing>();
+        m.run_passes(f);
+    }
+    {
+        auto input = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::Shape{ 1, 224, 224, 3 });
+        auto preprocess = std::make_shared<FusedPreprocessNode>(input,
+                                                                3,
+                                                                std::vector<int64_t>{ 0, 1, 2 },
+                                                                std::vector<float>{ 0.5f, 0.25f, 0.125f },
+                                                                std::vector<float>{ -0.5f, -0.5f, -0.375f },
+                                                                std::vector<int64_t>{ 0, 3, 1, 2 },
+                                                                ov::element::f32);
+        auto relu = std::make_shared<ov::opset1::Relu>(preprocess);
+
+        f_ref = std::make_shared<ov::Model>(ov::NodeVector{ relu }, ov::ParameterVector{ input });
+    }
+
+    auto res = compare_functions(f, f_ref, false, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, FusePreprocessingReverseChannels) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::PartialShape{ -1, -1, -1, 3 });
+        auto convert = std::make_shared<ov::opset1::Convert>(input, ov::element::f32);
+        auto indices = ov::opset1::Constant::create(ov::element::i32, ov::Shape{ 3 }, { 2, 1, 0 });
+        auto axis = ov::opset1::Constant::create(ov::element::i32, ov::Shape{}, { 3 });
+        auto gather = std::make_shared<ov::opset8::Gather>(convert, indices, axis);
+        auto mean = ov::opset1::Constant::create(ov::element::f32, ov::Shape{ 1, 1, 1, 3 }, { 1.f, 2.f, 3.f });
+        auto subtract = std::make_shared<ov::opset1::Subtract>(gather, mean);
+        auto relu = std::make_shared<ov::opset1::Relu>(subtract);
+        for (const auto& node : ov::NodeVector{ convert, gather, subtract })
+            ov::set_is_preprocessing_node(node);
+
+        f = std::make_shared<ov::Model>(ov::NodeVector{ relu }, ov::ParameterVector{ input });
+        ov::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<FusePreprocessing>();
+        m.run_passes(f);
+    }
+    {
+        auto input = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::PartialShape{ -1, -1, -1, 3 });
+        auto preprocess = std::make_shared<FusedPreprocessNode>(input,
+                                                                3,
+                                                                std::vector<int64_t>{ 2, 1, 0 },
+                                                                std::vector<float>{ 1.f, 1.f, 1.f },
+                                                                std::vector<float>{ -1.f, -2.f, -3.f },
+                                                                std::vector<int64_t>{ 0, 1, 2, 3 },
+                                                                ov::element::f32);
+        auto relu = std::make_shared<ov::opset1::Relu>(preprocess);
+
+        f_ref = std::make_shared<ov::Model>(ov::NodeVector{ relu }, ov::ParameterVector{ input });
+    }
+
+    auto res = compare_functions(f, f_ref, false, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, FusePreprocessingSkipPureFloatEltwise) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    auto create_model = [] {
+        auto input = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{ 1, 3, 16, 16 });
+        auto mean = ov::opset1::Constant::create(ov::element::f32, ov::Shape{ 1, 3, 1, 1 }, { 1.f, 2.f, 3.f });
+        auto subtract = std::make_shared<ov::opset1::Subtract>(input, mean);
+        auto scale = ov::opset1::Constant::create(ov::element::f32, ov::Shape{ 1, 3, 1, 1 }, { 2.f, 4.f, 8.f });
+        auto multiply = std::make_shared<ov::opset1::Multiply>(subtract, scale);
+        ov::set_is_preprocessing_node(subtract);
+        ov::set_is_preprocessing_node(multiply);
+        return std::make_shared<ov::Model>(ov::NodeVector{ multiply }, ov::ParameterVector{ input });
+    };
+    f = create_model();
+    ov::pass::Manager m;
+    m.register_pass<ngraph::pass::InitNodeInfo>();
+    m.register_pass<FusePreprocessing>();
+    m.run_passes(f);
+    f_ref = create_model();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, FusePreprocessingSkipModelOperations) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    // the same chain as produced by PrePostProcessor, but the operations belong to the model
+    auto create_model = [] {
+        auto input = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::Shape{ 1, 224, 224, 3 });
+        auto convert = std::make_shared<ov::opset1::Convert>(input, ov::element::f32);
+        auto mean = ov::opset1::Constant::create(ov::element::f32, ov::Shape{ 1, 1, 1, 3 }, { 1.f, 2.f, 3.f });
+        auto subtract = std::make_shared<ov::opset1::Subtract>(convert, mean);
+        auto order = ov::opset1::Constant::create(ov::element::i64, ov::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto transpose = std::make_shared<ov::opset1::Transpose>(subtract, order);
+        return std::make_shared<ov::Model>(ov::NodeVector{ transpose }, ov::ParameterVector{ input });
+    };
+    f = create_model();
+    ov::pass::Manager m;
+    m.register_pass<ngraph::pass::InitNodeInfo>();
+    m.register_pass<FusePreprocessing>();
+    m.run_passes(f);
+    f_ref = create_model();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
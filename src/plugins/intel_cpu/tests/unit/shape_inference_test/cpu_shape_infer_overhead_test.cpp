@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+
+#include <cpu_memory.h>
+#include <memory_desc/cpu_blocked_memory_desc.h>
+#include <openvino/op/parameter.hpp>
+#include <openvino/op/relu.hpp>
+#include <openvino/op/reshape.hpp>
+#include <utils/shape_inference/shape_inference_cpu.hpp>
+
+using namespace ov;
+using namespace ov::intel_cpu;
+
+namespace {
+constexpr size_t iterations = 100000;
+
+class CpuShapeInferOverheadTest : public ::testing::Test {
+protected:
+    void SetUpRelu() {
+        auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(4));
+        auto relu = std::make_shared<op::v0::Relu>(data);
+        shapeInfer = NgraphShapeInferFactory(relu, EMPTY_PORT_MASK).makeShapeInfer();
+        dims = {1, 3, 16, 16};
+        inputShapes = {dims};
+        inputValues = {nullptr};
+        expected = dims;
+    }
+
+    void SetUpReshape() {
+        auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(4));
+        auto pattern = std::make_shared<op::v0::Parameter>(element::i32, PartialShape{2});
+        auto reshape = std::make_shared<op::v1::Reshape>(data, pattern, true);
+        shapeInfer = NgraphShapeInferFactory(reshape, 1 << 1).makeShapeInfer();
+
+        const int32_t patternValues[] = {0, -1};
+        patternMem = std::make_shared<Memory>(eng);
+        patternMem->Create(CpuBlockedMemoryDesc(InferenceEngine::Precision::I32, Shape(VectorDims{2})), patternValues);
+        dims = {3, 6, 5, 5};
+        inputShapes = {dims, patternDims};
+        inputValues = {nullptr, patternMem.get()};
+        expected = {3, 150};
+    }
+
+    // the same inputs are inferred repeatedly, as it happens for a dynamic graph with the stable shapes
+    void Infer(size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            auto result = shapeInfer->infer(inputShapes, inputValues);
+            ASSERT_EQ(result.size(), 1u);
+            ASSERT_EQ(result.front(), expected);
+        }
+    }
+
+    void MeasureInfer() {
+        const auto begin = std::chrono::steady_clock::now();
+        Infer(iterations);
+        const auto end = std::chrono::steady_clock::now();
+        RecordProperty("ns_per_call",
+                       std::to_string(std::chrono::duration<double, std::nano>(end - begin).count() / iterations));
+    }
+
+    dnnl::engine eng{dnnl::engine::kind::cpu, 0};
+    ShapeInferPtr shapeInfer;
+    VectorDims dims;
+    const VectorDims patternDims{2};
+    std::shared_ptr<Memory> patternMem;
+    std::vector<std::reference_wrapper<const VectorDims>> inputShapes;
+    std::vector<const Memory*> inputValues;
+    VectorDims expected;
+};
+}  // namespace
+
+TEST_F(CpuShapeInferOverheadTest, Relu) {
+    SetUpRelu();
+    Infer(3);
+}
+
+TEST_F(CpuShapeInferOverheadTest, ReshapeWithDataDependency) {
+    SetUpReshape();
+    Infer(3);
+}
+
+// The timing runs are not executed by default, the result is reported as the ns_per_call property of the test
+// (e.g. --gtest_also_run_disabled_tests --gtest_output=xml)
+TEST_F(CpuShapeInferOverheadTest, DISABLED_ReluTiming) {
+    SetUpRelu();
+    MeasureInfer();
+}
+
+TEST_F(CpuShapeInferOverheadTest, DISABLED_ReshapeWithDataDependencyTiming) {
+    SetUpReshape();
+    MeasureInfer();
+}
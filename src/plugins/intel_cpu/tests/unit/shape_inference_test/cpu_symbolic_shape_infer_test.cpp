@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <nodes/eltwise.h>
+#include <openvino/op/add.hpp>
+#include <openvino/op/parameter.hpp>
+#include <openvino/op/relu.hpp>
+#include <utils/shape_inference/shape_inference_cpu.hpp>
+#include <utils/shape_inference/shape_inference_pass_through.hpp>
+
+using namespace ov;
+using namespace ov::intel_cpu;
+
+TEST(CpuSymbolicShapeInferTest, PassThrough) {
+    auto shapeInfer = PassThroughShapeInferFactory().makeShapeInfer();
+
+    const SymbolicDims input{SymbolicDim::symbol(0), SymbolicDim::constant(3), SymbolicDim::symbol(1)};
+    std::vector<SymbolicDims> outputs;
+    ASSERT_TRUE(shapeInfer->inferSymbolic({input}, outputs));
+    ASSERT_EQ(outputs.size(), 1);
+    ASSERT_EQ(outputs.front(), input);
+}
+
+TEST(CpuSymbolicShapeInferTest, PassThroughWithoutInputs) {
+    auto shapeInfer = PassThroughShapeInferFactory().makeShapeInfer();
+
+    std::vector<SymbolicDims> outputs;
+    ASSERT_FALSE(shapeInfer->inferSymbolic({}, outputs));
+}
+
+TEST(CpuSymbolicShapeInferTest, NgraphFallsBackToInfer) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(2));
+    auto relu = std::make_shared<op::v0::Relu>(data);
+    auto shapeInfer = NgraphShapeInferFactory(relu, EMPTY_PORT_MASK).makeShapeInfer();
+
+    const SymbolicDims input{SymbolicDim::symbol(0), SymbolicDim::symbol(1)};
+    std::vector<SymbolicDims> outputs;
+    ASSERT_FALSE(shapeInfer->inferSymbolic({input}, outputs));
+}
+
+TEST(CpuSymbolicShapeInferTest, EltwiseBroadcast) {
+    auto a = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, 4});
+    auto b = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, 4});
+    auto add = std::make_shared<op::v1::Add>(a, b);
+    const dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    WeightsSharing::Ptr cache;
+    const node::Eltwise eltwise(add, eng, cache);
+
+    const auto s0 = SymbolicDim::symbol(0);
+    const auto s1 = SymbolicDim::symbol(1);
+    const auto one = SymbolicDim::constant(1);
+    const auto four = SymbolicDim::constant(4);
+    const SymbolicDims expected{s0, s1, four};
+    std::vector<SymbolicDims> outputs;
+
+    // equal symbols
+    const SymbolicDims sameSymbols{s1, four};
+    ASSERT_TRUE(eltwise.shapeInferSymbolic({expected, sameSymbols}, outputs));
+    ASSERT_EQ(outputs.size(), 1);
+    ASSERT_EQ(outputs.front(), expected);
+
+    // constant 1 is broadcasted to the symbol and to the constant
+    const SymbolicDims broadcastedA{s0, one, four};
+    const SymbolicDims broadcastedB{s1, one};
+    ASSERT_TRUE(eltwise.shapeInferSymbolic({broadcastedA, broadcastedB}, outputs));
+    ASSERT_EQ(outputs.size(), 1);
+    ASSERT_EQ(outputs.front(), expected);
+
+    // the output depends on the values of the different symbols
+    const SymbolicDims otherSymbol{s0, four};
+    ASSERT_FALSE(eltwise.shapeInferSymbolic({expected, otherSymbol}, outputs));
+
+    // the output depends on whether the symbol is 1 or not
+    const SymbolicDims symbolAgainstConstant{s1, s0};
+    ASSERT_FALSE(eltwise.shapeInferSymbolic({expected, symbolAgainstConstant}, outputs));
+}
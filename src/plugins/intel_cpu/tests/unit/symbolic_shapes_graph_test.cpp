@@ -0,0 +1,200 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <edge.h>
+#include <graph.h>
+#include <node.h>
+#include <nodes/common/cpu_memcpy.h>
+#include <nodes/input.h>
+#include <utils/shape_inference/shape_inference_cpu.hpp>
+
+#include <openvino/op/op.hpp>
+#include <openvino/op/parameter.hpp>
+#include <openvino/op/result.hpp>
+
+using namespace ov::intel_cpu;
+using InferenceEngine::Precision;
+
+namespace {
+
+// Copies the first input, its output shape is expressed symbolically only if all the input shapes are the same
+class SameShapesOp : public ov::op::Op {
+public:
+    OPENVINO_OP("SameShapesOp");
+
+    SameShapesOp() = default;
+    SameShapesOp(const ov::Output<ov::Node>& a, const ov::Output<ov::Node>& b) : Op({a, b}) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
+        return std::make_shared<SameShapesOp>(new_args.at(0), new_args.at(1));
+    }
+};
+
+class CountingShapeInfer : public ShapeInferEmptyPads {
+public:
+    explicit CountingShapeInfer(std::shared_ptr<size_t> inferCount) : inferCount(std::move(inferCount)) {}
+
+    std::vector<VectorDims> infer(
+        const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+        const std::vector<const Memory*>& data_dependency) override {
+        (*inferCount)++;
+        return {input_shapes.front().get()};
+    }
+
+    bool inferSymbolic(
+        const std::vector<std::reference_wrapper<const SymbolicDims>>& input_shapes,
+        std::vector<SymbolicDims>& output_shapes) const override {
+        for (const auto& shape : input_shapes) {
+            if (shape.get() != input_shapes.front().get())
+                return false;
+        }
+        output_shapes = {input_shapes.front().get()};
+        return true;
+    }
+
+    port_mask_t get_port_mask() const override {
+        return EMPTY_PORT_MASK;
+    }
+
+private:
+    std::shared_ptr<size_t> inferCount;
+};
+
+class CountingShapeInferFactory : public ShapeInferFactory {
+public:
+    explicit CountingShapeInferFactory(std::shared_ptr<size_t> inferCount) : inferCount(std::move(inferCount)) {}
+
+    ShapeInferPtr makeShapeInfer() const override {
+        return std::make_shared<CountingShapeInfer>(inferCount);
+    }
+
+private:
+    std::shared_ptr<size_t> inferCount;
+};
+
+class SameShapesNode : public Node {
+public:
+    SameShapesNode(const std::shared_ptr<ov::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr& cache,
+                   std::shared_ptr<size_t> inferCount)
+        : Node(op, eng, cache, CountingShapeInferFactory(std::move(inferCount))) {}
+
+    void getSupportedDescriptors() override {}
+
+    void initSupportedPrimitiveDescriptors() override {
+        if (!supportedPrimitiveDescriptors.empty())
+            return;
+        addSupportedPrimDesc({{LayoutType::ncsp, Precision::FP32}, {LayoutType::ncsp, Precision::FP32}},
+                             {{LayoutType::ncsp, Precision::FP32}},
+                             impl_desc_type::ref);
+    }
+
+    void execute(dnnl::stream strm) override {
+        const auto& src = getParentEdgeAt(0)->getMemory();
+        const auto& dst = getChildEdgeAt(0)->getMemory();
+        cpu_memcpy(dst.GetPtr(), src.GetPtr(), src.GetSize());
+    }
+
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
+
+    bool needPrepareParams() const override {
+        return false;
+    }
+
+    bool created() const override {
+        return true;
+    }
+};
+
+/*
+ *  a [?, 4] ----> SameShapesNode(a, a) -> Result
+ *            \
+ *  b [?, 4] --+-> SameShapesNode(a, b) -> Result
+ *
+ *  The output shape of the first node is expressed by the symbol of a, while the second node depends on two symbols,
+ *  which values may differ, so it falls back to the shape inference.
+ */
+class SymbolicShapesGraphTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto a = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 4});
+        a->set_friendly_name("a");
+        auto b = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 4});
+        b->set_friendly_name("b");
+        auto sameSymbols = std::make_shared<SameShapesOp>(a, a);
+        sameSymbols->set_friendly_name("sameSymbols");
+        auto differentSymbols = std::make_shared<SameShapesOp>(a, b);
+        differentSymbols->set_friendly_name("differentSymbols");
+        auto sameSymbolsResult = std::make_shared<ov::op::v0::Result>(sameSymbols);
+        sameSymbolsResult->set_friendly_name("sameSymbolsResult");
+        auto differentSymbolsResult = std::make_shared<ov::op::v0::Result>(differentSymbols);
+        differentSymbolsResult->set_friendly_name("differentSymbolsResult");
+
+        auto aNode = std::make_shared<node::Input>(a, eng, cache);
+        auto bNode = std::make_shared<node::Input>(b, eng, cache);
+        auto sameSymbolsNode = std::make_shared<SameShapesNode>(sameSymbols, eng, cache, sameSymbolsInferCount);
+        auto differentSymbolsNode =
+            std::make_shared<SameShapesNode>(differentSymbols, eng, cache, differentSymbolsInferCount);
+        auto sameSymbolsResultNode = std::make_shared<node::Input>(sameSymbolsResult, eng, cache);
+        auto differentSymbolsResultNode = std::make_shared<node::Input>(differentSymbolsResult, eng, cache);
+
+        std::vector<EdgePtr> edges;
+        auto addEdge = [&](const NodePtr& parent, const NodePtr& child, int parentPort, int childPort) {
+            auto edge = std::make_shared<Edge>(parent, child, parentPort, childPort);
+            child->addEdge(edge);
+            edges.push_back(edge);
+        };
+        addEdge(aNode, sameSymbolsNode, 0, 0);
+        addEdge(aNode, sameSymbolsNode, 0, 1);
+        addEdge(aNode, differentSymbolsNode, 0, 0);
+        addEdge(bNode, differentSymbolsNode, 0, 1);
+        addEdge(sameSymbolsNode, sameSymbolsResultNode, 0, 0);
+        addEdge(differentSymbolsNode, differentSymbolsResultNode, 0, 0);
+
+        std::vector<NodePtr> nodes{aNode, bNode, sameSymbolsNode, differentSymbolsNode, sameSymbolsResultNode,
+                                   differentSymbolsResultNode};
+        graph.CreateGraph(nodes, edges, cache, "SymbolicShapesGraph");
+    }
+
+    void infer(size_t batch) {
+        for (const auto& input : graph.GetInputNodesMap())
+            input.second->redefineOutputMemory({VectorDims{batch, 4}});
+        graph.Infer();
+    }
+
+    VectorDims outputDims(const std::string& name) {
+        return graph.getOutputNodeByName(name)->getParentEdgeAt(0)->getMemory().getStaticDims();
+    }
+
+    const dnnl::engine eng{dnnl::engine::kind::cpu, 0};
+    WeightsSharing::Ptr cache;
+    std::shared_ptr<size_t> sameSymbolsInferCount = std::make_shared<size_t>(0);
+    std::shared_ptr<size_t> differentSymbolsInferCount = std::make_shared<size_t>(0);
+    Graph graph;
+};
+
+}  // namespace
+
+TEST_F(SymbolicShapesGraphTest, InferDynamicSkipsShapeInferenceOfSymbolicShapes) {
+    infer(2);
+    infer(2);
+    infer(3);
+
+    // the output shape follows the symbol of the input, but the shape inference isn't called
+    EXPECT_EQ(*sameSymbolsInferCount, 0u);
+    EXPECT_EQ(outputDims("sameSymbolsResult"), (VectorDims{3, 4}));
+
+    // the shape inference is called on the first inference and when the input shapes change
+    EXPECT_EQ(*differentSymbolsInferCount, 2u);
+    EXPECT_EQ(outputDims("differentSymbolsResult"), (VectorDims{3, 4}));
+}
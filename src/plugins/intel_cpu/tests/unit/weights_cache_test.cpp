@@ -0,0 +1,112 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "cpu_memory.h"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+class WeightsSharingTests : public ::testing::Test {
+protected:
+    // the threads call findOrCreate for the same key at once, so the creation overlaps with the lookups,
+    // the threads which get the creation error return nullptr
+    std::vector<MemoryPtr> findOrCreateConcurrently(const std::string& key,
+                                                    const std::function<MemoryPtr(void)>& create) {
+        std::atomic<int> ready{0};
+        std::vector<std::future<MemoryPtr>> futures;
+        for (int i = 0; i < threads; i++) {
+            futures.push_back(std::async(std::launch::async, [&] {
+                ready++;
+                while (ready < threads)
+                    std::this_thread::yield();
+                try {
+                    return static_cast<MemoryPtr>(*cache.findOrCreate(key, create));
+                } catch (const std::runtime_error&) {
+                    return MemoryPtr();
+                }
+            }));
+        }
+        std::vector<MemoryPtr> results;
+        for (auto& future : futures)
+            results.push_back(future.get());
+        return results;
+    }
+
+    static constexpr int threads = 8;
+    const dnnl::engine eng{dnnl::engine::kind::cpu, 0};
+    WeightsSharing cache;
+};
+}  // namespace
+
+TEST_F(WeightsSharingTests, concurrentFindOrCreateCreatesOnce) {
+    std::atomic<int> created{0};
+    const auto results = findOrCreateConcurrently("weights", [&] {
+        created++;
+        // the other threads find the pending memory in the meantime
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        return std::make_shared<Memory>(eng);
+    });
+
+    EXPECT_EQ(created, 1);
+    ASSERT_NE(results.front(), nullptr);
+    for (const auto& result : results)
+        EXPECT_EQ(result, results.front());
+}
+
+TEST_F(WeightsSharingTests, failedCreationIsRetriedByWaitingThread) {
+    std::atomic<int> attempts{0};
+    const auto results = findOrCreateConcurrently("weights", [&]() -> MemoryPtr {
+        if (attempts++ == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{20});
+            throw std::runtime_error("creation failed");
+        }
+        return std::make_shared<Memory>(eng);
+    });
+
+    // only the thread which created the memory gets the error, the waiting threads create it again
+    EXPECT_EQ(attempts, 2);
+    EXPECT_EQ(std::count(results.begin(), results.end(), nullptr), 1);
+    const auto created = std::find_if(results.begin(), results.end(), [](const MemoryPtr& result) {
+        return result != nullptr;
+    });
+    ASSERT_NE(created, results.end());
+    for (const auto& result : results) {
+        if (result)
+            EXPECT_EQ(result, *created);
+    }
+}
+
+TEST_F(WeightsSharingTests, creationDoesNotBlockOtherKeys) {
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    auto blocked = std::async(std::launch::async, [&] {
+        return static_cast<MemoryPtr>(*cache.findOrCreate("blocked", [&] {
+            released.wait();
+            return std::make_shared<Memory>(eng);
+        }));
+    });
+
+    auto other = std::async(std::launch::async, [&] {
+        return static_cast<MemoryPtr>(*cache.findOrCreate("other", [&] {
+            return std::make_shared<Memory>(eng);
+        }));
+    });
+    const auto status = other.wait_for(std::chrono::seconds{10});
+    release.set_value();
+    ASSERT_EQ(status, std::future_status::ready);
+    EXPECT_NE(other.get(), nullptr);
+    EXPECT_NE(blocked.get(), nullptr);
+}
@@ -42,6 +42,27 @@ TEST_P(OVInferRequestWaitTests, canstart_asyncInferWithGetInOutWithStatusOnlyWai
     OV_ASSERT_NO_THROW(req.wait_for({}));
 }
 
+TEST_P(OVInferRequestWaitTests, canStartAsyncWithPriorityAndDeadline) {
+    ov::Tensor tensor;
+    OV_ASSERT_NO_THROW(req.start_async(ov::hint::Priority::HIGH, std::chrono::milliseconds{100}));
+    OV_ASSERT_NO_THROW(req.wait());
+    OV_ASSERT_NO_THROW(tensor = req.get_tensor(output));
+    OV_ASSERT_NO_THROW(req.start_async(ov::hint::Priority::LOW));
+    OV_ASSERT_NO_THROW(req.wait());
+    OV_ASSERT_NO_THROW(req.start_async());
+    OV_ASSERT_NO_THROW(req.wait());
+}
+
+TEST_P(OVInferRequestWaitTests, canGetQueueWaitTime) {
+    std::chrono::nanoseconds queueWaitTime;
+    OV_ASSERT_NO_THROW(queueWaitTime = req.get_queue_wait_time());
+    ASSERT_EQ(queueWaitTime.count(), 0);
+    OV_ASSERT_NO_THROW(req.start_async(ov::hint::Priority::HIGH, std::chrono::milliseconds{100}));
+    OV_ASSERT_NO_THROW(req.wait());
+    OV_ASSERT_NO_THROW(queueWaitTime = req.get_queue_wait_time());
+    ASSERT_GE(queueWaitTime.count(), 0);
+}
+
 TEST_P(OVInferRequestWaitTests, canWaitWithotStartSsync) {
     OV_ASSERT_NO_THROW(req.wait());
     OV_ASSERT_NO_THROW(req.wait_for({}));
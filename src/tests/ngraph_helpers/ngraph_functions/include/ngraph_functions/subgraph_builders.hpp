@@ -747,6 +747,23 @@ inline std::shared_ptr<ngraph::Function> makeConvertTranspose(std::vector<size_t
     fn_ptr->set_friendly_name("ConvertTranspose");
     return fn_ptr;
 }
+
+inline std::shared_ptr<ngraph::Function> makeConvRelu(std::vector<size_t> inputShape = {1, 16, 32, 32},
+                                                      ngraph::element::Type_t type = ngraph::element::Type_t::f32) {
+    auto params = ngraph::builder::makeParams(type, {inputShape});
+    params.front()->set_friendly_name("Param_1");
+    params.front()->output(0).get_tensor().set_names({"data"});
+    auto conv = ngraph::builder::makeConvolution(params.front(), type, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                 ngraph::op::PadType::EXPLICIT, 32);
+    conv->set_friendly_name("Convolution");
+    auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+    relu->set_friendly_name("Relu");
+    auto result = std::make_shared<ngraph::opset1::Result>(relu);
+    result->set_friendly_name("result");
+    auto fn_ptr = std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, params);
+    fn_ptr->set_friendly_name("ConvRelu");
+    return fn_ptr;
+}
 }  // namespace subgraph
 }  // namespace builder
 }  // namespace ngraph
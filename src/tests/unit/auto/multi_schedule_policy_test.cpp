@@ -0,0 +1,208 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ie_metric_helpers.hpp>
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iexecutable_network_internal.hpp"
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "multi_schedule.hpp"
+#include "utils/config.hpp"
+#include "mock_common.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using ::testing::_;
+using ::testing::StrEq;
+using ::testing::Return;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using namespace MockMultiDevicePlugin;
+
+namespace {
+// a device with a fixed infer request latency, every request runs on its own thread
+struct FakeDevice {
+    explicit FakeDevice(std::chrono::milliseconds latency) : _latency{latency} {}
+    // the completion callbacks may start new requests, so the threads are joined until no new ones are started
+    void Join() {
+        for (;;) {
+            std::vector<std::thread> threads;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                threads.swap(_threads);
+            }
+            if (threads.empty())
+                return;
+            for (auto&& thread : threads)
+                thread.join();
+        }
+    }
+    const std::chrono::milliseconds _latency;
+    std::atomic<int>                _started = {0};
+    std::mutex                      _mutex;
+    std::vector<std::thread>        _threads;
+};
+
+class DelayedInferRequest : public InferenceEngine::IInferRequestInternal {
+public:
+    explicit DelayedInferRequest(FakeDevice& device) : _device(device) {}
+    void StartAsync() override {
+        _device._started++;
+        auto callback = _callback;
+        auto latency = _device._latency;
+        std::lock_guard<std::mutex> lock(_device._mutex);
+        _device._threads.emplace_back([callback, latency] {
+            std::this_thread::sleep_for(latency);
+            callback(nullptr);
+        });
+    }
+
+private:
+    FakeDevice& _device;
+};
+
+class MultiSchedulePolicyTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        context = std::make_shared<MultiScheduleContext>();
+        context->_LogTag = "MULTI";
+        context->_needPerfCounters = false;
+        context->_earliestCompletionSchedule = true;
+    }
+
+    void TearDown() override {
+        schedule.reset();
+        context.reset();
+        devices.clear();
+    }
+
+    // the devices are added in the order of priorities
+    void AddDevice(const std::string& name, std::chrono::milliseconds latency, unsigned int numRequests) {
+        auto& device = devices[name];
+        device.reset(new FakeDevice(latency));
+        auto* devicePtr = device.get();
+        auto network = std::make_shared<NiceMock<MockIExecutableNetworkInternal>>();
+        IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, optimalNum, numRequests);
+        ON_CALL(*network, GetMetric(StrEq(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS))))
+            .WillByDefault(Return(optimalNum));
+        ON_CALL(*network, CreateInferRequest()).WillByDefault(Invoke([devicePtr]() {
+            return std::make_shared<DelayedInferRequest>(*devicePtr);
+        }));
+        context->_devicePriorities.push_back({name, {}, -1, "", name, static_cast<unsigned int>(devices.size() - 1)});
+        context->_networksPerDevice[name] = {network, {}};
+    }
+
+    // keeps `parallelRequests` requests in flight, as an application with a pool of infer requests does,
+    // and returns the number of requests started on every device
+    std::map<std::string, int> Run(int parallelRequests, int totalRequests) {
+        schedule = std::make_shared<MultiSchedule>();
+        schedule->init(context);
+        std::mutex mutex;
+        std::condition_variable completion;
+        int submitted = parallelRequests;
+        int completed = 0;
+        std::function<void()> submit = [&] {
+            schedule->run([&] {
+                WorkerInferRequest* workerRequest = MultiSchedule::_thisWorkerInferRequest;
+                ThisRequestExecutor{&workerRequest}.run([&] {
+                    bool next = false;
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        completed++;
+                        if (submitted < totalRequests) {
+                            submitted++;
+                            next = true;
+                        }
+                    }
+                    completion.notify_all();
+                    if (next)
+                        submit();
+                });
+            });
+        };
+        for (int i = 0; i < parallelRequests; i++)
+            submit();
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            EXPECT_TRUE(completion.wait_for(lock, std::chrono::seconds(30), [&] {
+                return completed == totalRequests;
+            }));
+        }
+        std::map<std::string, int> started;
+        for (auto&& device : devices) {
+            device.second->Join();
+            started[device.first] = device.second->_started;
+        }
+        return started;
+    }
+
+    // destroyed in the reverse order: the schedule first, as its workers refer to the devices
+    std::map<std::string, std::unique_ptr<FakeDevice>> devices;
+    MultiScheduleContext::Ptr                          context;
+    MultiSchedule::Ptr                                 schedule;
+};
+}  // namespace
+
+TEST(DeviceLoadTest, latencyIsExponentiallyWeightedMovingAverage) {
+    DeviceLoad load(2);
+    load.UpdateLatency(800);
+    EXPECT_EQ(800, load._latency.load());
+    load.UpdateLatency(1600);
+    EXPECT_EQ(900, load._latency.load());
+    load.UpdateLatency(100);
+    EXPECT_EQ(800, load._latency.load());
+}
+
+TEST(DeviceLoadTest, expectedCompletionDrainsPendingRequests) {
+    DeviceLoad load(2);
+    load.UpdateLatency(1000);
+    EXPECT_DOUBLE_EQ(500.0, load.ExpectedCompletion());
+    load._inFlight = 1;
+    load._queued = 2;
+    EXPECT_DOUBLE_EQ(2000.0, load.ExpectedCompletion());
+}
+
+TEST(DeviceLoadTest, unmeasuredDeviceIsProbedWhileItHasIdleRequests) {
+    DeviceLoad measured(1);
+    measured.UpdateLatency(1);
+    DeviceLoad unmeasured(2);
+    unmeasured._inFlight = 1;
+    EXPECT_LT(unmeasured.ExpectedCompletion(), measured.ExpectedCompletion());
+    unmeasured._inFlight = 2;
+    EXPECT_EQ(std::numeric_limits<double>::max(), unmeasured.ExpectedCompletion());
+}
+
+TEST(SchedulePolicyConfigTest, unsupportedValueThrows) {
+    PluginConfig config;
+    EXPECT_NO_THROW(config.UpdateFromMap({{ov::intel_auto::schedule_policy.name(), "EARLIEST_COMPLETION"}}, "MULTI"));
+    EXPECT_THROW(config.UpdateFromMap({{ov::intel_auto::schedule_policy.name(), "FASTEST"}}, "MULTI"),
+                 InferenceEngine::Exception);
+}
+
+TEST_F(MultiSchedulePolicyTest, slowDeviceGetsFewerRequests) {
+    // the slow device goes first, so the DEVICE_PRIORITY policy would prefer it
+    AddDevice("SLOW", std::chrono::milliseconds(20), 2);
+    AddDevice("FAST", std::chrono::milliseconds(1), 2);
+    auto started = Run(4, 60);
+    // both devices are probed first, then the fast device takes the most of the requests
+    EXPECT_GE(started["SLOW"], 1);
+    EXPECT_GE(started["FAST"], 1);
+    EXPECT_LT(4 * started["SLOW"], started["FAST"]);
+}
+
+TEST_F(MultiSchedulePolicyTest, saturatedDeviceGetsFewerRequests) {
+    // the devices have the same latency, but the first one runs a single request at a time
+    AddDevice("NARROW", std::chrono::milliseconds(5), 1);
+    AddDevice("WIDE", std::chrono::milliseconds(5), 4);
+    auto started = Run(5, 60);
+    EXPECT_GE(started["NARROW"], 1);
+    EXPECT_LT(started["NARROW"], started["WIDE"]);
+}
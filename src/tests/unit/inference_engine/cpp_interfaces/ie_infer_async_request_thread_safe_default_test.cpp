@@ -2,7 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <chrono>
 #include <deque>
+#include <future>
+#include <thread>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
@@ -194,3 +198,196 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+TEST_F(InferRequestThreadSafeDefaultTests, canStartAsyncFromCallback) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    constexpr int runs = 100;
+    std::atomic<int> callbacks{0};
+    testRequest->SetCallback([&](std::exception_ptr) {
+        if (++callbacks < runs) {
+            testRequest->StartAsync();
+        }
+    });
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(runs);
+    testRequest->StartAsync();
+    while (callbacks < runs) {
+        testRequest->Wait(InferRequest::WaitMode::RESULT_READY);
+    }
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+    ASSERT_EQ(runs, callbacks);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, waitReturnsResultNotReadyUntilPipelineIsCompleted) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(2);
+    for (int i = 0; i < 2; i++) {
+        testRequest->StartAsync();
+        ASSERT_EQ(StatusCode::RESULT_NOT_READY, testRequest->Wait(InferRequest::WaitMode::STATUS_ONLY));
+        ASSERT_EQ(StatusCode::RESULT_NOT_READY, testRequest->Wait(1));
+        taskExecutor->executeAll();
+        ASSERT_EQ(StatusCode::OK, testRequest->Wait(InferRequest::WaitMode::STATUS_ONLY));
+    }
+}
+
+class InferRequestThreadSafeDefaultSchedulingTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"SchedulingTests", 1});
+        for (int id = 0; id < 3; id++) {
+            auto syncRequest = make_shared<MockIInferRequestInternal>(InputsDataMap{}, OutputsDataMap{});
+            EXPECT_CALL(*syncRequest, InferImpl()).WillRepeatedly(Invoke([this, id] {
+                executed.push_back(id);
+            }));
+            syncRequests.push_back(syncRequest);
+            requests.push_back(make_shared<AsyncInferRequestThreadSafeDefault>(syncRequest, taskExecutor, nullptr));
+        }
+    }
+
+    // occupies the only stream, so the started requests are queued
+    void blockExecutor() {
+        release = {};
+        auto released = release.get_future().share();
+        auto started = std::make_shared<std::promise<void>>();
+        auto startedFuture = started->get_future();
+        taskExecutor->run([released, started] {
+            started->set_value();
+            released.wait();
+        });
+        startedFuture.wait();
+    }
+
+    void releaseAndWait() {
+        release.set_value();
+        for (auto&& request : requests) {
+            request->Wait(InferRequest::WaitMode::RESULT_READY);
+        }
+    }
+
+    static TaskSchedulingInfo makeInfo(int priority, std::chrono::milliseconds deadline) {
+        TaskSchedulingInfo info;
+        info.priority = priority;
+        info.deadline = TaskSchedulingInfo::Clock::now() + deadline;
+        return info;
+    }
+
+    ITaskExecutor::Ptr taskExecutor;
+    std::vector<shared_ptr<MockIInferRequestInternal>> syncRequests;
+    std::vector<shared_ptr<AsyncInferRequestThreadSafeDefault>> requests;
+    std::vector<int> executed;
+    std::promise<void> release;
+};
+
+TEST_F(InferRequestThreadSafeDefaultSchedulingTests, requestWithDeadlineOvertakesQueuedRequests) {
+    blockExecutor();
+    requests[0]->StartAsync();
+    requests[1]->StartAsync();
+    requests[2]->SetSchedulingInfo(makeInfo(0, std::chrono::milliseconds{50}));
+    requests[2]->StartAsync();
+    releaseAndWait();
+    ASSERT_EQ(executed, (std::vector<int>{2, 0, 1}));
+}
+
+TEST_F(InferRequestThreadSafeDefaultSchedulingTests, schedulingInfoAppliesToOneStartOnly) {
+    requests[1]->SetSchedulingInfo(makeInfo(10, std::chrono::milliseconds{50}));
+    requests[1]->StartAsync();
+    requests[1]->Wait(InferRequest::WaitMode::RESULT_READY);
+
+    blockExecutor();
+    requests[0]->StartAsync();
+    requests[1]->StartAsync();
+    releaseAndWait();
+    ASSERT_EQ(executed, (std::vector<int>{1, 0, 1}));
+}
+
+TEST_F(InferRequestThreadSafeDefaultSchedulingTests, queueWaitTimeIncludesTimeSpentInQueue) {
+    const auto blockedTime = std::chrono::milliseconds{20};
+    blockExecutor();
+    requests[0]->StartAsync();
+    std::this_thread::sleep_for(blockedTime);
+    releaseAndWait();
+    ASSERT_GE(requests[0]->GetQueueWaitTime(), blockedTime);
+}
+
+namespace {
+struct EmptyInferRequest : public IInferRequestInternal {
+    EmptyInferRequest() : IInferRequestInternal(InputsDataMap{}, OutputsDataMap{}) {}
+    void InferImpl() override {
+        inferCount++;
+    }
+    std::atomic<int> inferCount{0};
+};
+
+class InferRequestThreadSafeDefaultRoundTripTests : public ::testing::Test {
+protected:
+    static constexpr int requestsInFlight = 4;
+
+    void SetUp() override {
+        taskExecutor = std::make_shared<CPUStreamsExecutor>(
+            IStreamsExecutor::Config{"InferRequestThreadSafeDefaultRoundTripTests", requestsInFlight});
+        for (int i = 0; i < requestsInFlight; i++) {
+            syncRequests.push_back(make_shared<EmptyInferRequest>());
+            requests.push_back(make_shared<AsyncInferRequestThreadSafeDefault>(syncRequests.back(),
+                                                                               taskExecutor,
+                                                                               nullptr));
+        }
+    }
+
+    // one request at a time
+    void runOneByOne(int runs) {
+        auto& request = requests.front();
+        for (int i = 0; i < runs; i++) {
+            request->StartAsync();
+            ASSERT_EQ(StatusCode::OK, request->Wait(InferRequest::WaitMode::RESULT_READY));
+        }
+    }
+
+    // all the requests are in flight
+    void runInFlight(int runs) {
+        for (int i = 0; i < runs; i++) {
+            for (auto&& r : requests) {
+                r->StartAsync();
+            }
+            for (auto&& r : requests) {
+                ASSERT_EQ(StatusCode::OK, r->Wait(InferRequest::WaitMode::RESULT_READY));
+            }
+        }
+    }
+
+    ITaskExecutor::Ptr taskExecutor;
+    std::vector<std::shared_ptr<EmptyInferRequest>> syncRequests;
+    std::vector<std::shared_ptr<AsyncInferRequestThreadSafeDefault>> requests;
+};
+}  // namespace
+
+TEST_F(InferRequestThreadSafeDefaultRoundTripTests, everyStartAsyncRunsInferenceOnce) {
+    constexpr int runs = 100;
+    runOneByOne(runs);
+    ASSERT_EQ(syncRequests.front()->inferCount, runs);
+
+    runInFlight(runs);
+    ASSERT_EQ(syncRequests.front()->inferCount, 2 * runs);
+    for (int i = 1; i < requestsInFlight; i++) {
+        ASSERT_EQ(syncRequests[i]->inferCount, runs);
+    }
+}
+
+// The results are reported as the latency_ns and throughput_rps properties of the test (e.g. --gtest_output=xml),
+// it is run manually with --gtest_also_run_disabled_tests
+TEST_F(InferRequestThreadSafeDefaultRoundTripTests, DISABLED_startAsyncWaitRoundTripTime) {
+    constexpr int warmupRuns = 1000;
+    constexpr int runs = 100000;
+    runOneByOne(warmupRuns);
+
+    auto begin = std::chrono::steady_clock::now();
+    runOneByOne(runs);
+    auto end = std::chrono::steady_clock::now();
+    RecordProperty("latency_ns",
+                   static_cast<int>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count() / runs));
+
+    begin = std::chrono::steady_clock::now();
+    runInFlight(runs / requestsInFlight);
+    end = std::chrono::steady_clock::now();
+    RecordProperty("throughput_rps", static_cast<int>(runs / std::chrono::duration<double>(end - begin).count()));
+}